@@ -77,8 +77,10 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
-	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	/**
+	 * Fix up the root table, the object table and the objects saved by threads after objects have moved.
+	 */
+	void fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
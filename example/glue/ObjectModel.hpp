@@ -67,6 +67,19 @@ public:
 	 */
 	virtual void tearDown(MM_GCExtensionsBase *extensions) {}
 
+	/**
+	 * Determine the size that an object occupied before it was moved, given the moved object. Example objects
+	 * do not grow when they move, so this is the size of the moved object.
+	 *
+	 * @param[in] objectPtr points to the moved object
+	 * @return the total size of the object before it was moved, in bytes, including padding bytes
+	 */
+	MMINLINE uintptr_t
+	getConsumedSizeInBytesWithHeaderBeforeMove(omrobjectptr_t objectPtr)
+	{
+		return getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
 	/**
 	 * Constructor.
 	 */
@@ -39,6 +39,13 @@ GC_ObjectModelDelegate::initializeAllocation(MM_EnvironmentBase *env, void *allo
 }
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
+void *
+GC_ObjectModelDelegate::getAllocationSiteKey(MM_EnvironmentBase *env, MM_AllocateInitialization *allocateInitialization)
+{
+	/* initializeObject() sets the size in the header to the bytes requested */
+	return (void *)allocateInitialization->getAllocateDescription()->getBytesRequested();
+}
+
 void
 GC_ObjectModelDelegate::calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *reservedObjectSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor)
 {
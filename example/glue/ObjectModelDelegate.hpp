@@ -221,6 +221,32 @@ public:
 	{
 		return U_8_MAX;
 	}
+
+	/**
+	 * Returns a key shared by every object with the same field layout as the given object (its class, in most
+	 * languages). The Scavenger learns hot fields per key when -Xgc:learnHotFields is enabled.
+	 * Objects in the example language have no class, so objects of the same size are assumed to share a layout.
+	 *
+	 * @param objectPtr the object to get the layout key of
+	 * @return the layout key of the object, or NULL if hot fields should not be learned for the object
+	 */
+	MMINLINE void *
+	getHotFieldProfileKey(omrobjectptr_t objectPtr)
+	{
+		return (void *)getObjectSizeInBytesWithHeader(objectPtr);
+	}
+
+	/**
+	 * Returns the layout key of the object referred to by the forwarded header, as getHotFieldProfileKey(omrobjectptr_t).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the layout key of the object, or NULL if hot fields should not be learned for the object
+	 */
+	MMINLINE void *
+	getHotFieldProfileKey(MM_ForwardedHeader *forwardedHeader)
+	{
+		return (void *)getForwardedObjectSizeInBytes(forwardedHeader);
+	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
@@ -230,6 +256,30 @@ public:
  	 * object to be obtained.
 	 */
 #if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Returns a key shared by the objects allocated at the same allocation site (or of the same class, if the
+	 * language does not track sites). Used to pretenure long lived sites when -Xgc:pretenureSurvivalThreshold= is set.
+	 * The example language has neither, so objects of the same size are assumed to come from the same site.
+	 *
+	 * @param[in] env pointer to environment for the allocating thread
+	 * @param[in] allocateInitialization the initializer of an allocation in progress, with the adjusted size requested
+	 * @return the allocation site key of the allocation, or NULL if the allocation should not be profiled
+	 */
+	void *getAllocationSiteKey(MM_EnvironmentBase *env, MM_AllocateInitialization *allocateInitialization);
+
+	/**
+	 * Returns the allocation site key of the object referred to by the forwarded header, matching the key
+	 * returned for its allocation by getAllocationSiteKey(MM_EnvironmentBase *, MM_AllocateInitialization *).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the allocation site key of the object, or NULL if the object should not be profiled
+	 */
+	MMINLINE void *
+	getAllocationSiteKey(MM_ForwardedHeader *forwardedHeader)
+	{
+		return (void *)getForwardedObjectSizeInBytes(forwardedHeader);
+	}
+
 	/**
 	 * Returns TRUE if the object referred to by the forwarded header is indexable.
 	 *
@@ -222,4 +222,36 @@ MM_ScavengerDelegate::fixupDestroyedSlot(MM_EnvironmentBase *env, MM_ForwardedHe
 }
 #endif /* defined (OMR_GC_COMPRESSED_POINTERS) */
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+void
+MM_ScavengerDelegate::switchConcurrentForThread(MM_EnvironmentBase *env)
+{
+	/* This method must be implemented if mutator threads keep any thread local state (such as a cached evacuate
+	 * range for a read barrier) that has to be refreshed when a concurrent scavenger cycle starts or ends.
+	 */
+}
+
+void
+MM_ScavengerDelegate::fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* This method must be implemented if an object may hold any object references that are live but not reachable
+	 * by traversing the reference graph from the root set or remembered set. In that case, this method should
+	 * call MM_Scavenger::fixupSlotWithoutCompression(..) for each uncompressed slot holding a reference to
+	 * an indirect object that is associated with the object.
+	 */
+}
+
+void
+MM_ScavengerDelegate::signalThreadsToFlushCaches(MM_EnvironmentBase *env)
+{
+	/* Example mutator threads copy objects only from a page protection fault, and release their copy caches before returning */
+}
+
+void
+MM_ScavengerDelegate::cancelSignalToFlushCaches(MM_EnvironmentBase *env)
+{
+	/* Nothing to cancel, see signalThreadsToFlushCaches() */
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -244,6 +244,17 @@ public:
 	 * Fixup should update slots to point to the forwarded version of the object and/or remove self forwarded bit in the object itself.
 	 */
 	void fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	/**
+	 * Ask mutator threads to release their copy caches, so that GC threads can scan them. Called when GC threads
+	 * run out of work during the concurrent phase while mutator threads still hold copy caches.
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void signalThreadsToFlushCaches(MM_EnvironmentBase *env);
+	/**
+	 * Withdraw a request made by signalThreadsToFlushCaches() that mutator threads have not acted upon yet.
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void cancelSignalToFlushCaches(MM_EnvironmentBase *env);
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	bool initialize(MM_EnvironmentBase* env) { return true; }
@@ -87,6 +87,16 @@ public:
 					rootEntry = (RootEntry *)hashTableNextDo(&state);
 				}
 			}
+			if ((NULL != omrVM->objectTable) && env->getExtensions()->isConcurrentScavengerPageProtectionEnabled()) {
+				/* without a read barrier the mutator must not find objects in evacuate space through the table, so its entries are strong */
+				ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+				while (NULL != objectEntry) {
+					if (NULL != objectEntry->objPtr) {
+						_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &objectEntry->objPtr);
+					}
+					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+				}
+			}
 			OMR_VMThread *walkThread;
 			GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
 			while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
@@ -125,8 +135,8 @@ public:
 					}
 					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
 				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
 			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
 
@@ -19,6 +19,12 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#if defined(LINUX)
+#include <signal.h>
+#include <string.h>
+#endif /* defined(LINUX) */
+
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
@@ -26,6 +32,10 @@
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "Scavenger.hpp"
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
@@ -43,16 +53,40 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workStealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_numaAffinity_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lazySweep_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_freeChunkCache_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_asyncLogging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_heapWalk_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardTableSummary_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_concurrentPacer_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_backgroundMark_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptiveTLHSizing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_backgroundTLHZeroing_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_adaptiveTaskThreads_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_spinParkBarrier_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_scavengerPrefetch_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_learnHotFields_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_rememberedSetSummary_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_pretenure_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX)
+                        , "fvtest/gctest/configuration/gencon_GC_concurrentScavengerPageProtection_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_stripedCompaction_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_partialCompaction_config.xml"
 #endif
                         };
 
@@ -705,6 +739,45 @@ done:
 	return rt;
 }
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX)
+static struct sigaction previousSIGSEGVAction;
+
+static void
+pageProtectionSignalHandler(int signal, siginfo_t *sigInfo, void *context)
+{
+	OMR_VMThread *omrVMThread = omr_vmthread_getCurrent(gcTestEnv->exampleVM._omrVM);
+	if ((NULL == omrVMThread) || !concurrentScavengerPageProtectionFaultHandler(omrVMThread, sigInfo->si_addr)) {
+		/* not a fault of the Scavenger, retrying the access faults again into the previous handler */
+		sigaction(SIGSEGV, &previousSIGSEGVAction, NULL);
+	}
+}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX) */
+
+int32_t
+GCConfigTest::protectedAllocationWalker(pugi::xml_node node)
+{
+	int32_t rt = 0;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX)
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	if (extensions->isConcurrentScavengerPageProtectionEnabled()) {
+		/* the mutator faults on the copy destinations of a concurrent scavenge until the Scavenger scanned them.
+		 * OMR_Initialize() leaves signals to the language, so the handler is installed here rather than through omrsig_protect()
+		 */
+		struct sigaction action;
+		memset(&action, 0, sizeof(action));
+		sigemptyset(&action.sa_mask);
+		action.sa_sigaction = pageProtectionSignalHandler;
+		action.sa_flags = SA_SIGINFO;
+		sigaction(SIGSEGV, &action, &previousSIGSEGVAction);
+		rt = allocationWalker(node);
+		sigaction(SIGSEGV, &previousSIGSEGVAction, NULL);
+		return rt;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX) */
+	rt = allocationWalker(node);
+	return rt;
+}
+
 int32_t
 GCConfigTest::allocationWalker(pugi::xml_node node)
 {
@@ -906,6 +979,209 @@ done:
 	return rt;
 }
 
+static int
+compareObjectAddresses(const void *element1, const void *element2)
+{
+	uintptr_t object1 = (uintptr_t)*(omrobjectptr_t *)element1;
+	uintptr_t object2 = (uintptr_t)*(omrobjectptr_t *)element2;
+	if (object1 == object2) {
+		return 0;
+	}
+	return (object1 < object2) ? -1 : 1;
+}
+
+int32_t
+GCConfigTest::verifyObjectGraph()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t heapBase = (uintptr_t)extensions->heap->getHeapBase();
+	uintptr_t heapTop = (uintptr_t)extensions->heap->getHeapTop();
+	uintptr_t objectCount = hashTableGetCount(exampleVM->objectTable);
+	uintptr_t referenceCount = 0;
+	uintptr_t i = 0;
+	J9HashTableState state;
+	int32_t rt = 0;
+
+	omrobjectptr_t *objects = (omrobjectptr_t *)omrmem_allocate_memory(OMR_MAX(objectCount, 1) * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == objects) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		return 1;
+	}
+	ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+	for (i = 0; NULL != objectEntry; i++) {
+		objects[i] = objectEntry->objPtr;
+		objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+	qsort(objects, objectCount, sizeof(omrobjectptr_t), compareObjectAddresses);
+
+	/* every object the test knows of has to be a distinct heap object holding only references to such objects */
+	for (i = 0; i < objectCount; i++) {
+		uintptr_t object = (uintptr_t)objects[i];
+		if ((object < heapBase) || (object >= heapTop)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p is outside of the heap.\n", __FILE__, __LINE__, objects[i]);
+			rt = 1;
+			goto done;
+		}
+		uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objects[i]);
+		uintptr_t limit = ((i + 1) < objectCount) ? (uintptr_t)objects[i + 1] : heapTop;
+		if ((size < sizeof(fomrobject_t)) || (size > (limit - object))) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p of %zu bytes overlaps the next object or the heap top %p.\n", __FILE__, __LINE__, objects[i], size, (void *)limit);
+			rt = 1;
+			goto done;
+		}
+
+		fomrobject_t *endSlot = (fomrobject_t *)(object + size);
+		for (fomrobject_t *currentSlot = (fomrobject_t *)object + 1; currentSlot < endSlot; currentSlot++) {
+			omrobjectptr_t reference = GC_SlotObject(exampleVM->_omrVM, currentSlot).readReferenceFromSlot();
+			if (NULL != reference) {
+				if (NULL == bsearch(&reference, objects, objectCount, sizeof(omrobjectptr_t), compareObjectAddresses)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p slot %p refers to unknown object %p.\n", __FILE__, __LINE__, objects[i], currentSlot, reference);
+					rt = 1;
+					goto done;
+				}
+				referenceCount += 1;
+			}
+		}
+	}
+
+	for (RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state); NULL != rootEntry; rootEntry = (RootEntry *)hashTableNextDo(&state)) {
+		if (NULL == bsearch(&rootEntry->rootPtr, objects, objectCount, sizeof(omrobjectptr_t), compareObjectAddresses)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Root %s refers to unknown object %p.\n", __FILE__, __LINE__, rootEntry->name, rootEntry->rootPtr);
+			rt = 1;
+			goto done;
+		}
+	}
+
+	gcTestEnv->log("Object graph: %zu objects, %zu references\n", objectCount, referenceCount);
+
+done:
+	omrmem_free_memory((void *)objects);
+	return rt;
+}
+
+int32_t
+GCConfigTest::reportCompactionThroughput()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t seq = 1;
+	uintptr_t compactions = 0;
+	double movedBytes = 0.0;
+	double elapsedMillis = 0.0;
+
+	/* Loop through multiple files if rolling log is enabled */
+	do {
+		pugi::xml_document verboseDoc;
+		if (0 == numOfFiles) {
+			verboseDoc.load_file(verboseFile);
+		} else {
+			char currentVerboseFile[MAX_NAME_LENGTH];
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
+			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			if (pugi::status_file_not_found == result.status) {
+				break;
+			}
+		}
+
+		pugi::xpath_node_set compactOps = verboseDoc.select_nodes("/verbosegc/gc-op[@type='compact'][compact-info/@movebytes]");
+		for (pugi::xpath_node_set::const_iterator it = compactOps.begin(); it != compactOps.end(); ++it) {
+			pugi::xml_node compactOp = it->node();
+			elapsedMillis += compactOp.attribute("timems").as_double();
+			movedBytes += compactOp.child("compact-info").attribute("movebytes").as_double();
+			compactions += 1;
+		}
+	} while (seq <= numOfFiles);
+
+	if (0 == compactions) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No compaction found in verbose output.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	double movedMB = movedBytes / (1024.0 * 1024.0);
+	gcTestEnv->log("Compactions: %zu, moved: %.3f MB, time: %.3f ms\n", compactions, movedMB, elapsedMillis);
+	if (0.0 < elapsedMillis) {
+		gcTestEnv->log("Compaction throughput: %.1f MB/s\n", movedMB * 1000.0 / elapsedMillis);
+	}
+	return 0;
+}
+
+typedef struct HeapWalkTotals {
+	GC_ObjectModel *objectModel;
+	volatile uintptr_t objects;
+	volatile uintptr_t bytes;
+} HeapWalkTotals;
+
+static void
+heapWalkObjectDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkTotals *totals = (HeapWalkTotals *)userData;
+	MM_AtomicOperations::add(&totals->objects, 1);
+	MM_AtomicOperations::add(&totals->bytes, totals->objectModel->getConsumedSizeInBytesWithHeader(object));
+}
+
+static void
+heapWalkObjectBatchDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t count, void *userData)
+{
+	HeapWalkTotals *totals = (HeapWalkTotals *)userData;
+	uintptr_t bytes = 0;
+	for (uintptr_t i = 0; i < count; i++) {
+		bytes += totals->objectModel->getConsumedSizeInBytesWithHeader(objects[i]);
+	}
+	MM_AtomicOperations::add(&totals->objects, count);
+	MM_AtomicOperations::add(&totals->bytes, bytes);
+}
+
+int32_t
+GCConfigTest::reportHeapWalkThroughput(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapWalker *heapWalker = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+	uintptr_t iterations = (uintptr_t)node.attribute("iterations").as_uint(10);
+	int32_t rt = 0;
+
+	env->acquireExclusiveVMAccess();
+	for (uintptr_t parallel = 0; parallel <= 1; parallel++) {
+		HeapWalkTotals objectTotals = { &extensions->objectModel, 0, 0 };
+		HeapWalkTotals batchTotals = { &extensions->objectModel, 0, 0 };
+		uint64_t objectMicros = 0;
+		uint64_t batchMicros = 0;
+
+		/* the first walk prepares the heap, later ones find it walkable */
+		for (uintptr_t i = 0; i <= iterations; i++) {
+			objectTotals.objects = objectTotals.bytes = 0;
+			batchTotals.objects = batchTotals.bytes = 0;
+
+			uint64_t startTime = omrtime_hires_clock();
+			heapWalker->allObjectsDo(env, heapWalkObjectDo, &objectTotals, 0, 1 == parallel, 0 == i);
+			uint64_t objectsWalkedTime = omrtime_hires_clock();
+			heapWalker->allObjectBatchesDo(env, heapWalkObjectBatchDo, &batchTotals, 0, 1 == parallel, false);
+			uint64_t batchesWalkedTime = omrtime_hires_clock();
+			if (0 != i) {
+				objectMicros += omrtime_hires_delta(startTime, objectsWalkedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				batchMicros += omrtime_hires_delta(objectsWalkedTime, batchesWalkedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			}
+		}
+
+		const char *mode = (1 == parallel) ? "parallel" : "serial";
+		if ((0 == objectTotals.objects) || (objectTotals.objects != batchTotals.objects) || (objectTotals.bytes != batchTotals.bytes)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d %s heap walk found %zu objects (%zu bytes) one at a time but %zu objects (%zu bytes) in batches.\n",
+					__FILE__, __LINE__, mode, objectTotals.objects, objectTotals.bytes, batchTotals.objects, batchTotals.bytes);
+			rt = 1;
+			break;
+		}
+
+		double objectMillis = OMR_MAX((double)objectMicros, 1.0) / 1000.0;
+		double batchMillis = OMR_MAX((double)batchMicros, 1.0) / 1000.0;
+		gcTestEnv->log("Heap walk (%s, %zu iterations): %zu objects, %.3f MB\n", mode, iterations, objectTotals.objects, (double)objectTotals.bytes / (1024.0 * 1024.0));
+		gcTestEnv->log("  per object: %.3f ms, %.1f objects/ms\n", objectMillis, (double)(objectTotals.objects * iterations) / objectMillis);
+		gcTestEnv->log("  in batches: %.3f ms, %.1f objects/ms\n", batchMillis, (double)(batchTotals.objects * iterations) / batchMillis);
+	}
+	env->releaseExclusiveVMAccess();
+
+	return rt;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -973,6 +1249,11 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "sleep")) {
+			/* the mutator stops allocating, leaving the processors to background GC threads */
+			int64_t millis = (int64_t)atoi(node.attribute("millis").value());
+			gcTestEnv->log("Sleeping for %lld ms...\n", millis);
+			omrthread_sleep(millis);
 		}
 	}
 done:
@@ -1033,7 +1314,7 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set objects = configChild.select_nodes(xs.object);
 			int64_t startTime = omrtime_current_time_millis();
 			for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
-				rt = allocationWalker(it->node());
+				rt = protectedAllocationWalker(it->node());
 				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
 			}
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
@@ -1044,13 +1325,31 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			verboseManager->flushStreams(env);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			/* object graph verification */
+			if (configChild.child("objectGraph")) {
+				rt = verifyObjectGraph();
+				ASSERT_EQ(0, rt) << "Failed in object graph verification.";
+			}
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
 			rt = triggerOperation(configChild.first_child());
 			ASSERT_EQ(0, rt) << "Failed to perform gc operation.";
+		} else if (0 == strcmp(configChild.name(), "benchmark")) {
+			gcTestEnv->log("\n++++++++++++++++++++++++++++Benchmark+++++++++++++++++++++++++++\n");
+			const char *benchmarkType = configChild.attribute("type").value();
+			if (0 == strcmp(benchmarkType, "compaction")) {
+				rt = reportCompactionThroughput();
+				ASSERT_EQ(0, rt) << "Failed to report compaction throughput.";
+			} else if (0 == strcmp(benchmarkType, "heapWalk")) {
+				rt = reportHeapWalkThroughput(configChild);
+				ASSERT_EQ(0, rt) << "Failed to report heap walk throughput.";
+			} else {
+				FAIL() << "Invalid XML input: unrecognized benchmark type \"" << benchmarkType << "\".";
+			}
 		} else if (0 == strcmp(configChild.name(), "mutation")) {
 			/*TODO*/
 		} else {
@@ -104,10 +104,14 @@ protected:
 	int32_t removeObjectFromObjectTable(const char *name);
 	int32_t removeObjectFromParentSlot(const char *name, ObjectEntry *parentEntry);
 	int32_t allocationWalker(pugi::xml_node node);
+	int32_t protectedAllocationWalker(pugi::xml_node node);
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t verifyObjectGraph();
+	int32_t reportCompactionThroughput();
+	int32_t reportHeapWalkThroughput(pugi::xml_node node);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -95,17 +96,106 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
 						result = false;
 					}
+				} else if (0 == strcmp(attr.name(), "workStealing")) {
+					extensions->workStealingMarking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaAffinity")) {
+					extensions->numaAwareGCWorkers = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTaskThreads")) {
+					extensions->adaptiveTaskThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "spinParkBarrier")) {
+					extensions->gcThreadSyncBarrier = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "lazySweep")) {
+					extensions->lazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeChunkCache")) {
+					extensions->freeChunkCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationLatencyStats")) {
+					extensions->allocationLatencyStats = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTLHSizing")) {
+					extensions->adaptiveTLHSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verboseTLHStats")) {
+					extensions->verboseTLHStats = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "tlhZeroing")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "nonTemporal")) {
+						extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_NON_TEMPORAL;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "repStosb")) {
+						extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_REP_STOSB;
+					} else {
+						extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_DEFAULT;
+					}
+				} else if (0 == strcmp(attr.name(), "tlhZeroingThreshold")) {
+					extensions->tlhZeroingThreshold = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "backgroundTLHZeroing")) {
+					extensions->backgroundTLHZeroing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodes")) {
+					/* logical nodes only, workers are assigned to them but never physically bound */
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+					extensions->numaForced = true;
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 					extensions->concurrentMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "cardTableSummary")) {
+					extensions->cardTableSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					/* the tests allocate outside of safe points and the example has no safepoint callback, so only
+					 * concurrent cycles that activate the write barrier without one get past their initialization
+					 */
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+					extensions->concurrentSlack = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "concurrentPacer")) {
+					extensions->concurrentPacer = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentPacerSlack")) {
+					extensions->concurrentPacerSlack = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "concurrentBackground")) {
+					extensions->concurrentBackground = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "concurrentBackgroundMark")) {
+					extensions->concurrentBackgroundMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentBackgroundCPUPercent")) {
+					extensions->concurrentBackgroundCPUPercent = (uintptr_t)atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = 1 - extensions->compactOnGlobalGC;
+				} else if (0 == strcmp(attr.name(), "stripedCompaction")) {
+					extensions->stripedCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "partialCompaction")) {
+					extensions->partialCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "partialCompactionBudget")) {
+					extensions->partialCompactionBudget = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPrefetchWindow")) {
+					extensions->scavengerPrefetchWindowSize = OMR_MIN((uintptr_t)atoi(attr.value()), (uintptr_t)MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE);
+				} else if (0 == strcmp(attr.name(), "learnHotFields")) {
+					extensions->learnHotFields = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldSampleRate")) {
+					extensions->hotFieldSampleRate = OMR_MAX((uintptr_t)atoi(attr.value()), (uintptr_t)1);
+				} else if (0 == strcmp(attr.name(), "rememberedSetSummaryThreshold")) {
+					extensions->rememberedSetSummaryThreshold = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "pretenureSurvivalThreshold")) {
+					extensions->pretenureSurvivalThreshold = OMR_MIN((uintptr_t)atoi(attr.value()), (uintptr_t)100);
+				} else if (0 == strcmp(attr.name(), "pretenureSampleRate")) {
+					extensions->pretenureSampleRate = OMR_MAX((uintptr_t)atoi(attr.value()), (uintptr_t)1);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX)
+				} else if (0 == strcmp(attr.name(), "concurrentScavengerPageProtection")) {
+					extensions->concurrentScavengerPageProtection = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->concurrentScavenger = extensions->concurrentScavengerPageProtection;
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX) */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
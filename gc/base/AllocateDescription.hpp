@@ -75,6 +75,7 @@ protected:
 	bool  _collectAndClimb;
 	bool  _climb;				/* indicates that current attempt to allocate should try parent, if current subspace failed */
 	bool  _completedFromTlh;
+	void *_allocationSiteKey; /**< Allocation site key of the allocation (see GC_ObjectModel::getAllocationSiteKey()), NULL if not profiled */
 
 public:
 
@@ -89,6 +90,7 @@ public:
 
 	MMINLINE uint32_t getObjectFlags() { return _objectFlags; }
 	MMINLINE bool getTenuredFlag() { return (_allocateFlags & OMR_GC_ALLOCATE_OBJECT_TENURED) == OMR_GC_ALLOCATE_OBJECT_TENURED; }
+	MMINLINE void setTenuredFlag() { _allocateFlags |= OMR_GC_ALLOCATE_OBJECT_TENURED; }
 	MMINLINE bool getPreHashFlag() { return OMR_GC_ALLOCATE_OBJECT_HASHED == (_allocateFlags & OMR_GC_ALLOCATE_OBJECT_HASHED); }
 
 	/* NON_ZERO_TLH flag set means JIT requested to skip zero in it (not what its name suggests to allocate from non zero TLH).
@@ -210,6 +212,9 @@ public:
 	MMINLINE bool isCompletedFromTlh() { return _completedFromTlh; }
 	MMINLINE void completedFromTlh() { _completedFromTlh = true; }
 
+	MMINLINE void setAllocationSiteKey(void *siteKey) { _allocationSiteKey = siteKey; }
+	MMINLINE void *getAllocationSiteKey() { return _allocationSiteKey; }
+
 	/**
 	 * Set whether the allocation succeeded
 	 * @param suceeded - true if the allocation succeeded, false otherwise
@@ -249,6 +254,7 @@ public:
 		, _collectAndClimb(collectAndClimb)
 		, _climb(false)
 		, _completedFromTlh(false)
+		, _allocationSiteKey(NULL)
 	{}
 };
 
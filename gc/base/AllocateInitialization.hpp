@@ -194,6 +194,12 @@ public:
 			void *heapBytes = NULL;
 			
 			_allocateDescription.setBytesRequested(objectModel->adjustSizeInBytes(_allocateDescription.getBytesRequested()));
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			if (NULL != env->getExtensions()->pretenureProfiler) {
+				/* the allocation interface profiles the site, and may allocate the object in tenure space */
+				_allocateDescription.setAllocationSiteKey(objectModel->getAllocationSiteKey(env, this));
+			}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 			if (isIndexable()) {
 				heapBytes = env->_objectAllocationInterface->allocateArrayletSpine(env,
 						&_allocateDescription, _allocateDescription.getMemorySpace(), isGCAllowed());
@@ -54,6 +54,17 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		_heapAlloc = (void *)heap->getHeapTop();
 		_cardTableVirtualStart = (Card *) ((uintptr_t)_cardTableStart - (((uintptr_t)getHeapBase()) >> CARD_SIZE_SHIFT));
 		initialized = true;
+
+		if (extensions->cardTableSummary) {
+			uintptr_t groups = MM_Math::roundToCeiling(CARD_SUMMARY_GROUP_SIZE, cardTableSizeRequired / sizeof(Card)) / CARD_SUMMARY_GROUP_SIZE;
+			_summaryTableSize = (MM_Math::roundToCeiling(CARD_SUMMARY_BITS_IN_SLOT, groups) / CARD_SUMMARY_BITS_IN_SLOT) * sizeof(uintptr_t);
+			_summaryTable = (volatile uintptr_t *)env->getForge()->allocate(_summaryTableSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _summaryTable) {
+				initialized = false;
+			} else {
+				memset((void *)_summaryTable, 0, _summaryTableSize);
+			}
+		}
 	}
 
 	return initialized;
@@ -71,6 +82,11 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _summaryTable) {
+		env->getForge()->free((void *)_summaryTable);
+		_summaryTable = NULL;
+	}
 }
 
 uintptr_t
@@ -256,6 +272,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			summarizeCard(card);
 		}
 	}
 }
@@ -263,15 +280,49 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 void
 MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *heapAddrTo)
 {
-	Card *card = heapAddrToCardAddr(env, heapAddrFrom);
+	Card *fromCard = heapAddrToCardAddr(env, heapAddrFrom);
 	Card *toCard = heapAddrToCardAddr(env, heapAddrTo);
 		
-	for ( ; card < toCard; card++) {
+	for (Card *card = fromCard; card < toCard; card++) {
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
 		}
 	}
+	summarizeCardRange(fromCard, toCard);
+}
+
+void
+MM_CardTable::summarizeCardRange(Card *firstCard, Card *topCard)
+{
+	if ((NULL != _summaryTable) && (firstCard < topCard)) {
+		Card *lastCard = topCard - 1;
+		for (Card *card = firstCard; card < lastCard; card += CARD_SUMMARY_GROUP_SIZE) {
+			summarizeCard(card);
+		}
+		/* the loop may step over the group of the last card */
+		summarizeCard(lastCard);
+	}
+}
+
+void
+MM_CardTable::clearSummaryForRange(Card *firstCard, Card *topCard)
+{
+	/* groups only partially in the range keep their bit, a group is only cleared with all of its cards */
+	uintptr_t firstGroup = MM_Math::roundToCeiling(CARD_SUMMARY_GROUP_SIZE, (uintptr_t)(firstCard - _cardTableStart)) / CARD_SUMMARY_GROUP_SIZE;
+	uintptr_t topGroup = ((uintptr_t)(topCard - _cardTableStart)) / CARD_SUMMARY_GROUP_SIZE;
+
+	uintptr_t group = firstGroup;
+	while (group < topGroup) {
+		uintptr_t bitIndex = group % CARD_SUMMARY_BITS_IN_SLOT;
+		uintptr_t bits = OMR_MIN(CARD_SUMMARY_BITS_IN_SLOT - bitIndex, topGroup - group);
+		uintptr_t mask = ((CARD_SUMMARY_BITS_IN_SLOT == bits) ? ~(uintptr_t)0 : ((((uintptr_t)1 << bits) - 1) << bitIndex));
+		volatile uintptr_t *slot = &_summaryTable[group / CARD_SUMMARY_BITS_IN_SLOT];
+		if (0 != (*slot & mask)) {
+			MM_AtomicOperations::bitAnd(slot, ~mask);
+		}
+		group += bits;
+	}
 }
 
 Card *
@@ -378,6 +429,11 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
+	/* Clear the summary first: a card dirtied while we clear is then either cleared with its bit or leaves it set */
+	if (NULL != _summaryTable) {
+		clearSummaryForRange(firstCard, lastCard);
+	}
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
@@ -33,6 +33,7 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "MemoryManager.hpp"
 
@@ -46,6 +47,15 @@ class MM_HeapRegionDescriptor;
  * @ingroup GC_Base
  */
 
+/**
+ * With -Xgc:cardTableSummary, the card table is summarized by one bit for every group of
+ * CARD_SUMMARY_GROUP_SIZE cards, so card cleaning can skip groups in which no card was dirtied.
+ */
+#define CARD_SUMMARY_GROUP_SHIFT 6
+#define CARD_SUMMARY_GROUP_SIZE ((uintptr_t)1 << CARD_SUMMARY_GROUP_SHIFT)
+#define CARD_SUMMARY_BITS_IN_SLOT (sizeof(uintptr_t) * 8)
+#define CARD_SUMMARY_CARDS_PER_SLOT (CARD_SUMMARY_GROUP_SIZE * CARD_SUMMARY_BITS_IN_SLOT)
+
 /**
  * @todo Provide class documentation
  * @warn All card table functions assume EXCLUSIVE ranges, ie they take a base and top card where base card
@@ -62,7 +72,8 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
-
+	volatile uintptr_t *_summaryTable; /**< One bit per CARD_SUMMARY_GROUP_SIZE cards, NULL unless -Xgc:cardTableSummary */
+	uintptr_t _summaryTableSize; /**< Size of _summaryTable in bytes */
 
 public:
 
@@ -84,6 +95,67 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * The summary bit of a group is set whenever a card of the group is dirtied through this class, and is only
+	 * cleared with the cards of the whole group by clearCardsInRange(), so a clear bit means every card of the
+	 * group is clean. Write barriers storing into the card table inline (rather than calling dirtyCard()) must
+	 * call summarizeCard() after the store for -Xgc:cardTableSummary to be used.
+	 * @return true if the card table is summarized
+	 */
+	MMINLINE bool isSummaryEnabled() { return NULL != _summaryTable; }
+
+	/**
+	 * Set the summary bit of the group of a card just dirtied.
+	 * @param[in] card The card dirtied
+	 */
+	MMINLINE void summarizeCard(Card *card)
+	{
+		if (NULL != _summaryTable) {
+			uintptr_t group = getSummaryGroupIndex(card);
+			volatile uintptr_t *slot = &_summaryTable[group / CARD_SUMMARY_BITS_IN_SLOT];
+			uintptr_t bit = (uintptr_t)1 << (group % CARD_SUMMARY_BITS_IN_SLOT);
+			/* bits stay set until the cards of the group are cleared, so the check avoids most atomics */
+			if (0 == (*slot & bit)) {
+				MM_AtomicOperations::bitOr(slot, bit);
+			}
+		}
+	}
+
+	/**
+	 * @param[in] card Any card of the group
+	 * @return true if a card of the group may be dirty, always true if the card table is not summarized
+	 */
+	MMINLINE bool isCardGroupSummarized(Card *card)
+	{
+		bool summarized = true;
+		if (NULL != _summaryTable) {
+			uintptr_t group = getSummaryGroupIndex(card);
+			summarized = (0 != (_summaryTable[group / CARD_SUMMARY_BITS_IN_SLOT] & ((uintptr_t)1 << (group % CARD_SUMMARY_BITS_IN_SLOT))));
+		}
+		return summarized;
+	}
+
+	/**
+	 * @param[in] card Any card of the CARD_SUMMARY_CARDS_PER_SLOT cards summarized by the slot
+	 * @return The summary slot of the card, zero if none of its groups may hold a dirty card
+	 */
+	MMINLINE uintptr_t getSummarySlot(Card *card)
+	{
+		return _summaryTable[getSummaryGroupIndex(card) / CARD_SUMMARY_BITS_IN_SLOT];
+	}
+
+	MMINLINE uintptr_t getSummaryGroupIndex(Card *card)
+	{
+		return ((uintptr_t)(card - _cardTableStart)) >> CARD_SUMMARY_GROUP_SHIFT;
+	}
+
+	/**
+	 * Set the summary bits of the groups of a range of cards just dirtied.
+	 * @param[in] firstCard First card of the range
+	 * @param[in] topCard Card after the last card of the range
+	 */
+	void summarizeCardRange(Card *firstCard, Card *topCard);
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -268,12 +340,15 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _summaryTable(NULL)
+		, _summaryTableSize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
 
 private:
 	void cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high);
+	void clearSummaryForRange(Card *firstCard, Card *topCard);
 };
 
 #endif /* CARDTABLE_HPP_ */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include <string.h>
+
+#include "CompactCardTable.hpp"
+#include "Forge.hpp"
+
+MM_CompactCardTable *
+MM_CompactCardTable::newInstance(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
+{
+	MM_CompactCardTable *cardTable = (MM_CompactCardTable *)env->getForge()->allocate(sizeof(MM_CompactCardTable), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cardTable) {
+		new(cardTable) MM_CompactCardTable();
+		if (!cardTable->initialize(env, heapBase, heapTop)) {
+			cardTable->kill(env);
+			cardTable = NULL;
+		}
+	}
+	return cardTable;
+}
+
+void
+MM_CompactCardTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_CompactCardTable::initialize(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
+{
+	_heapBase = (uintptr_t)heapBase;
+	_heapSize = (uintptr_t)heapTop - _heapBase;
+	if (0 == _heapSize) {
+		return false;
+	}
+
+	/* the smallest power of two sector size that covers the heap with COMPACT_CARD_SECTOR_COUNT sectors */
+	while (((_heapSize - 1) >> _sectorShift) >= COMPACT_CARD_SECTOR_COUNT) {
+		_sectorShift += 1;
+	}
+
+	_cardCount = ((_heapSize - 1) >> COMPACT_CARD_SIZE_SHIFT) + 1;
+	_cards = (volatile uintptr_t *)env->getForge()->allocate(_cardCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+	clear(env);
+
+	return true;
+}
+
+void
+MM_CompactCardTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _cards) {
+		env->getForge()->free((void *)_cards);
+		_cards = NULL;
+	}
+}
+
+void
+MM_CompactCardTable::clear(MM_EnvironmentBase *env)
+{
+	memset((void *)_cards, 0, _cardCount * sizeof(uintptr_t));
+	_valid = false;
+}
+
+uintptr_t
+MM_CompactCardTable::getSectorMask(void *low, void *high) const
+{
+	uintptr_t mask = 0;
+	if (low < high) {
+		uintptr_t lowSector = ((uintptr_t)low - _heapBase) >> _sectorShift;
+		uintptr_t highSector = ((uintptr_t)high - 1 - _heapBase) >> _sectorShift;
+		for (uintptr_t sector = lowSector; sector <= highSector; sector++) {
+			mask |= (uintptr_t)1 << sector;
+		}
+	}
+	return mask;
+}
+
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
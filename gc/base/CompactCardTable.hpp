@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(COMPACTCARDTABLE_HPP_)
+#define COMPACTCARDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+/* log2 of the heap bytes summarized by one card */
+#define COMPACT_CARD_SIZE_SHIFT 12
+/* Heap sectors a card can tell apart, one per bit of a card */
+#define COMPACT_CARD_SECTOR_COUNT (sizeof(uintptr_t) * 8)
+
+/**
+ * Summary of the references held by the heap, used by partial compaction to find the objects that may refer
+ * to the sub areas it evacuates without walking the whole heap.
+ *
+ * The heap is divided in COMPACT_CARD_SECTOR_COUNT sectors of equal (power of two) size, and every card holds
+ * one bit per sector, set if an object starting in the card referred to the sector when it was last scanned.
+ * Cards are recorded by the marking scheme while it scans objects, so they only describe the heap once a
+ * mark has scanned every live object with no mutator running: see setValid().
+ * @ingroup GC_Base
+ */
+class MM_CompactCardTable : public MM_BaseNonVirtual
+{
+/* Data members */
+private:
+	volatile uintptr_t *_cards; /**< One sector mask per card of the heap */
+	uintptr_t _cardCount; /**< Number of entries in _cards */
+	uintptr_t _heapBase; /**< Lowest address summarized */
+	uintptr_t _heapSize; /**< Bytes summarized, from _heapBase */
+	uintptr_t _sectorShift; /**< log2 of the heap bytes in a sector */
+	bool _valid; /**< True if the cards describe every live object of the heap */
+
+/* Methods */
+protected:
+	bool initialize(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_CompactCardTable *newInstance(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Clear every card, before a mark which records all of them again.
+	 */
+	void clear(MM_EnvironmentBase *env);
+
+	/**
+	 * @param address[in] any address
+	 * @return the bit of the sector holding address, or 0 if the address is not in the heap
+	 */
+	MMINLINE uintptr_t
+	getSectorBit(void *address) const
+	{
+		uintptr_t heapOffset = (uintptr_t)address - _heapBase;
+		/* NULL and addresses below the heap wrap around to large offsets */
+		return (heapOffset < _heapSize) ? ((uintptr_t)1 << (heapOffset >> _sectorShift)) : 0;
+	}
+
+	/**
+	 * @return the bits of every sector overlapping [low, high)
+	 */
+	uintptr_t getSectorMask(void *low, void *high) const;
+
+	/**
+	 * Record that an object referred to the given sectors. May be called by several threads concurrently.
+	 * @param objectPtr[in] the referring object
+	 * @param sectorBits[in] the sectors referred to, as returned by getSectorBit()
+	 */
+	MMINLINE void
+	recordReferences(omrobjectptr_t objectPtr, uintptr_t sectorBits)
+	{
+		volatile uintptr_t *card = &_cards[((uintptr_t)objectPtr - _heapBase) >> COMPACT_CARD_SIZE_SHIFT];
+		uintptr_t oldBits = *card;
+		/* most objects refer to sectors their card already refers to, which needs no store at all */
+		while (sectorBits != (oldBits & sectorBits)) {
+			uintptr_t bits = MM_AtomicOperations::lockCompareExchange(card, oldBits, oldBits | sectorBits);
+			if (bits == oldBits) {
+				break;
+			}
+			oldBits = bits;
+		}
+	}
+
+	/**
+	 * @return true if an object starting in the card of address may refer to one of the given sectors
+	 */
+	MMINLINE bool
+	isCardReferringTo(void *address, uintptr_t sectorMask) const
+	{
+		return 0 != (_cards[((uintptr_t)address - _heapBase) >> COMPACT_CARD_SIZE_SHIFT] & sectorMask);
+	}
+
+	/**
+	 * @return true if the table summarizes the heap of the current global collection
+	 */
+	MMINLINE bool isValid() const { return _valid; }
+
+	/**
+	 * Set whether the cards describe the current heap. Only a stop the world mark that scanned every live
+	 * object since the cards were cleared produces valid cards, since mutators do not update them.
+	 */
+	MMINLINE void setValid(bool valid) { _valid = valid; }
+
+	MM_CompactCardTable()
+		: MM_BaseNonVirtual()
+		, _cards(NULL)
+		, _cardCount(0)
+		, _heapBase(0)
+		, _heapSize(0)
+		, _sectorShift(0)
+		, _valid(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#endif /* COMPACTCARDTABLE_HPP_ */
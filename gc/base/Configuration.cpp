@@ -476,7 +476,12 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 	}
 	if (extensions->scavengerEnabled) {
 		if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering) {
-			extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+			if (extensions->learnHotFields) {
+				/* learned hot fields are copied next to their parents by the depth copying of dynamic breadth first ordering */
+				extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+			} else {
+				extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+			}
 		} else if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == extensions->scavengerScanOrdering) {
 			extensions->adaptiveGcCountBetweenHotFieldSort = true;
 		}
@@ -500,7 +505,14 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 bool
 MM_Configuration::initializeNUMAManager(MM_EnvironmentBase* env)
 {
-	return env->getExtensions()->_numaManager.recacheNUMASupport(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* binding GC workers to nodes requires the physical node layout, unless NUMA was explicitly forced on or off */
+	if (extensions->numaAwareGCWorkers && !extensions->numaForced) {
+		extensions->_numaManager.shouldEnablePhysicalNUMA(true);
+	}
+
+	return extensions->_numaManager.recacheNUMASupport(env);
 }
 
 MM_ParallelDispatcher *
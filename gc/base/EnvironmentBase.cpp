@@ -33,6 +33,7 @@
 #include "AllocateDescription.hpp"
 #include "Collector.hpp"
 #include "ConcurrentGCStats.hpp"
+#include "FreeChunkCache.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
@@ -112,6 +113,13 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
+	if (extensions->freeChunkCache) {
+		_freeChunkCache = MM_FreeChunkCache::newInstance(this);
+		if (NULL == _freeChunkCache) {
+			return false;
+		}
+	}
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	if (extensions->isSegregatedHeap()) {
 		_regionWorkList = MM_RegionPoolSegregated::allocateHeapRegionQueue(this, MM_HeapRegionList::HRL_KIND_LOCAL_WORK, true, false, false);
@@ -135,6 +143,11 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 void
 MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _freeChunkCache) {
+		_freeChunkCache->kill(this);
+		_freeChunkCache = NULL;
+	}
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	if (_regionWorkList != NULL) {
 		_regionWorkList->kill(this);
@@ -46,9 +46,11 @@
 class MM_AllocationContext;
 class MM_AllocateDescription;
 class MM_Collector;
+class MM_FreeChunkCache;
 class MM_HeapRegionQueue;
 class MM_MemorySpace;
 class MM_ObjectAllocationInterface;
+class MM_Packet;
 class MM_SegregatedAllocationTracker;
 class MM_Task;
 class MM_Validator;
@@ -160,13 +162,28 @@ public:
 
 	const char * _lastSyncPointReached; /**< string indicating latest sync point reached by this associated env's thread */
 
+	MM_FreeChunkCache *_freeChunkCache; /**< Free chunks for the allocations of this thread that miss the TLH, NULL unless -Xgc:freeChunkCache is enabled */
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
+#if defined(OMR_GC_REALTIME)
+	/* SATB barrier packets pooled by this thread, all on the in use barrier list, see MM_RememberedSetSATB::refreshFragment() */
+	MM_Packet *_sATBSparePackets[SATB_BARRIER_PACKETS_MAXIMUM]; /**< Empty packets for the next fragments of this thread */
+	uintptr_t _sATBSparePacketCount;
+	MM_Packet *_sATBFullPackets[SATB_BARRIER_PACKETS_MAXIMUM]; /**< Filled packets not yet handed to the full list */
+	uintptr_t _sATBFullPacketCount;
+	uintptr_t _sATBPacketFragmentIndex; /**< Global fragment index the pooled packets were taken under */
+#endif /* OMR_GC_REALTIME */
+
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
 
 	MM_CardCleaningStats _cardCleaningStats; /**< Per thread stats to track the performance of the card cleaning */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	Card *_cardCleaningPartitionNext; /**< Next card to look at in the final card cleaning partition claimed by this thread */
+	Card *_cardCleaningPartitionTop; /**< Card after the last card of the final card cleaning partition claimed by this thread */
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	MM_SweepStats _sweepStats;
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -736,9 +753,19 @@ public:
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
+		,_freeChunkCache(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_REALTIME)
+		,_sATBSparePacketCount(0)
+		,_sATBFullPacketCount(0)
+		,_sATBPacketFragmentIndex(0)
+#endif /* OMR_GC_REALTIME */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_cardCleaningPartitionNext(NULL)
+		,_cardCleaningPartitionTop(NULL)
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -793,9 +820,19 @@ public:
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
+		,_freeChunkCache(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_REALTIME)
+		,_sATBSparePacketCount(0)
+		,_sATBFullPacketCount(0)
+		,_sATBPacketFragmentIndex(0)
+#endif /* OMR_GC_REALTIME */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_cardCleaningPartitionNext(NULL)
+		,_cardCleaningPartitionTop(NULL)
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+#include "FreeChunkCache.hpp"
+
+MM_FreeChunkCache *
+MM_FreeChunkCache::newInstance(MM_EnvironmentBase *env)
+{
+	MM_FreeChunkCache *cache = (MM_FreeChunkCache *)env->getForge()->allocate(sizeof(MM_FreeChunkCache), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cache) {
+		new(cache) MM_FreeChunkCache(env);
+		if (!cache->initialize(env)) {
+			cache->kill(env);
+			cache = NULL;
+		}
+	}
+	return cache;
+}
+
+void
+MM_FreeChunkCache::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_FreeChunkCache::initialize(MM_EnvironmentBase *env)
+{
+	_compressObjectReferences = env->compressObjectReferences();
+	for (uintptr_t bin = 0; bin < FREE_CHUNK_CACHE_BINS; bin++) {
+		_chunkCount[bin] = 0;
+	}
+	return true;
+}
+
+void
+MM_FreeChunkCache::tearDown(MM_EnvironmentBase *env)
+{
+	flush(env);
+}
+
+uintptr_t
+MM_FreeChunkCache::getRefillSize(MM_EnvironmentBase *env, uintptr_t sizeInBytes) const
+{
+	uintptr_t classSize = getClassSize(sizeInBytes);
+	/* a batch is no larger than the largest TLH, unless a single chunk is */
+	uintptr_t refillSize = classSize * FREE_CHUNK_CACHE_REFILL_CHUNKS;
+	uintptr_t maximumRefillSize = OMR_MAX(env->getExtensions()->tlhMaximumSize, classSize);
+	return OMR_MIN(refillSize, maximumRefillSize);
+}
+
+void *
+MM_FreeChunkCache::allocate(MM_EnvironmentBase *env, uintptr_t sizeInBytes)
+{
+	if (0 == _cachedBytes) {
+		return NULL;
+	}
+
+	/* only some chunks of the bin of the allocation are large enough, any chunk of a larger bin is */
+	uintptr_t bin = getBin(OMR_MAX(sizeInBytes, (uintptr_t)1 << FREE_CHUNK_CACHE_SMALLEST_LOG));
+	for (uintptr_t i = 0; i < _chunkCount[bin]; i++) {
+		Chunk chunk = _chunks[bin][i];
+		if (chunk.size >= sizeInBytes) {
+			_chunkCount[bin] -= 1;
+			_chunks[bin][i] = _chunks[bin][_chunkCount[bin]];
+			return carve(chunk.base, chunk.size, sizeInBytes);
+		}
+	}
+	for (bin += 1; bin < FREE_CHUNK_CACHE_BINS; bin++) {
+		if (0 != _chunkCount[bin]) {
+			_chunkCount[bin] -= 1;
+			Chunk chunk = _chunks[bin][_chunkCount[bin]];
+			return carve(chunk.base, chunk.size, sizeInBytes);
+		}
+	}
+	return NULL;
+}
+
+void *
+MM_FreeChunkCache::refill(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t sizeInBytes, void *batchBase, void *batchTop)
+{
+	uintptr_t batchSize = (uintptr_t)batchTop - (uintptr_t)batchBase;
+	void *result = NULL;
+
+	if (NULL == _memoryPool) {
+		_memoryPool = memoryPool;
+	}
+
+	uint8_t *cursor = (uint8_t *)batchBase;
+	if (batchSize >= sizeInBytes) {
+		result = batchBase;
+		cursor += sizeInBytes;
+	}
+
+	/* split the rest into chunks of the allocation's size class, the last taking what is left over */
+	uintptr_t chunkSize = getClassSize(sizeInBytes);
+	while (cursor < (uint8_t *)batchTop) {
+		uintptr_t remainingSize = (uintptr_t)batchTop - (uintptr_t)cursor;
+		uintptr_t size = (remainingSize >= (2 * chunkSize)) ? chunkSize : remainingSize;
+		cacheChunk(cursor, size);
+		cursor += size;
+	}
+
+	return result;
+}
+
+void
+MM_FreeChunkCache::flush(MM_EnvironmentBase *env)
+{
+	for (uintptr_t bin = 0; bin < FREE_CHUNK_CACHE_BINS; bin++) {
+		_chunkCount[bin] = 0;
+	}
+	_cachedBytes = 0;
+	_memoryPool = NULL;
+}
+
+void
+MM_FreeChunkCache::cacheChunk(void *base, uintptr_t sizeInBytes)
+{
+	MM_HeapLinkedFreeHeader::fillWithHoles(base, sizeInBytes, _compressObjectReferences);
+	if (sizeInBytes >= ((uintptr_t)1 << FREE_CHUNK_CACHE_SMALLEST_LOG)) {
+		uintptr_t bin = getBin(sizeInBytes);
+		if (_chunkCount[bin] < FREE_CHUNK_CACHE_BIN_CAPACITY) {
+			_chunks[bin][_chunkCount[bin]].base = base;
+			_chunks[bin][_chunkCount[bin]].size = sizeInBytes;
+			_chunkCount[bin] += 1;
+			_cachedBytes += sizeInBytes;
+		}
+	}
+}
+
+void *
+MM_FreeChunkCache::carve(void *base, uintptr_t chunkSize, uintptr_t sizeInBytes)
+{
+	_cachedBytes -= chunkSize;
+	if (chunkSize > sizeInBytes) {
+		cacheChunk((void *)((uintptr_t)base + sizeInBytes), chunkSize - sizeInBytes);
+	}
+	return base;
+}
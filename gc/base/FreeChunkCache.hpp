@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREECHUNKCACHE_HPP_)
+#define FREECHUNKCACHE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_MemoryPool;
+
+/* Chunks of bin i are 2^(FREE_CHUNK_CACHE_SMALLEST_LOG + i) to 2^(FREE_CHUNK_CACHE_SMALLEST_LOG + i + 1) - 1 bytes */
+#define FREE_CHUNK_CACHE_SMALLEST_LOG 9
+#define FREE_CHUNK_CACHE_BINS 7
+/* Chunks cached per bin */
+#define FREE_CHUNK_CACHE_BIN_CAPACITY 8
+/* Chunks of an allocation's bin taken from the pool at once */
+#define FREE_CHUNK_CACHE_REFILL_CHUNKS 8
+
+/**
+ * A per thread cache of free chunks taken from a MM_MemoryPoolAddressOrderedList, in front of the pool lock,
+ * enabled by -Xgc:freeChunkCache.
+ *
+ * Allocations that miss the TLH, up to the smallest size of the largest bin, are carved from a cached chunk
+ * at least as large, the rest of which goes back to the bin of its size. When no chunk is large enough, the
+ * pool hands out a batch for FREE_CHUNK_CACHE_REFILL_CHUNKS allocations of the request's power of two size
+ * class in one lock acquisition, as for a TLH, which is split into chunks of that size.
+ *
+ * Cached chunks are allocated memory as far as the pool is concerned, and are kept formatted as holes so the
+ * heap stays walkable. Like TLHs, they are dropped when caches are flushed for a collection or a heap walk and
+ * their memory returns to the pool with the next sweep.
+ */
+class MM_FreeChunkCache : public MM_BaseVirtual
+{
+/* Data members & types */
+public:
+protected:
+private:
+	struct Chunk {
+		void *base;
+		uintptr_t size;
+	};
+
+	Chunk _chunks[FREE_CHUNK_CACHE_BINS][FREE_CHUNK_CACHE_BIN_CAPACITY]; /**< Cached chunks of each bin */
+	uintptr_t _chunkCount[FREE_CHUNK_CACHE_BINS]; /**< Chunks cached in each bin */
+	uintptr_t _cachedBytes; /**< Bytes of all cached chunks */
+	MM_MemoryPool *_memoryPool; /**< Pool the chunks were taken from, NULL while the cache is empty */
+	bool _compressObjectReferences; /**< Whether holes are formatted with compressed references */
+
+/* Methods */
+public:
+	static MM_FreeChunkCache *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the largest allocation the cache serves
+	 */
+	MMINLINE static uintptr_t getMaximumAllocationSize() { return (uintptr_t)1 << (FREE_CHUNK_CACHE_SMALLEST_LOG + FREE_CHUNK_CACHE_BINS - 1); }
+
+	/**
+	 * @return true if an allocation of sizeInBytes from memoryPool may use the cache: chunks of a different pool
+	 * may be cached only until the next flush
+	 */
+	MMINLINE bool
+	canCache(MM_MemoryPool *memoryPool, uintptr_t sizeInBytes) const
+	{
+		return (sizeInBytes <= getMaximumAllocationSize()) && ((memoryPool == _memoryPool) || (NULL == _memoryPool));
+	}
+
+	/**
+	 * @return the bytes to ask the pool for when no cached chunk can satisfy an allocation of sizeInBytes
+	 */
+	uintptr_t getRefillSize(MM_EnvironmentBase *env, uintptr_t sizeInBytes) const;
+
+	/**
+	 * Carve an allocation from a cached chunk.
+	 * @return the allocated memory, or NULL if no cached chunk is large enough
+	 */
+	void *allocate(MM_EnvironmentBase *env, uintptr_t sizeInBytes);
+
+	/**
+	 * Cache a batch of memory the pool handed out for getRefillSize(), and carve the allocation from it.
+	 * @param memoryPool[in] the pool the batch was taken from
+	 * @param sizeInBytes[in] the size of the allocation
+	 * @param batchBase[in] the first byte of the batch
+	 * @param batchTop[in] the first byte after the batch
+	 * @return the allocated memory, or NULL if the pool had less than sizeInBytes at hand
+	 */
+	void *refill(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t sizeInBytes, void *batchBase, void *batchTop);
+
+	/**
+	 * Drop all cached chunks, which are holes already. Called with exclusive access, or by the owning thread.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getCachedBytes() const { return _cachedBytes; }
+
+	MM_FreeChunkCache(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _cachedBytes(0)
+		, _memoryPool(NULL)
+		, _compressObjectReferences(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * @return the bin of the chunks of sizeInBytes, which must be at least 2^FREE_CHUNK_CACHE_SMALLEST_LOG bytes
+	 */
+	MMINLINE static uintptr_t
+	getBin(uintptr_t sizeInBytes)
+	{
+		uintptr_t bin = 0;
+		sizeInBytes >>= (FREE_CHUNK_CACHE_SMALLEST_LOG + 1);
+		while ((0 != sizeInBytes) && (bin < (FREE_CHUNK_CACHE_BINS - 1))) {
+			sizeInBytes >>= 1;
+			bin += 1;
+		}
+		return bin;
+	}
+
+	/**
+	 * @return the power of two size of the chunks a refill for an allocation of sizeInBytes is split into
+	 */
+	MMINLINE static uintptr_t
+	getClassSize(uintptr_t sizeInBytes)
+	{
+		uintptr_t classSize = (uintptr_t)1 << FREE_CHUNK_CACHE_SMALLEST_LOG;
+		while (classSize < sizeInBytes) {
+			classSize <<= 1;
+		}
+		return classSize;
+	}
+
+	/**
+	 * Format [base, base + sizeInBytes) as a hole and cache it, unless it is too small or its bin is full.
+	 */
+	void cacheChunk(void *base, uintptr_t sizeInBytes);
+
+	/**
+	 * Take sizeInBytes from the start of a chunk removed from the cache, caching the rest.
+	 */
+	void *carve(void *base, uintptr_t chunkSize, uintptr_t sizeInBytes);
+};
+
+#endif /* FREECHUNKCACHE_HPP_ */
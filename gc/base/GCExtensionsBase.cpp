@@ -30,9 +30,11 @@
 
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
+#include "HeapMapScanner.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
+#include "TLHZeroing.hpp"
 
 #if defined(OMR_GC_REALTIME)
 #include "Configuration.hpp"
@@ -120,6 +122,9 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	 */
 	usablePhysicalMemory = omrsysinfo_get_addressable_physical_memory();
 
+	/* Mark map scanning kernels depend on the processor only, pick one before any heap map is walked */
+	MM_HeapMapScanner::selectKernel(env->getPortLibrary());
+
 	computeDefaultMaxHeap(env);
 
 	maxSizeDefaultMemorySpace = memoryMax;
@@ -261,6 +266,25 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 		_lightweightNonReentrantLockPoolMutex = (omrthread_monitor_t) NULL;
 	}
 
+	if (NULL != sizeClassHistogramFileName) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrmem_free_memory(sizeClassHistogramFileName);
+		sizeClassHistogramFileName = NULL;
+	}
+
+	if (NULL != sizeClassTableFileName) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrmem_free_memory(sizeClassTableFileName);
+		sizeClassTableFileName = NULL;
+	}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != tlhZeroing) {
+		tlhZeroing->kill(env);
+		tlhZeroing = NULL;
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	_forge.tearDown();
 
 	J9HookInterface** tmpHookInterface = getPrivateHookInterface();
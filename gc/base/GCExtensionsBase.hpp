@@ -60,6 +60,9 @@ class MM_GlobalCollector;
 class MM_Heap;
 class MM_HeapMap;
 class MM_HeapRegionManager;
+class MM_HotFieldProfiler;
+class MM_PretenureProfiler;
+class MM_RememberedSetSummary;
 
 class MM_InterRegionRememberedSet;
 class MM_MemoryManager;
@@ -80,6 +83,7 @@ class MM_SweepHeapSectioning;
 class MM_SweepPoolManager;
 class MM_SweepPoolManagerAddressOrderedList;
 class MM_SweepPoolManagerAddressOrderedListBase;
+class MM_TLHZeroing;
 class MM_RealtimeGC;
 class MM_VerboseManagerBase;
 struct J9Pool;
@@ -105,6 +109,15 @@ class HeapRegionStateTable;
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* The largest number of slots the Scavenger collects (and prefetches the referents of) before forwarding them. */
+#define MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE 32
+
+/* The largest number of hot fields the Scavenger learns for a class of objects. */
+#define MAXIMUM_LEARNED_HOT_FIELD_COUNT 3
+
+/* The largest number of SATB barrier packets a thread takes, or hands off, at once. */
+#define SATB_BARRIER_PACKETS_MAXIMUM 16
+
 #define NO_ESTIMATE_FRAGMENTATION 			0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 		0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 	0x2
@@ -213,6 +226,7 @@ private:
 	void* _guaranteedNurseryEnd; /**< highest address guaranteed to be in the nursery */
 
 	bool _isRememberedSetInOverflow;
+	bool _isRememberedSetOverflowSummarized; /**< set if every remembered object missing from the list while in overflow is in the Scavenger remembered set summary */
 
 	volatile BackOutState _backOutState; /**< set if a thread is unable to copy an object due to lack of free space in both Survivor and Tenure */
 	volatile bool _concurrentGlobalGCInProgress; /**< set to true if concurrent Global GC is in progress */
@@ -249,6 +263,9 @@ public:
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_Scavenger *scavenger;
+	MM_HotFieldProfiler *hotFieldProfiler; /**< hot fields learned by the Scavenger, NULL unless -Xgc:learnHotFields */
+	MM_RememberedSetSummary *rememberedSetSummary; /**< remembered objects the Scavenger summarized instead of listing, NULL unless -Xgc:rememberedSetSummaryThreshold= */
+	MM_PretenureProfiler *pretenureProfiler; /**< survival of allocation sites and the sites allocated in tenure space, NULL unless -Xgc:pretenureSurvivalThreshold= */
 	void *_mainThreadTenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that will be loaded to thread env during main setup */
 	void *_mainThreadTenureTLHRemainderTop;
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -295,6 +312,9 @@ public:
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_REALTIME)
 	MM_RememberedSetSATB* sATBBarrierRememberedSet; /**< The snapshot at the beginning barrier remembered set used for the write barrier */
+	uintptr_t sATBBarrierPackets; /**< Empty barrier packets a thread takes at once for its fragment, set with -Xgc:sATBBarrierPackets= */
+	uintptr_t sATBBarrierFlushBatch; /**< Filled barrier packets a thread hands to the full list at once, set with -Xgc:sATBBarrierFlushBatch= */
+	bool sATBBarrierFilter; /**< Drop NULL and already marked entries of filled barrier packets, set with -Xgc:sATBBarrierFilter */
 #endif /* defined(OMR_GC_REALTIME) */
 	ModronLnrlOptions lnrlOptions;
 
@@ -348,6 +368,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool adaptiveTLHSizing; /**< Enabled by -Xgc:adaptiveTLHSizing.  TLH refresh sizes follow each thread's allocation rate, up to a share of the nursery left by survivors */
+	bool verboseTLHStats; /**< Enabled by -Xgc:verboseTLHStats.  allocation-stats reports the TLH refreshes of every thread */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -387,6 +409,9 @@ public:
 	float pageFragmentationCompactThreshold; /**< Enables compaction when page-fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
 
 	uintptr_t parSweepChunkSize;
+	bool lazySweep; /**< Enabled by -Xgc:lazySweep.  Tenure pools are swept a chunk at a time when allocations miss, instead of in the global collection */
+	bool freeChunkCache; /**< Enabled by -Xgc:freeChunkCache.  Non-TLH allocations from address ordered list pools are carved from per thread caches of free chunks, see MM_FreeChunkCache */
+	bool allocationLatencyStats; /**< Enabled by -Xgc:allocationLatencyStats.  Non-TLH allocations from address ordered list pools are timed, for the percentiles of allocation-stats */
 	uintptr_t heapExpansionMinimumSize;
 	uintptr_t heapExpansionMaximumSize;
 	uintptr_t heapFreeMinimumRatioDivisor;
@@ -406,6 +431,7 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealingMarking; /**< Enabled by -Xgc:workStealing.  Full mark work packets are queued on per-thread work stealing deques instead of the shared packet lists */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -458,12 +484,26 @@ public:
 
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 	uintptr_t batchClearTLH;
+	enum TLHZeroingStrategy {
+		OMR_GC_TLH_ZEROING_DEFAULT = 0, /**< OMRZeroMemory */
+		OMR_GC_TLH_ZEROING_NON_TEMPORAL, /**< Streaming stores that bypass the cache */
+		OMR_GC_TLH_ZEROING_REP_STOSB /**< rep stosb, for processors with enhanced rep movsb/stosb */
+	};
+	TLHZeroingStrategy tlhZeroingStrategy; /**< Set by -Xgc:tlhZeroing=, how batch cleared TLHs of at least tlhZeroingThreshold bytes are zeroed */
+	uintptr_t tlhZeroingThreshold; /**< Set by -Xgc:tlhZeroingThreshold=, smaller TLHs are zeroed with OMRZeroMemory and never in the background */
+	bool backgroundTLHZeroing; /**< Enabled by -Xgc:backgroundTLHZeroing.  Batch cleared TLHs are zeroed ahead of demand by a background thread */
+	MM_TLHZeroing *tlhZeroing; /**< The background zeroing thread, with -Xgc:backgroundTLHZeroing */
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	omrthread_monitor_t gcStatsMutex;
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	bool adaptiveTaskThreading; /**< Enabled by -Xgc:adaptiveTaskThreads.  The dispatcher picks the thread count of scavenge, mark, sweep and compact tasks from their measured parallel efficiency (ignored if the GC thread count is forced) */
+	float adaptiveTaskThreadingSensitivityFactor; /**< Stall sensitivity of the adaptive task threading model, higher values tolerate less stall */
+	float adaptiveTaskThreadingWeight; /**< Weight given to the current thread count (and to history for the averaged times) when folding in a new measurement */
+	bool gcThreadSyncBarrier; /**< Enabled by -Xgc:spinParkBarrier.  GC threads of a parallel task synchronize on a spin-then-park barrier rather than on the dispatcher's synchronize monitor */
+	uintptr_t gcThreadSyncBarrierSpinCount; /**< Iterations a thread spins at a synchronization barrier before it parks (-Xgc:syncBarrierSpinCount=) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -487,6 +527,9 @@ public:
 	uintptr_t depthCopyMax;
 	uint32_t maxHotFieldListLength;
 	uintptr_t minCpuUtil;
+	bool learnHotFields; /**< the Scavenger learns the hot fields of classes the glue reports none for by sampling the slots it scans (-Xgc:learnHotFields) */
+	uintptr_t learnedHotFieldCount; /**< the number of hot fields learned per class, at most MAXIMUM_LEARNED_HOT_FIELD_COUNT (-Xgc:learnedHotFieldCount=) */
+	uintptr_t hotFieldSampleRate; /**< one in this many scanned objects has its slots sampled when learning hot fields (-Xgc:hotFieldSampleRate=) */
 	/* End of options relating to dynamicBreadthFirstScanOrdering */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	uintptr_t scvTenureRatioHigh;
@@ -512,6 +555,7 @@ public:
 	uintptr_t concurrentScavengerSlack; /**< amount of bytes added on top of avearge allocated bytes during concurrent cycle, in calcualtion for survivor size */
 	float concurrentScavengerAllocDeviationBoost; /**< boost factor for allocate rate and its deviation, used for tilt calcuation in Concurrent Scavenger */
 	bool concurrentScavengeExhaustiveTermination; /**< control flag to enable/disable concurrent phase termination optimization using involing async mutator callbacks */
+	bool concurrentScavengerPageProtection; /**< CS without read barrier: copy destinations are page protected while mutators run and fixed up by a SIGSEGV handler, set by -Xgc:concurrentScavengePageProtection */
 #endif	/* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	uintptr_t scavengerFailedTenureThreshold;
 	uintptr_t maxScavengeBeforeGlobal;
@@ -519,6 +563,10 @@ public:
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	uintptr_t rememberedSetSummaryThreshold; /**< entries in the remembered set list past which the Scavenger summarizes remembered objects instead of listing them (-Xgc:rememberedSetSummaryThreshold=), 0 to never summarize */
+	uintptr_t pretenureSurvivalThreshold; /**< percentage of the allocations of a site that must be tenured by the Scavenger for the site to be allocated in tenure space (-Xgc:pretenureSurvivalThreshold=), 0 to never pretenure */
+	uintptr_t pretenureSampleRate; /**< one in this many allocations, and objects tenured, is sampled when profiling allocation sites (-Xgc:pretenureSampleRate=) */
+	uintptr_t scavengerPrefetchWindowSize; /**< number of slots the Scavenger collects, prefetching their referents, before forwarding them (-Xgc:scavengerPrefetchWindow=), 0 or 1 forwards each slot as it is found */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -585,6 +633,9 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool stripedCompaction; /**< slide live objects within each region, computing forwarding addresses per stripe from the mark map, and fix them up as they move */
+	bool partialCompaction; /**< only evacuate the most fragmented sub areas, fixing up the objects the mark found referring to them */
+	uintptr_t partialCompactionBudget; /**< most bytes of live objects a partial compaction selects for evacuation */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -598,6 +649,10 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentPacer; /**< Pace the concurrent kickoff threshold and allocation tax with feedback from past cycles, set with -Xgc:concurrentPacer */
+	uintptr_t concurrentPacerSlack; /**< Percentage of the free space at kickoff the concurrent pacer aims to leave when tracing completes */
+	bool concurrentBackgroundMark; /**< Mark on the concurrent helper threads, taxing mutators only when the helpers fall behind, set with -Xgc:concurrentBackgroundMark */
+	uintptr_t concurrentBackgroundCPUPercent; /**< Percentage of the online processors the concurrent helper threads may use together in -Xgc:concurrentBackgroundMark mode */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
@@ -621,6 +676,7 @@ public:
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
 	MM_CardTable* cardTable;
+	bool cardTableSummary; /**< Summarize the card table by groups of cards and clean concurrent cards in partitions, set with -Xgc:cardTableSummary */
 
 	/* Begin command line options temporary home */
 	uintptr_t memoryMax;
@@ -693,6 +749,9 @@ public:
 	uintptr_t traceCostToCheckYield; /**< tracing cost (in number of objects marked and pointers scanned) after we try to yield */
 	uintptr_t sweepCostToCheckYield; /**< weighted count of free chunks/marked objects before we check yield in sweep small loop */
 	uintptr_t splitAvailableListSplitAmount; /**< Number of split available lists per size class, per defragment bucket */
+	bool lockFreeRegionQueues; /**< Enabled by -Xgc:lockFreeRegionQueues.  Region queues shared by threads of the segregated heap are lock free instead of monitor protected */
+	char *sizeClassHistogramFileName; /**< Set by -Xgc:sizeClassHistogram=.  The segregated heap records the sizes of small allocations and writes their histogram to this file at shutdown */
+	char *sizeClassTableFileName; /**< Set by -Xgc:sizeClassTable=.  The segregated heap uses the cell sizes of this file instead of those of sizeclasses.h */
 	uint32_t newThreadAllocationColor;
 	uintptr_t minimumFreeEntrySize;
 	uintptr_t arrayletsPerRegion;
@@ -718,6 +777,8 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Format and write verbose:gc file output on a thread of its own */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  As asyncLogging, but write verbose:gc file output unformatted, to be decoded offline */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -752,6 +813,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaAwareGCWorkers; /**< Enabled by -Xgc:numaAffinity.  GC worker threads are bound to NUMA nodes and steal work from workers on their own node before crossing nodes */
 
 	bool padToPageSize;
 
@@ -956,6 +1018,16 @@ public:
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	}
 
+	MMINLINE bool
+	isConcurrentScavengerPageProtectionEnabled()
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		return concurrentScavenger && concurrentScavengerPageProtection;
+#else /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+		return false;
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	}
+
 	MMINLINE bool
 	isConcurrentScavengerHWSupported()
 	{
@@ -1155,14 +1227,41 @@ public:
 	{
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		_isRememberedSetInOverflow = true;
+		_isRememberedSetOverflowSummarized = false;
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	}
 
+	/**
+	 * Enter the overflow state because the Scavenger summarized a remembered object instead of listing it.
+	 * The overflow remains summarized unless it was already entered any other way.
+	 */
+	MMINLINE void
+	setScavengerRememberedSetSummarizedOverflowState()
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (!_isRememberedSetInOverflow) {
+			_isRememberedSetOverflowSummarized = true;
+			_isRememberedSetInOverflow = true;
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	}
+
+	MMINLINE bool
+	isScavengerRememberedSetOverflowSummarized()
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		return _isRememberedSetInOverflow && _isRememberedSetOverflowSummarized;
+#else /* defined(OMR_GC_MODRON_SCAVENGER) */
+		return false;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	}
+
 	MMINLINE void
 	clearScavengerRememberedSetOverflowState()
 	{
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		_isRememberedSetInOverflow = false;
+		_isRememberedSetOverflowSummarized = false;
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	}
 
@@ -1463,6 +1562,7 @@ public:
 		, _guaranteedNurseryStart(NULL)
 		, _guaranteedNurseryEnd(NULL)
 		, _isRememberedSetInOverflow(false)
+		, _isRememberedSetOverflowSummarized(false)
 		, _backOutState(backOutFlagCleared)
 		, _concurrentGlobalGCInProgress(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1487,6 +1587,9 @@ public:
 		, _tenureSize(0)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, scavenger(NULL)
+		, hotFieldProfiler(NULL)
+		, rememberedSetSummary(NULL)
+		, pretenureProfiler(NULL)
 		, _mainThreadTenureTLHRemainderBase(NULL)
 		, _mainThreadTenureTLHRemainderTop(NULL)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -1528,6 +1631,9 @@ public:
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_REALTIME)
 		, sATBBarrierRememberedSet(NULL)
+		, sATBBarrierPackets(1)
+		, sATBBarrierFlushBatch(1)
+		, sATBBarrierFilter(false)
 #endif /* defined(OMR_GC_REALTIME) */
 		, heapBaseForBarrierRange0(NULL)
 		, heapSizeForBarrierRange0(0)
@@ -1566,6 +1672,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, adaptiveTLHSizing(false)
+		, verboseTLHStats(false)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1593,6 +1701,9 @@ public:
 		, darkMatterCompactThreshold((float)0.15)
 		, pageFragmentationCompactThreshold((float)0.10)
 		, parSweepChunkSize(0)
+		, lazySweep(false)
+		, freeChunkCache(false)
+		, allocationLatencyStats(false)
 		, heapExpansionMinimumSize(1024 * 1024)
 		, heapExpansionMaximumSize(0)
 		, heapFreeMinimumRatioDivisor(100)
@@ -1608,6 +1719,7 @@ public:
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workStealingMarking(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1651,10 +1763,19 @@ public:
 		, softMx(0) /* softMx only set if specified */
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 		, batchClearTLH(0)
+		, tlhZeroingStrategy(OMR_GC_TLH_ZEROING_DEFAULT)
+		, tlhZeroingThreshold(64 * 1024)
+		, backgroundTLHZeroing(false)
+		, tlhZeroing(NULL)
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, adaptiveTaskThreading(false)
+		, adaptiveTaskThreadingSensitivityFactor(1.0f)
+		, adaptiveTaskThreadingWeight(0.5f)
+		, gcThreadSyncBarrier(false)
+		, gcThreadSyncBarrierSpinCount(1024)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1671,6 +1792,9 @@ public:
 		, depthCopyMax(3)
 		, maxHotFieldListLength(10)
 		, minCpuUtil (1)
+		, learnHotFields(false)
+		, learnedHotFieldCount(2)
+		, hotFieldSampleRate(16)
 		/* End of options relating to dynamicBreadthFirstScanOrdering */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -1697,6 +1821,7 @@ public:
 		, concurrentScavengerSlack(0)
 		, concurrentScavengerAllocDeviationBoost(2.0)
 		, concurrentScavengeExhaustiveTermination(true)
+		, concurrentScavengerPageProtection(false)
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		, scavengerFailedTenureThreshold(0)
 		, maxScavengeBeforeGlobal(0)
@@ -1704,6 +1829,10 @@ public:
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, rememberedSetSummaryThreshold(0)
+		, pretenureSurvivalThreshold(0)
+		, pretenureSampleRate(16)
+		, scavengerPrefetchWindowSize(0)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1753,6 +1882,9 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, stripedCompaction(false)
+		, partialCompaction(false)
+		, partialCompactionBudget(64 * 1024 * 1024)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1764,6 +1896,10 @@ public:
 		, concurrentLevel(8)
 		, concurrentBackground(1)
 		, concurrentSlack(0)
+		, concurrentPacer(false)
+		, concurrentPacerSlack(5)
+		, concurrentBackgroundMark(false)
+		, concurrentBackgroundCPUPercent(25)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
 		, fvtest_concurrentCardTablePreparationDelay(0)
@@ -1781,6 +1917,7 @@ public:
 		, checkpointGCthreadCount(4)
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 		, cardTable(NULL)
+		, cardTableSummary(false)
 		, memoryMax(0)
 		, initialMemorySize(0)
 		, minNewSpaceSize(0)
@@ -1834,6 +1971,9 @@ public:
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
 		, sweepCostToCheckYield(500) /* weighted count of free chunks/marked objects before we check yield in sweep small loop */
 		, splitAvailableListSplitAmount(0)
+		, lockFreeRegionQueues(false)
+		, sizeClassHistogramFileName(NULL)
+		, sizeClassTableFileName(NULL)
 		, newThreadAllocationColor(0)
 		, minimumFreeEntrySize((uintptr_t)-1) /* -1 => user did not override default minimumFreeEntrySize */
 		, arrayletsPerRegion(0)
@@ -1853,6 +1993,8 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1872,6 +2014,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaAwareGCWorkers(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMainThread(false)
 #if defined(OMR_GC_VLHGC)
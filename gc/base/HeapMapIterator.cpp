@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScanner.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -130,7 +131,14 @@ MM_HeapMapIterator::nextObject()
 		_heapMapSlotCurrent += 1;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+			/* Skip any run of empty slots in bulk, to the first slot with a bit set (or past the end of the range) */
+			uintptr_t heapMapSlotsLeft = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, _heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+			uintptr_t *heapMapSlotNext = MM_HeapMapScanner::findNonEmptyWord(_heapMapSlotCurrent, _heapMapSlotCurrent + heapMapSlotsLeft);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = heapMapSlotNext;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
 		}
 	}
 
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapMapScanner.hpp"
+
+#if defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS)
+#include <immintrin.h>
+#endif /* defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS) */
+
+static uintptr_t *
+findNonEmptyWordScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS)
+/* Every vector kernel tests whole blocks of the map and leaves it to the scalar kernel to find the
+ * non empty word in the first block that has one, and to test the words after the last whole block.
+ * Short runs do not amortize the vector setup, so the first few words are tested one at a time.
+ */
+#define HEAPMAP_SCAN_SCALAR_PROLOGUE_WORDS 4
+
+static MMINLINE bool
+findNonEmptyWordPrologue(uintptr_t * &current, uintptr_t *top)
+{
+	uintptr_t *prologueTop = ((uintptr_t)(top - current) > HEAPMAP_SCAN_SCALAR_PROLOGUE_WORDS) ? (current + HEAPMAP_SCAN_SCALAR_PROLOGUE_WORDS) : top;
+	while (current < prologueTop) {
+		if (0 != *current) {
+			return true;
+		}
+		current += 1;
+	}
+	return current == top;
+}
+
+__attribute__((target("sse2"))) static uintptr_t *
+findNonEmptyWordSSE2(uintptr_t *current, uintptr_t *top)
+{
+	if (findNonEmptyWordPrologue(current, top)) {
+		return current;
+	}
+	const uintptr_t wordsPerBlock = (4 * sizeof(__m128i)) / sizeof(uintptr_t);
+	const __m128i zero = _mm_setzero_si128();
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		const __m128i *block = (const __m128i *)current;
+		__m128i bits = _mm_or_si128(
+			_mm_or_si128(_mm_loadu_si128(block), _mm_loadu_si128(block + 1)),
+			_mm_or_si128(_mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3)));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+	return findNonEmptyWordScalar(current, top);
+}
+
+__attribute__((target("avx2"))) static uintptr_t *
+findNonEmptyWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	if (findNonEmptyWordPrologue(current, top)) {
+		return current;
+	}
+	const uintptr_t wordsPerBlock = (4 * sizeof(__m256i)) / sizeof(uintptr_t);
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		const __m256i *block = (const __m256i *)current;
+		__m256i bits = _mm256_or_si256(
+			_mm256_or_si256(_mm256_loadu_si256(block), _mm256_loadu_si256(block + 1)),
+			_mm256_or_si256(_mm256_loadu_si256(block + 2), _mm256_loadu_si256(block + 3)));
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+	return findNonEmptyWordScalar(current, top);
+}
+
+__attribute__((target("avx512f"))) static uintptr_t *
+findNonEmptyWordAVX512(uintptr_t *current, uintptr_t *top)
+{
+	if (findNonEmptyWordPrologue(current, top)) {
+		return current;
+	}
+	const uintptr_t wordsPerBlock = (4 * sizeof(__m512i)) / sizeof(uintptr_t);
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		const __m512i *block = (const __m512i *)current;
+		__m512i bits = _mm512_or_si512(
+			_mm512_or_si512(_mm512_loadu_si512(block), _mm512_loadu_si512(block + 1)),
+			_mm512_or_si512(_mm512_loadu_si512(block + 2), _mm512_loadu_si512(block + 3)));
+		if (0 != _mm512_test_epi64_mask(bits, bits)) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+	return findNonEmptyWordScalar(current, top);
+}
+
+/**
+ * @return the state components the operating system saves on context switches (XCR0), 0 if it cannot tell
+ */
+static uint64_t
+getEnabledStateComponents(OMRPortLibrary *portLibrary, OMRProcessorDesc *processorDescription)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t stateComponents = 0;
+	if (TRUE == omrsysinfo_processor_has_feature(processorDescription, OMR_FEATURE_X86_OSXSAVE)) {
+		uint32_t low = 0;
+		uint32_t high = 0;
+		__asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		stateComponents = ((uint64_t)high << 32) | low;
+	}
+	return stateComponents;
+}
+#endif /* defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS) */
+
+MM_HeapMapScanner::FindNonEmptyWordFunction MM_HeapMapScanner::_findNonEmptyWord = findNonEmptyWordScalar;
+MM_HeapMapScanner::Kernel MM_HeapMapScanner::_kernel = MM_HeapMapScanner::kernel_scalar;
+
+MM_HeapMapScanner::FindNonEmptyWordFunction
+MM_HeapMapScanner::getKernelFunction(Kernel kernel)
+{
+	FindNonEmptyWordFunction function = NULL;
+	switch (kernel) {
+	case kernel_scalar:
+		function = findNonEmptyWordScalar;
+		break;
+#if defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS)
+	case kernel_sse2:
+		function = findNonEmptyWordSSE2;
+		break;
+	case kernel_avx2:
+		function = findNonEmptyWordAVX2;
+		break;
+	case kernel_avx512:
+		function = findNonEmptyWordAVX512;
+		break;
+#endif /* defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS) */
+	default:
+		break;
+	}
+	return function;
+}
+
+const char *
+MM_HeapMapScanner::getKernelName(Kernel kernel)
+{
+	const char *name = "unknown";
+	switch (kernel) {
+	case kernel_scalar:
+		name = "scalar";
+		break;
+	case kernel_sse2:
+		name = "sse2";
+		break;
+	case kernel_avx2:
+		name = "avx2";
+		break;
+	case kernel_avx512:
+		name = "avx512";
+		break;
+	default:
+		break;
+	}
+	return name;
+}
+
+bool
+MM_HeapMapScanner::isKernelSupported(OMRPortLibrary *portLibrary, Kernel kernel)
+{
+	bool supported = false;
+	if (kernel_scalar == kernel) {
+		supported = true;
+	} else if (NULL != getKernelFunction(kernel)) {
+#if defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS)
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRProcessorDesc processorDescription;
+		if (0 == omrsysinfo_get_processor_description(&processorDescription)) {
+			/* the processor implementing an instruction set is not enough, the OS must also save the registers it uses */
+			uint64_t stateComponents = getEnabledStateComponents(portLibrary, &processorDescription);
+			const uint64_t ymmState = 0x6; /* XMM and upper halves of YMM */
+			const uint64_t zmmState = 0xE6; /* ymmState, opmask, upper halves of ZMM0-15 and ZMM16-31 */
+			switch (kernel) {
+			case kernel_sse2:
+				supported = (TRUE == omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_SSE2));
+				break;
+			case kernel_avx2:
+				supported = (TRUE == omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2))
+					&& (ymmState == (stateComponents & ymmState));
+				break;
+			case kernel_avx512:
+				supported = (TRUE == omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX512F))
+					&& (zmmState == (stateComponents & zmmState));
+				break;
+			default:
+				break;
+			}
+		}
+#endif /* defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS) */
+	}
+	return supported;
+}
+
+MM_HeapMapScanner::Kernel
+MM_HeapMapScanner::selectKernel(OMRPortLibrary *portLibrary)
+{
+	Kernel kernel = kernel_scalar;
+	for (intptr_t candidate = kernel_count - 1; candidate > kernel_scalar; candidate--) {
+		if (isKernelSupported(portLibrary, (Kernel)candidate)) {
+			kernel = (Kernel)candidate;
+			break;
+		}
+	}
+
+	/* every VM of the process selects the same kernel, so racing selections store the same values */
+	_findNonEmptyWord = getKernelFunction(kernel);
+	_kernel = kernel;
+	return kernel;
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCANNER_HPP_)
+#define HEAPMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronbase.h"
+
+/* Vector kernels rely on function level target attributes, so that the rest of the GC keeps its baseline ISA */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define OMR_GC_HEAPMAP_SCAN_X86_KERNELS
+#endif /* (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) */
+
+/**
+ * Skips runs of empty heap map words, which is most of the map of a sparse heap.
+ *
+ * The kernel is chosen once, by selectKernel(), from the features of the processor: on x86 the map is tested
+ * a cache line or more at a time with AVX-512, AVX2 or SSE2. Until then, and on other platforms, words are
+ * tested one at a time.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScanner
+{
+/* Data members */
+public:
+	enum Kernel {
+		kernel_scalar = 0,
+		kernel_sse2,
+		kernel_avx2,
+		kernel_avx512,
+		kernel_count
+	};
+
+	/**
+	 * @return the first non empty word in [current, top), or top if there is none
+	 */
+	typedef uintptr_t *(*FindNonEmptyWordFunction)(uintptr_t *current, uintptr_t *top);
+
+private:
+	static FindNonEmptyWordFunction _findNonEmptyWord; /**< The kernel in use */
+	static Kernel _kernel; /**< Identifies _findNonEmptyWord */
+
+/* Methods */
+public:
+	/**
+	 * Select the fastest kernel the processor (and operating system) supports. Idempotent.
+	 * @return the kernel selected
+	 */
+	static Kernel selectKernel(OMRPortLibrary *portLibrary);
+
+	/**
+	 * @return true if the kernel can run on this processor
+	 */
+	static bool isKernelSupported(OMRPortLibrary *portLibrary, Kernel kernel);
+
+	/**
+	 * @return the implementation of the kernel, or NULL if it was not built for this platform
+	 */
+	static FindNonEmptyWordFunction getKernelFunction(Kernel kernel);
+
+	static const char *getKernelName(Kernel kernel);
+
+	MMINLINE static Kernel getKernel() { return _kernel; }
+
+	/**
+	 * Find the first non empty heap map word in [current, top).
+	 * @note words are read without synchronization, in no particular order: bits set concurrently may be missed
+	 * @return the first non empty word, or top if there is none
+	 */
+	MMINLINE static uintptr_t *
+	findNonEmptyWord(uintptr_t *current, uintptr_t *top)
+	{
+		/* runs of a single empty word are common in densely populated heaps, test one word before paying for a call */
+		if ((current < top) && (0 == *current)) {
+			current = _findNonEmptyWord(current + 1, top);
+		}
+		return current;
+	}
+};
+
+#endif /* HEAPMAPSCANNER_HPP_ */
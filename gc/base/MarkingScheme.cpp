@@ -36,6 +36,7 @@
 #include "Heap.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
+#include "ParallelDispatcher.hpp"
 #include "Task.hpp"
 #if defined(OMR_GC_REALTIME)
 #include "WorkPacketsSATB.hpp"
@@ -216,6 +217,7 @@ MM_MarkingScheme::workerCleanupAfterGC(MM_EnvironmentBase *env)
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	_extensions->globalGCStats.markStats.merge(&env->_markStats);
 	_extensions->globalGCStats.workPacketStats.merge(&env->_workPacketStats);
+	_extensions->globalGCStats.numaWorkStats.merge(_extensions->dispatcher->getWorkerNUMANode(env->getWorkerID()), &env->_workPacketStats);
 #endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 }
 
@@ -299,6 +301,9 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	if (NULL != objectScanner) {
 		bool isLeafSlot = false;
 		GC_SlotObject *slotObject;
+#if defined(OMR_GC_MODRON_COMPACTION)
+		uintptr_t referencedSectors = 0;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_LEAF_BITS)
 		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
 #else /* OMR_GC_LEAF_BITS */
@@ -306,8 +311,19 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 #endif /* OMR_GC_LEAF_BITS */
 			fixupForwardedSlot(slotObject);
 
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+#if defined(OMR_GC_MODRON_COMPACTION)
+			if (NULL != _compactCardTable) {
+				referencedSectors |= _compactCardTable->getSectorBit(referent);
+			}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+			inlineMarkObjectNoCheck(env, referent, isLeafSlot);
+		}
+#if defined(OMR_GC_MODRON_COMPACTION)
+		if (0 != referencedSectors) {
+			_compactCardTable->recordReferences(objectPtr, referencedSectors);
 		}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 	}
 	return sizeToDo;
 }
@@ -395,7 +411,7 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 		if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
 #if defined(OMR_GC_REALTIME)
 			MM_WorkPacketsSATB *workPacketsSATB = MM_WorkPacketsSATB::newInstance(env);
-			_extensions->sATBBarrierRememberedSet = MM_RememberedSetSATB::newInstance(env, workPacketsSATB);
+			_extensions->sATBBarrierRememberedSet = MM_RememberedSetSATB::newInstance(env, workPacketsSATB, this);
 			workPackets = workPacketsSATB;
 #endif /* defined(OMR_GC_REALTIME) */
 		} else {
@@ -28,7 +28,7 @@
 #include "omrgcconsts.h"
 
 #include "BaseVirtual.hpp"
-
+#include "CompactCardTable.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "MarkingDelegate.hpp"
@@ -56,6 +56,9 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+#if defined(OMR_GC_MODRON_COMPACTION)
+	MM_CompactCardTable *_compactCardTable; /**< Summary of the references of scanned objects, for partial compaction */
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 public:
 
@@ -238,6 +241,9 @@ public:
 		if (NULL != objectScanner) {
 			bool isLeafSlot = false;
 			GC_SlotObject *slotObject;
+#if defined(OMR_GC_MODRON_COMPACTION)
+			uintptr_t referencedSectors = 0;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_LEAF_BITS)
 			while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
 #else /* OMR_GC_LEAF_BITS */
@@ -246,8 +252,19 @@ public:
 				fixupForwardedSlot(slotObject);
 
 				/* with concurrentMark mutator may NULL the slot so must fetch and check here */
-				inlineMarkObject(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+				omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+#if defined(OMR_GC_MODRON_COMPACTION)
+				if (NULL != _compactCardTable) {
+					referencedSectors |= _compactCardTable->getSectorBit(referent);
+				}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				inlineMarkObject(env, referent, isLeafSlot);
+			}
+#if defined(OMR_GC_MODRON_COMPACTION)
+			if (0 != referencedSectors) {
+				_compactCardTable->recordReferences(objectPtr, referencedSectors);
 			}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		}
 
 		/* Due to concurrent marking and packet overflow _bytesScanned may be much larger than the total live set
@@ -263,6 +280,14 @@ public:
 
 	MM_MarkingDelegate *getMarkingDelegate() { return &_delegate; }
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Set the card table scanned objects record their references in, NULL to record nothing.
+	 */
+	void setCompactCardTable(MM_CompactCardTable *compactCardTable) { _compactCardTable = compactCardTable; }
+	MM_CompactCardTable *getCompactCardTable() { return _compactCardTable; }
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
 	MM_MarkMap *getMarkMap() { return _markMap; }
 	void setMarkMap(MM_MarkMap *markMap) { _markMap = markMap; }
 	
@@ -312,6 +337,9 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+#if defined(OMR_GC_MODRON_COMPACTION)
+		, _compactCardTable(NULL)
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -107,6 +107,13 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	}
 #endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* the Concurrent Scavenger maps the heap a second time to copy into and scan page protected copy destinations */
+	if (extensions->isConcurrentScavengerPageProtectionEnabled()) {
+		mode |= OMRPORT_VMEM_MEMORY_MODE_SHARE_FILE_OPEN;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->enableSplitHeap) {
 		/* currently (ceiling != NULL) is using to recognize CompressedRefs so must be NULL for 32 bit platforms */
@@ -585,7 +592,9 @@ MM_MemoryManager::doubleMapArraylet(MM_MemoryHandle* handle, MM_EnvironmentBase
 	Assert_MM_true(NULL != memory);
 	return memory->doubleMapArraylet(env, arrayletLeaves, arrayletLeafCount, arrayletLeafSize, byteAmount, newIdentifier, pageSize);
 }
+#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
 
+#if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) || defined(OMR_GC_CONCURRENT_SCAVENGER)
 void*
 MM_MemoryManager::doubleMapRegions(MM_MemoryHandle* handle, MM_EnvironmentBase *env, void* regions[], UDATA regionsCount, UDATA regionSize, UDATA byteAmount, struct J9PortVmemIdentifier *newIdentifier, UDATA pageSize, void *preferredAddress)
 {
@@ -594,7 +603,7 @@ MM_MemoryManager::doubleMapRegions(MM_MemoryHandle* handle, MM_EnvironmentBase *
 	Assert_MM_true(NULL != memory);
 	return memory->doubleMapRegions(env, regions, regionsCount, regionSize, byteAmount, newIdentifier, pageSize, preferredAddress);
 }
-#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
+#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) || defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 bool
 MM_MemoryManager::commitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size)
@@ -192,7 +192,9 @@ public:
  	 * @param category
   	 */
 	void *doubleMapArraylet(MM_MemoryHandle* handle, MM_EnvironmentBase *env, void* arrayletLeaves[], UDATA arrayletLeafCount, UDATA arrayletLeafSize, UDATA byteAmount, struct J9PortVmemIdentifier *newIdentifier, UDATA pageSize);
+#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
 
+#if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) || defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/**
 	 * Double maps regions. Discontiguous regions are double mapped to one contiguous region.
 	 *
@@ -209,7 +211,7 @@ public:
 	 * @return pointer to contiguous region to which regions were double mapped into, NULL is returned if unsuccessful
 	 */
 	void *doubleMapRegions(MM_MemoryHandle* handle, MM_EnvironmentBase *env, void* regions[], UDATA regionsCount, UDATA regionSize, UDATA byteAmount, struct J9PortVmemIdentifier *newIdentifier, UDATA pageSize, void *preferredAddress);
-#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
+#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) || defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 	/**
 	 * Commit memory for range for specified virtual memory instance
@@ -30,18 +30,22 @@
 #include "MemoryPoolAddressOrderedList.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AllocationStats.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreeChunkCache.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectAllocationInterface.hpp"
 //#include "mmhook_internal.h"
 #include "HeapRegionDescriptor.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
 #include "Math.hpp"
+#include "SweepPoolState.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -433,6 +437,19 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 	}
 }
 
+/**
+ * An allocation was carved from the start of a free entry.  If the entry was the tail of the free list a lazy sweep
+ * of the pool resumes connecting after, the tail is now the remainder of the entry or, if none was recycled, the
+ * free entry before it.
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateLazySweepFreeListTail(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *newTail)
+{
+	if ((NULL != _sweepPoolState) && (freeEntry == _sweepPoolState->_lazySweepFreeListTail)) {
+		_sweepPoolState->_lazySweepFreeListTail = newTail;
+	}
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -453,9 +470,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 		_heapLock.acquire();
 	}
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	currentFreeEntry = _heapFreeList;
 	previousFreeEntry = NULL;
@@ -504,11 +519,9 @@ retry:
 
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired)) {
 			goto retry;
 		}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 		goto fail_allocate;
 	}
 
@@ -534,6 +547,7 @@ retry:
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext(compressed))) {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), recycleEntry);
 		updateHint(currentFreeEntry, recycleEntry);
+		updateLazySweepFreeListTail(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), previousFreeEntry);
@@ -546,6 +560,7 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		updateLazySweepFreeListTail(currentFreeEntry, previousFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -573,7 +588,40 @@ fail_allocate:
 void *
 MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription)
 {
-	void * addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+	MM_AllocationStats *stats = (NULL == env->_objectAllocationInterface) ? NULL : env->_objectAllocationInterface->getAllocationStats();
+	bool recordLatency = _extensions->allocationLatencyStats && (NULL != stats);
+	uint64_t startTime = recordLatency ? omrtime_hires_clock() : 0;
+	void *addr = NULL;
+
+	/* take the allocation from the thread's free chunks, refilled a batch at a time, to stay clear of the pool lock */
+	MM_FreeChunkCache *freeChunkCache = env->_freeChunkCache;
+	if ((NULL != freeChunkCache) && freeChunkCache->canCache(this, sizeInBytesRequired)) {
+		addr = freeChunkCache->allocate(env, sizeInBytesRequired);
+		if (NULL != addr) {
+			if (NULL != stats) {
+				stats->_freeChunkCacheHits += 1;
+			}
+		} else {
+			void *batchBase = NULL;
+			void *batchTop = NULL;
+			if (internalAllocateTLH(env, freeChunkCache->getRefillSize(env, sizeInBytesRequired), batchBase, batchTop, true, _largeObjectAllocateStats)) {
+				addr = freeChunkCache->refill(env, this, sizeInBytesRequired, batchBase, batchTop);
+				if (NULL != stats) {
+					stats->_freeChunkCacheRefills += 1;
+				}
+			}
+		}
+	}
+
+	if (NULL == addr) {
+		addr = internalAllocate(env, sizeInBytesRequired, true, _largeObjectAllocateStats);
+	}
+
+	if (recordLatency) {
+		stats->recordAllocationLatency(omrtime_hires_clock() - startTime);
+	}
 
 	if (addr != NULL) {
 #if defined(OMR_GC_ALLOCATION_TAX)
@@ -648,7 +696,6 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 
 retry:
 	freeEntry = _heapFreeList;
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 
 	/* Check if an entry was found */
 	if(!freeEntry) {
@@ -657,13 +704,6 @@ retry:
 		}
 		goto fail_allocate;
 	}
-#else /* OMR_GC_CONCURRENT_SWEEP */
-
-	/* Check if an entry was found */
-	if(!freeEntry) {
-		goto fail_allocate;
-	}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	if (doesNeedCardAlignment(env, freeEntry)) {
 		freeEntry = doFreeEntryCardAlignmentUpTo(env, freeEntry);
@@ -707,9 +747,11 @@ retry:
 		/* Recycle the remaining entry back onto the free list (if applicable) */
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
 			updatePrevCardUnalignedFreeEntry(entryNext, (MM_HeapLinkedFreeHeader *)addrTop);
+			updateLazySweepFreeListTail(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop);
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 		} else {
 			updatePrevCardUnalignedFreeEntry(entryNext, FREE_ENTRY_END);
+			updateLazySweepFreeListTail(freeEntry, NULL);
 			/* Adjust the free memory size and count */
 			_freeMemorySize -= recycleEntrySize;
 			_freeEntryCount -= 1;
@@ -718,6 +760,7 @@ retry:
 		}
 	} else {
 		updatePrevCardUnalignedFreeEntry(entryNext, FREE_ENTRY_END);
+		updateLazySweepFreeListTail(freeEntry, NULL);
 		/* If not recycling just update the free list pointer to the next free entry */
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
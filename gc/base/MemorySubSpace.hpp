@@ -423,9 +423,7 @@ public:
 	void clearEnqueuedCounterBalancing(MM_EnvironmentBase *env);
 	void runEnqueuedCounterBalancing(MM_EnvironmentBase *env);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	bool isDescendant(MM_MemorySubSpace *memorySubSpace);
 	
@@ -24,6 +24,7 @@
 #include "omrcfg.h"
 
 #include "EnvironmentStandard.hpp"
+#include "FreeChunkCache.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
 
@@ -33,6 +34,9 @@ void
 GC_OMRVMThreadInterface::flushCachesForWalk(MM_EnvironmentBase *env)
 {
 	env->_objectAllocationInterface->flushCache(env);
+	if (NULL != env->_freeChunkCache) {
+		env->_freeChunkCache->flush(env);
+	}
 	/* If we are in a middle of a concurrent GC, we want to flush GC caches, typically for mutator threads doing GC work.
 	 * (GC threads are  smart enough to do it themselves, before they let the walk occur) */
 	env->flushGCCaches(true);
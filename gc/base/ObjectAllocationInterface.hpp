@@ -123,6 +123,16 @@ public:
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+
+	/**
+	 * Report the TLH refreshes of the thread since its caches were last restarted.
+	 * @param refreshCount[out] the number of refreshes
+	 * @param refreshBytes[out] the bytes of the refreshed TLHs
+	 * @param discardedBytes[out] the bytes of those TLHs left unused
+	 * @param refreshSize[out] the current refresh size
+	 * @return false if the receiver does not allocate from TLHs
+	 */
+	virtual bool getTLHRefreshStats(uintptr_t *refreshCount, uintptr_t *refreshBytes, uintptr_t *discardedBytes, uintptr_t *refreshSize) { return false; }
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 	virtual void flushCache(MM_EnvironmentBase *env);
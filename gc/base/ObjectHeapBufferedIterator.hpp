@@ -80,6 +80,12 @@ public:
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, void *base, void *top, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	omrobjectptr_t nextObject();
+	/**
+	 * Hand out the objects the iterator has cached, in address order, rather than one at a time.
+	 * @param batch[out] the objects, valid until the next call to the iterator
+	 * @return the number of objects in the batch, 0 when the iteration is complete
+	 */
+	uintptr_t nextObjectBatch(omrobjectptr_t **batch);
 	void advance(uintptr_t sizeInBytes);
 	void reset(uintptr_t *base, uintptr_t *top);
 };
@@ -813,9 +813,60 @@ public:
 		return _delegate.getHotFieldOffset3(forwardedHeader);
 	}
 
+	/**
+	 * Returns a key shared by every object with the same field layout as the given object (typically its class).
+	 * Used by the Scavenger to learn hot fields when -Xgc:learnHotFields is enabled.
+	 *
+	 * @param objectPtr the object to get the layout key of
+	 * @return the layout key of the object, or NULL if hot fields should not be learned for the object
+	 */
+	MMINLINE void *
+	getHotFieldProfileKey(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getHotFieldProfileKey(objectPtr);
+	}
+
+	/**
+	 * Returns the layout key of the object referred to by the forwarded header, as getHotFieldProfileKey(omrobjectptr_t).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the layout key of the object, or NULL if hot fields should not be learned for the object
+	 */
+	MMINLINE void *
+	getHotFieldProfileKey(MM_ForwardedHeader *forwardedHeader)
+	{
+		return _delegate.getHotFieldProfileKey(forwardedHeader);
+	}
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Returns a key shared by the objects allocated at the same allocation site (or of the same class).
+	 * Used to pretenure long lived sites when -Xgc:pretenureSurvivalThreshold= is set.
+	 *
+	 * @param[in] env pointer to environment for the allocating thread
+	 * @param[in] allocateInitialization the initializer of an allocation in progress, with the adjusted size requested
+	 * @return the allocation site key of the allocation, or NULL if the allocation should not be profiled
+	 */
+	MMINLINE void *
+	getAllocationSiteKey(MM_EnvironmentBase *env, MM_AllocateInitialization *allocateInitialization)
+	{
+		return _delegate.getAllocationSiteKey(env, allocateInitialization);
+	}
+
+	/**
+	 * Returns the allocation site key of the object referred to by the forwarded header, as getAllocationSiteKey(MM_EnvironmentBase *, MM_AllocateInitialization *).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the allocation site key of the object, or NULL if the object should not be profiled
+	 */
+	MMINLINE void *
+	getAllocationSiteKey(MM_ForwardedHeader *forwardedHeader)
+	{
+		return _delegate.getAllocationSiteKey(forwardedHeader);
+	}
+
 	/**
 	 * Returns TRUE if the object referred to by the forwarded header is indexable.
 	 *
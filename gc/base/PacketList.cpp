@@ -169,6 +169,103 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	list->_lock.release();
 }
 
+void
+MM_PacketList::push(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count)
+{
+	uintptr_t index = getSublistIndex(env);
+	PacketSublist *list = &_sublists[index];
+
+	list->_lock.acquire();
+	for (uintptr_t i = 0; i < count; i++) {
+		MM_Packet *packet = packets[i];
+		packet->_next = list->_head;
+		packet->_previous = NULL;
+		packet->setSublistIndex(index);
+		if (NULL == list->_head) {
+			list->_tail = packet;
+		} else {
+			list->_head->_previous = packet;
+		}
+		list->_head = packet;
+	}
+	incrementCount(count);
+	list->_lock.release();
+}
+
+uintptr_t
+MM_PacketList::pop(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count)
+{
+	uintptr_t index = getSublistIndex(env);
+	uintptr_t popped = 0;
+
+	for (uintptr_t i = 0; (i < _sublistCount) && (popped < count); i++) {
+		PacketSublist *list = &_sublists[index];
+		if (NULL != list->_head) {
+			uintptr_t poppedFromList = 0;
+			list->_lock.acquire();
+			while ((NULL != list->_head) && (popped < count)) {
+				MM_Packet *packet = list->_head;
+				list->_head = packet->_next;
+				packets[popped] = packet;
+				popped += 1;
+				poppedFromList += 1;
+			}
+			if (NULL == list->_head) {
+				list->_tail = NULL;
+			} else {
+				list->_head->_previous = NULL;
+			}
+			decrementCount(poppedFromList);
+			list->_lock.release();
+		}
+
+		index = (index + 1) % _sublistCount;
+	}
+
+	return popped;
+}
+
+void
+MM_PacketList::remove(MM_Packet **packets, uintptr_t count)
+{
+	uintptr_t removed = 0;
+
+	for (uintptr_t index = 0; (index < _sublistCount) && (removed < count); index++) {
+		PacketSublist *list = &_sublists[index];
+		uintptr_t removedFromList = 0;
+		bool locked = false;
+
+		for (uintptr_t i = 0; i < count; i++) {
+			MM_Packet *packetToRemove = packets[i];
+			if (index == packetToRemove->getSublistIndex()) {
+				if (!locked) {
+					list->_lock.acquire();
+					locked = true;
+				}
+				MM_Packet *previous = packetToRemove->_previous;
+				MM_Packet *next = packetToRemove->_next;
+				if (NULL == previous) {
+					list->_head = next;
+				} else {
+					previous->_next = next;
+				}
+				if (NULL == next) {
+					list->_tail = previous;
+				} else {
+					next->_previous = previous;
+				}
+				removedFromList += 1;
+			}
+		}
+
+		if (locked) {
+			decrementCount(removedFromList);
+			list->_lock.release();
+			removed += removedFromList;
+		}
+	}
+}
+
 /**
  * Return the first element in the list.
  * This should be avoided as it combines all sublists in to one
@@ -152,6 +152,31 @@ public:
 	 */
 	bool popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count);
 	void remove(MM_Packet *packetToRemove);
+
+	/**
+	 * Push an array of packets on the packetList, in one acquisition of the sublist lock.
+	 *
+	 * @param packets The packets to put on the list
+	 * @param count The number of packets
+	 */
+	void push(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count);
+
+	/**
+	 * Pop up to count packets off of the packetList, in one acquisition of the lock of each sublist visited.
+	 *
+	 * @param packets The array to fill in with the packets
+	 * @param count The number of packets wanted
+	 * @return the number of packets popped
+	 */
+	uintptr_t pop(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count);
+
+	/**
+	 * Remove an array of packets from the packetList, in one acquisition of the lock of each sublist they are on.
+	 *
+	 * @param packets The packets to remove
+	 * @param count The number of packets
+	 */
+	void remove(MM_Packet **packets, uintptr_t count);
 	
 	/**
 	 * Push a packet on the packetList.
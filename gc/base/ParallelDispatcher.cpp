@@ -26,6 +26,8 @@
  * @ingroup GC_Base
  */
 
+#include <math.h>
+
 #include "omrcfg.h"
 #include "omr.h"
 #include "ModronAssertions.h"
@@ -37,6 +39,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 #include "Task.hpp"
 
 #include "ParallelDispatcher.hpp"
@@ -77,6 +80,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setWorkerID(workerID);
 	/* Enviroment initialization specific for GC threads (after worker ID is set) */
 	env->initializeGCThread();
+	dispatcher->bindWorkerToNUMANode(env);
 
 	/* Signal that the thread was created succesfully */
 	workerInfo->workerFlags = WORKER_INFO_FLAG_OK;
@@ -250,6 +254,10 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		forge->free(_threadTable);
 		_threadTable = NULL;
 	}
+	if(_workerNUMANodeTable) {
+		forge->free(_workerNUMANodeTable);
+		_workerNUMANodeTable = NULL;
+	}
 
 	env->getForge()->free(this);
 }
@@ -292,12 +300,64 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if(!initializeNUMAAffinity(env)) {
+		goto error_no_memory;
+	}
+
 	return true;
 
 error_no_memory:
 	return false;
 }
 
+bool
+MM_ParallelDispatcher::initializeNUMAAffinity(MM_EnvironmentBase *env)
+{
+	uintptr_t leaderCount = 0;
+	J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+
+	/* with a single node there is nothing to be local to */
+	if (!_extensions->numaAwareGCWorkers || (leaderCount < 2)) {
+		return true;
+	}
+
+	_workerNUMANodeTable = (uintptr_t *)env->getForge()->allocate(_threadCountMaximum * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _workerNUMANodeTable) {
+		return false;
+	}
+
+	uintptr_t totalCPUs = 0;
+	for (uintptr_t i = 0; i < leaderCount; i++) {
+		totalCPUs += leaders[i].computationalResourcesAvailable;
+	}
+
+	/* Contiguous worker IDs share a node so that the work stealing deques of node-local victims are adjacent */
+	uintptr_t nodeIndex = 0;
+	uintptr_t nodeCPULimit = leaders[0].computationalResourcesAvailable;
+	for (uintptr_t workerID = 0; workerID < _threadCountMaximum; workerID++) {
+		uintptr_t cpuPosition = (workerID * totalCPUs) / _threadCountMaximum;
+		while ((cpuPosition >= nodeCPULimit) && (nodeIndex < (leaderCount - 1))) {
+			nodeIndex += 1;
+			nodeCPULimit += leaders[nodeIndex].computationalResourcesAvailable;
+		}
+		_workerNUMANodeTable[workerID] = nodeIndex + 1;
+	}
+	_numaNodeCount = leaderCount;
+
+	return true;
+}
+
+void
+MM_ParallelDispatcher::bindWorkerToNUMANode(MM_EnvironmentBase *env)
+{
+	uintptr_t j9NodeNumber = _extensions->_numaManager.getJ9NodeNumber(getWorkerNUMANode(env->getWorkerID()));
+
+	if (0 != j9NodeNumber) {
+		/* failing to bind leaves the worker unbound, which only costs locality */
+		env->setNumaAffinity(&j9NodeNumber, 1);
+	}
+}
+
 bool
 MM_ParallelDispatcher::startUpThreads()
 {
@@ -492,6 +552,20 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 		Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_useCollectorRecommendedThreads(task->getRecommendedWorkingThreads(), taskActiveThreadCount);
 	}
 
+	/* Account for adaptive task threading. Once a task type has been measured, its history supersedes both the
+	 * static heuristics and the task's own recommendation. Not used for a task dispatched with an explicit thread count.
+	 */
+	if (task_threading_none != _sampledTaskType) {
+		uintptr_t recommendedThreadCount = _taskThreadingHistory[_sampledTaskType].recommendedThreadCount;
+		if (0 != recommendedThreadCount) {
+			taskActiveThreadCount = OMR_MIN(_threadCount, recommendedThreadCount);
+
+			_activeThreadCount = taskActiveThreadCount;
+
+			Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_useTaskThreadingHistory(getTaskThreadingTypeName(_sampledTaskType), recommendedThreadCount, taskActiveThreadCount);
+		}
+	}
+
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -527,6 +601,99 @@ MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 	return toReturn;
 }
 
+uintptr_t
+MM_ParallelDispatcher::getTaskThreadingType(MM_Task *task)
+{
+	uintptr_t type = task_threading_none;
+
+	if (_extensions->adaptiveTaskThreading && !_extensions->gcThreadCountForced && !_extensions->isMetronomeGC()) {
+		switch (task->getVMStateID()) {
+		case OMRVMSTATE_GC_SCAVENGE:
+			type = task_threading_scavenge;
+			break;
+		case OMRVMSTATE_GC_MARK:
+			type = task_threading_mark;
+			break;
+		case OMRVMSTATE_GC_SWEEP:
+			type = task_threading_sweep;
+			break;
+		case OMRVMSTATE_GC_COMPACT:
+			type = task_threading_compact;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return type;
+}
+
+const char *
+MM_ParallelDispatcher::getTaskThreadingTypeName(uintptr_t type)
+{
+	switch (type) {
+	case task_threading_scavenge:
+		return "scavenge";
+	case task_threading_mark:
+		return "mark";
+	case task_threading_sweep:
+		return "sweep";
+	case task_threading_compact:
+		return "compact";
+	default:
+		return "unknown";
+	}
+}
+
+void
+MM_ParallelDispatcher::updateTaskThreadingHistory(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount, uint64_t wallTime)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	TaskThreadingHistory *history = &_taskThreadingHistory[_sampledTaskType];
+
+	uint64_t wallMicros = omrtime_hires_delta(0, wallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t threadMicros = omrtime_hires_delta(0, _sampleThreadTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t syncStallMicros = omrtime_hires_delta(0, task->getSyncStallTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t cpuMicros = _sampleCPUTime / 1000;
+
+	/* A thread is busy from accepting the task to completing it, except while blocked at a synchronization point.
+	 * Anything else the dispatch held its threads for (wake up latency, sync points, waiting for the last thread) is stall.
+	 */
+	uint64_t capacityMicros = wallMicros * threadCount;
+	uint64_t busyMicros = (threadMicros > syncStallMicros) ? (threadMicros - syncStallMicros) : 0;
+	uint64_t stallMicros = (capacityMicros > busyMicros) ? (capacityMicros - busyMicros) : 0;
+
+	float historyWeight = (0 == history->samples) ? 0.0f : _extensions->adaptiveTaskThreadingWeight;
+	history->wallTime = (uint64_t)MM_Math::weightedAverage((double)history->wallTime, (double)wallMicros, (double)historyWeight);
+	history->cpuTime = (uint64_t)MM_Math::weightedAverage((double)history->cpuTime, (double)cpuMicros, (double)historyWeight);
+	history->stallTime = (uint64_t)MM_Math::weightedAverage((double)history->stallTime, (double)stallMicros, (double)historyWeight);
+	history->samples += 1;
+	history->lastThreadCount = threadCount;
+
+	/* Too short to measure - keep the previous recommendation */
+	if (0 == capacityMicros) {
+		return;
+	}
+
+	/* The model used by the Scavenger's adaptive threading, applied to any task type. Having observed busy time b and
+	 * stall time s per thread on n threads, the projected duration on m threads is b * (n/m) + s * (m/n)^x, which is
+	 * shortest (throughput is highest) at m = n * ((1/x) * ((1/%stall) - 1))^(1/(x+1)).
+	 * The stall ratio is bounded so a single noisy dispatch can't collapse to 1 thread or jump straight to all of them.
+	 */
+	float percentStall = (float)stallMicros / (float)capacityMicros;
+	percentStall = OMR_MAX(0.01f, OMR_MIN(percentStall, 0.99f));
+	float sensitivityFactor = _extensions->adaptiveTaskThreadingSensitivityFactor;
+	float powerExponent = 1.0f / (sensitivityFactor + 1.0f);
+	float powerBase = (1.0f / sensitivityFactor) * ((1.0f / percentStall) - 1.0f);
+	float idealThreads = threadCount * powf(powerBase, powerExponent);
+	float adjustedThreads = MM_Math::weightedAverage((float)threadCount, idealThreads, _extensions->adaptiveTaskThreadingWeight);
+
+	uintptr_t recommendedThreadCount = (uintptr_t)(adjustedThreads + 0.5f);
+	history->recommendedThreadCount = OMR_MAX((uintptr_t)1, OMR_MIN(recommendedThreadCount, _threadCount));
+
+	Trc_MM_ParallelDispatcher_updateTaskThreadingHistory(getTaskThreadingTypeName(_sampledTaskType), threadCount, wallMicros, cpuMicros, stallMicros, percentStall * 100.0f, history->recommendedThreadCount);
+}
+
 void
 MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
 {
@@ -541,6 +708,12 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	_task = task;
 
 	task->setSynchronizeMutex(_synchronizeMutex);
+	if (_extensions->gcThreadSyncBarrier) {
+		/* spinning only pays off when every thread of the task can be running at once */
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uintptr_t spinCount = (threadCount <= omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET)) ? _extensions->gcThreadSyncBarrierSpinCount : 0;
+		task->setSynchronizeBarrier(true, spinCount);
+	}
 
 	/* Main thread will be used - update status */
 	_statusTable[env->getWorkerID()] = worker_status_reserved;
@@ -563,6 +736,12 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	_statusTable[workerID] = worker_status_active;
 	env->_currentTask = _taskTable[workerID];
 
+	if (task_threading_none != _sampledTaskType) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_AtomicOperations::subtractU64(&_sampleThreadTime, omrtime_hires_clock());
+		MM_AtomicOperations::subtractU64(&_sampleCPUTime, (uint64_t)omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread));
+	}
+
 	env->_currentTask->accept(env);
 }
 
@@ -570,6 +749,13 @@ void
 MM_ParallelDispatcher::completeTask(MM_EnvironmentBase *env)
 {
 	uintptr_t workerID = env->getWorkerID();
+
+	if (task_threading_none != _sampledTaskType) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_AtomicOperations::addU64(&_sampleThreadTime, omrtime_hires_clock());
+		MM_AtomicOperations::addU64(&_sampleCPUTime, (uint64_t)omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread));
+	}
+
 	_statusTable[workerID] = worker_status_waiting;
 	
 	MM_Task *currentTask = env->_currentTask;
@@ -598,12 +784,32 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 void
 MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	/* Only measure dispatches whose thread count the dispatcher is free to choose */
+	_sampledTaskType = (UDATA_MAX == newThreadCount) ? getTaskThreadingType(task) : task_threading_none;
+
 	uintptr_t activeThreads = recomputeActiveThreadCountForTask(env, task, newThreadCount);
 	task->mainSetup(env);
+
+	uint64_t dispatchStartTime = 0;
+	if (task_threading_none != _sampledTaskType) {
+		_sampleThreadTime = 0;
+		_sampleCPUTime = 0;
+		dispatchStartTime = omrtime_hires_clock();
+	}
+
 	prepareThreadsForTask(env, task, activeThreads);
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
+
+	/* all threads have completed the task, so the samples are final */
+	if (task_threading_none != _sampledTaskType) {
+		updateTaskThreadingHistory(env, task, activeThreads, omrtime_hires_clock() - dispatchStartTime);
+		_sampledTaskType = task_threading_none;
+	}
+
 	cleanupAfterTask(env);
 	task->mainCleanup(env);
 }
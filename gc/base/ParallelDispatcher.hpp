@@ -29,6 +29,8 @@
 #if !defined(PARALLEL_DISPATCHER_HPP_)
 #define PARALLEL_DISPATCHER_HPP_
 
+#include <string.h>
+
 #include "omrcfg.h"
 
 #include "modronopt.h"
@@ -42,6 +44,31 @@ class MM_EnvironmentBase;
 
 class MM_ParallelDispatcher : public MM_BaseVirtual
 {
+public:
+	/**
+	 * Task types whose thread count is adapted from measured parallel efficiency (-Xgc:adaptiveTaskThreads).
+	 */
+	enum TaskThreadingType {
+		task_threading_scavenge = 0,
+		task_threading_mark,
+		task_threading_sweep,
+		task_threading_compact,
+		task_threading_count, /* must be last */
+		task_threading_none = task_threading_count
+	};
+
+	/**
+	 * Measured history of one task type. Times are exponentially weighted averages, in microseconds.
+	 */
+	struct TaskThreadingHistory {
+		uintptr_t samples; /**< The number of dispatches measured */
+		uintptr_t lastThreadCount; /**< The thread count of the most recently measured dispatch */
+		uintptr_t recommendedThreadCount; /**< The thread count to use for the next dispatch, 0 until the first sample */
+		uint64_t wallTime; /**< Elapsed time of a dispatch */
+		uint64_t cpuTime; /**< CPU time of a dispatch, summed over its threads */
+		uint64_t stallTime; /**< Time spent not working, summed over the threads of a dispatch (start latency, synchronization points and waiting for the last thread) */
+	};
+
 	/*
 	 * Data members
 	 */
@@ -78,6 +105,13 @@ protected:
 	uintptr_t _threadCount; /**< number of threads currently forked */
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
 	uintptr_t _threadsToReserve; /**< Indicates number of threads remaining to dispatch tasks upon notify. Must be exactly 0 after tasks are dispatched. */
+	uintptr_t *_workerNUMANodeTable; /**< Affinity leader (1-based NUMA node ID) each worker is bound to, NULL unless workers are NUMA bound */
+	uintptr_t _numaNodeCount; /**< The number of NUMA nodes workers are distributed across, 0 if workers are not NUMA bound */
+
+	TaskThreadingHistory _taskThreadingHistory[task_threading_count]; /**< Per task type measurements used to pick the thread count of the next dispatch */
+	uintptr_t _sampledTaskType; /**< The type of the task being dispatched if its dispatch is being measured, task_threading_none otherwise */
+	volatile uint64_t _sampleThreadTime; /**< Sum over the threads of the measured dispatch of (complete time - accept time), in hi-res ticks */
+	volatile uint64_t _sampleCPUTime; /**< Sum over the threads of the measured dispatch of the CPU time spent between accept and complete, in nanoseconds */
 
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
@@ -97,6 +131,18 @@ protected:
 	virtual void mainEntryPoint(MM_EnvironmentBase *env);
 
 	bool initialize(MM_EnvironmentBase *env);
+
+	/**
+	 * Assign each worker to a NUMA node when -Xgc:numaAffinity is enabled and more than one node is available.
+	 * Workers are handed out to the affinity leaders in contiguous ranges, in proportion to the CPUs each node offers.
+	 * @return false if the node table could not be allocated, true otherwise
+	 */
+	bool initializeNUMAAffinity(MM_EnvironmentBase *env);
+
+	/**
+	 * Bind the calling GC thread to the NUMA node assigned to its worker ID, if any.
+	 */
+	void bindWorkerToNUMANode(MM_EnvironmentBase *env);
 	
 	virtual void prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount);
 	virtual void cleanupAfterTask(MM_EnvironmentBase *env);
@@ -118,6 +164,20 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * @return the task threading type the task is measured as, or task_threading_none if its thread count is not adapted
+	 */
+	uintptr_t getTaskThreadingType(MM_Task *task);
+
+	/**
+	 * Fold the measurements of a completed dispatch into the history of its task type and pick the thread count of the next dispatch.
+	 * @param[in] env the main GC thread
+	 * @param[in] task the completed task
+	 * @param[in] threadCount the number of threads the task was dispatched on
+	 * @param[in] wallTime the elapsed time of the dispatch, in hi-res ticks
+	 */
+	void updateTaskThreadingHistory(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount, uint64_t wallTime);
 	
 	/**
 	 * Main routine to fork and startup GC threads.
@@ -173,6 +233,28 @@ public:
 	MMINLINE virtual uintptr_t threadCountMaximum() { return _threadCountMaximum; }
 	MMINLINE omrthread_t* getThreadTable() { return _threadTable; }
 	MMINLINE virtual uintptr_t activeThreadCount() { return _activeThreadCount; }
+
+	/**
+	 * @param workerID[in] the worker ID of a GC thread
+	 * @return the 1-based NUMA node the worker is bound to, or 0 if workers are not NUMA bound
+	 */
+	MMINLINE uintptr_t getWorkerNUMANode(uintptr_t workerID) { return (NULL == _workerNUMANodeTable) ? 0 : _workerNUMANodeTable[workerID]; }
+
+	/**
+	 * @return the number of NUMA nodes workers are distributed across, or 0 if workers are not NUMA bound
+	 */
+	MMINLINE uintptr_t getNUMANodeCount() { return _numaNodeCount; }
+
+	/**
+	 * @param[in] type a TaskThreadingType other than task_threading_none
+	 * @return the measured history of the task type (samples is 0 if it has never been measured)
+	 */
+	MMINLINE TaskThreadingHistory *getTaskThreadingHistory(uintptr_t type) { return &_taskThreadingHistory[type]; }
+
+	/**
+	 * @return a printable name for a TaskThreadingType
+	 */
+	static const char *getTaskThreadingTypeName(uintptr_t type);
 	virtual void setThreadCount(uintptr_t threadCount);
 
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
@@ -202,6 +284,11 @@ public:
 		,_threadCount(1)
 		,_activeThreadCount(1)
 		,_threadsToReserve(0)		
+		,_workerNUMANodeTable(NULL)
+		,_numaNodeCount(0)
+		,_sampledTaskType(task_threading_none)
+		,_sampleThreadTime(0)
+		,_sampleCPUTime(0)
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
@@ -210,6 +297,7 @@ public:
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 	{
 		_typeId = __FUNCTION__;
+		memset(_taskThreadingHistory, 0, sizeof(_taskThreadingHistory));
 	}
 
 	/*
@@ -34,6 +34,7 @@
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -80,6 +81,41 @@ public:
 	}
 };
 
+/**
+ * Task walking the heap in batches of objects on every GC thread.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectBatchDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapWalkerObjectBatchFunc _function;
+	void *_userData;
+	uintptr_t _typeFlags;
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelObjectBatchDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _typeFlags(typeFlags)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -100,6 +136,19 @@ MM_ParallelHeapWalker::newInstance(MM_ParallelGlobalGC *globalCollector, MM_Mark
 	return heapWalker;
 }
 
+uintptr_t
+MM_ParallelHeapWalker::getParallelChunkSize(MM_EnvironmentBase *env, uintptr_t *heapChunkFactor)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	*heapChunkFactor = 1;
+	if ((threadCount > 1) && _markMap->isMarkMapValid() && (!extensions->usingSATBBarrier())) {
+		*heapChunkFactor = threadCount * 8;
+	}
+	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / *heapChunkFactor;
+	return MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+}
+
 /**
  * Walk through all live objects of the heap in parallel and apply the provided function.
  */
@@ -110,13 +159,8 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
 	/* determine the size of the segment chunks to use for parallel walks */
-	uintptr_t threadCount = env->_currentTask->getThreadCount();
 	uintptr_t heapChunkFactor = 1;
-	if ((threadCount > 1) && _markMap->isMarkMapValid() && (!extensions->usingSATBBarrier())) {
-		heapChunkFactor = threadCount * 8;
-	}
-	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
-	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+	uintptr_t parallelChunkSize = getParallelChunkSize(env, &heapChunkFactor);
 
 	/* Perform the parallel object heap iteration */
 	uintptr_t objectsWalked = 0;
@@ -141,6 +185,65 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
 }
 
+/**
+ * Walk through all live objects of the heap in parallel and apply the provided function to batches of them.
+ * Regions are divided in chunks as for allObjectsDoParallel(), and every chunk is walked by the thread that
+ * claims it, from its base up to the first marked object beyond its top.
+ */
+void
+MM_ParallelHeapWalker::allObjectBatchesDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t heapChunkFactor = 1;
+	uintptr_t parallelChunkSize = getParallelChunkSize(env, &heapChunkFactor);
+
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		/* every thread makes the same decisions, so that they claim the same sequence of work units */
+		if ((typeFlags != (region->getTypeFlags() & typeFlags)) || isRegionEmpty(env, region)) {
+			continue;
+		}
+
+		void *top = region->getHighAddress();
+		GC_MarkMapSegmentChunkIterator chunkIterator(extensions, region->getLowAddress(), top, parallelChunkSize);
+		uintptr_t *chunkBase = NULL;
+		uintptr_t *chunkTop = NULL;
+
+		while (chunkIterator.nextChunk(_markMap, &chunkBase, &chunkTop)) {
+			if (!J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				continue;
+			}
+
+			/* the chunk extends beyond its top up to the first marked object, see GC_ParallelObjectHeapIterator */
+			GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, region);
+			objectHeapIterator.reset(chunkBase, (uintptr_t *)top);
+			omrobjectptr_t *batch = NULL;
+			uintptr_t count = 0;
+			bool chunkComplete = false;
+			while (!chunkComplete && (0 != (count = objectHeapIterator.nextObjectBatch(&batch)))) {
+				if ((uintptr_t *)batch[count - 1] >= chunkTop) {
+					for (uintptr_t i = 0; i < count; i++) {
+						if (((uintptr_t *)batch[i] >= chunkTop) && _markMap->isBitSet(batch[i])) {
+							count = i;
+							chunkComplete = true;
+							break;
+						}
+					}
+				}
+				if (0 != count) {
+					function(omrVMThread, region, batch, count, userData);
+				}
+			}
+		}
+	}
+	regionManager->unlock();
+}
+
 /**
  * Walk through all live objects of the heap and apply the provided function.
  * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -170,3 +273,32 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+/**
+ * Walk through all live objects of the heap and apply the provided function to batches of them.
+ * If parallel is set to true, task is dispatched to GC threads, otherwise walk all regions single threaded.
+ */
+void
+MM_ParallelHeapWalker::allObjectBatchesDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags, bool parallel, bool prepareHeapForWalk)
+{
+	if (parallel) {
+		GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+		if (prepareHeapForWalk) {
+			_globalCollector->prepareHeapForWalk(env);
+		}
+
+		MM_ParallelObjectBatchDoTask objectBatchDoTask(env, this, function, userData, typeFlags);
+		env->getExtensions()->dispatcher->run(env, &objectBatchDoTask);
+	} else {
+		MM_HeapWalker::allObjectBatchesDo(env, function, userData, typeFlags, parallel, prepareHeapForWalk);
+	}
+}
+
+/**
+ * gets the heap walker and calls the actual allObjectBatchesDoParallel function
+ */
+void
+MM_ParallelObjectBatchDoTask::run(MM_EnvironmentBase *env)
+{
+	_heapWalker->allObjectBatchesDoParallel(env, _function, _userData, _typeFlags);
+}
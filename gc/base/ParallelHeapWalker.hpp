@@ -47,6 +47,11 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * @param heapChunkFactor[out] the number of chunks the heap is divided in
+	 * @return the size of the chunks regions are divided in for the threads of the current task to walk
+	 */
+	uintptr_t getParallelChunkSize(MM_EnvironmentBase *env, uintptr_t *heapChunkFactor);
 protected:
 public:	
 	/**
@@ -54,6 +59,11 @@ public:
 	 */
 	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
 
+	/**
+	 * Walk through all live objects of the heap in parallel and apply the provided function to batches of them.
+	 */
+	void allObjectBatchesDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags);
+
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
 	 * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -61,6 +71,12 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk through all live objects of the heap and apply the provided function to batches of them.
+	 * If parallel is set to true, task is dispatched to GC threads, which claim the regions, or chunks of them, to walk.
+	 */
+	virtual void allObjectBatchesDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags, bool parallel, bool prepareHeapForWalk);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +101,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectBatchDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
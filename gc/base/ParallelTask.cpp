@@ -69,13 +69,45 @@ MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 	return envWorkUnitIndex == envWorkUnitToHandle;
 }
 
+bool
+MM_ParallelTask::arriveAtSyncBarrier(MM_EnvironmentBase *env, const char *id)
+{
+	/* The first thread to arrive installs its id, the releasing thread clears it before starting the next generation.
+	 * The work unit index of the first thread cannot be published atomically with the id, so only the id is checked.
+	 */
+	const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+	Assert_GC_true_with_message4(env, (NULL == syncPointUniqueId) || (syncPointUniqueId == id),
+		"%s at %p from arriveAtSyncBarrier: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, syncPointUniqueId);
+
+	return _syncBarrier.arrive((uint32_t)_threadCount);
+}
+
+void
+MM_ParallelTask::waitAtSyncBarrier(MM_EnvironmentBase *env, uint32_t sense)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t waitStartTime = omrtime_hires_clock();
+
+	_syncBarrier.waitForRelease(sense);
+
+	MM_AtomicOperations::addU64(&_syncStallTime, omrtime_hires_clock() - waitStartTime);
+}
+
 void
 MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 {
 	Trc_MM_SynchronizeGCThreads_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 	
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && _useSyncBarrier) {
+		uint32_t sense = _syncBarrier.getSense();
+		if (arriveAtSyncBarrier(env, id)) {
+			_syncPointUniqueId = NULL;
+			_syncBarrier.release();
+		} else {
+			waitAtSyncBarrier(env, sense);
+		}
+	} else if(1 < _totalThreadCount) {
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -97,10 +129,14 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 			omrthread_monitor_notify_all(_synchronizeMutex);
 		} else {
 			volatile uintptr_t index = _synchronizeIndex;
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			uint64_t waitStartTime = omrtime_hires_clock();
 
 			do {
 				omrthread_monitor_wait(_synchronizeMutex);
 			} while(index == _synchronizeIndex);
+
+			_syncStallTime += (omrtime_hires_clock() - waitStartTime);
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
@@ -117,7 +153,22 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && _useSyncBarrier) {
+		uint32_t sense = _syncBarrier.getSense();
+		bool last = arriveAtSyncBarrier(env, id);
+		if (env->isMainThread()) {
+			if (!last) {
+				OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+				uint64_t waitStartTime = omrtime_hires_clock();
+				_syncBarrier.waitForArrivals((uint32_t)_threadCount);
+				MM_AtomicOperations::addU64(&_syncStallTime, omrtime_hires_clock() - waitStartTime);
+			}
+			isMainThread = true;
+			_synchronized = true;
+		} else {
+			waitAtSyncBarrier(env, sense);
+		}
+	} else if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 
 		omrthread_monitor_enter(_synchronizeMutex);
@@ -151,7 +202,10 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 				_synchronized = true;
 				goto done;
 			}
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			uint64_t waitStartTime = omrtime_hires_clock();
 			omrthread_monitor_wait(_synchronizeMutex);
+			_syncStallTime += (omrtime_hires_clock() - waitStartTime);
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
@@ -172,7 +226,15 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && _useSyncBarrier) {
+		uint32_t sense = _syncBarrier.getSense();
+		if (arriveAtSyncBarrier(env, id)) {
+			isReleasedThread = true;
+			_synchronized = true;
+		} else {
+			waitAtSyncBarrier(env, sense);
+		}
+	} else if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
 
@@ -197,9 +259,12 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 			goto done;
 		}
 
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t waitStartTime = omrtime_hires_clock();
 		do {
 			omrthread_monitor_wait(_synchronizeMutex);
 		} while(index == _synchronizeIndex);
+		_syncStallTime += (omrtime_hires_clock() - waitStartTime);
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
@@ -230,6 +295,14 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message2(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
+	if (_useSyncBarrier) {
+		_syncPointUniqueId = NULL;
+		uint64_t notifyStartTime = omrtime_hires_clock();
+		_syncBarrier.release();
+		addToNotifyStallTime(env, notifyStartTime, omrtime_hires_clock());
+		return;
+	}
+
 	omrthread_monitor_enter(_synchronizeMutex);
 	_synchronizeCount = 0;
 	_synchronizeIndex += 1;
@@ -256,6 +329,11 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 		MM_Task::complete(env);
 		
 	} else {
+		if (_useSyncBarrier) {
+			Assert_GC_true_with_message3(env, 0 == _syncBarrier.getArrivedCount(),
+				"%s at %p from complete: reach end of the task however threads are waiting at (%s)\n", getBaseVirtualTypeId(), this, _syncPointUniqueId);
+		}
+
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		if (0 == _synchronizeCount) {
@@ -34,6 +34,7 @@
 
 #include "AtomicOperations.hpp"
 #include "Task.hpp"
+#include "ThreadBarrier.hpp"
 
 class MM_EnvironmentBase;
 
@@ -50,6 +51,7 @@ private:
 protected:
 	uint64_t _syncCriticalSectionStartTime; /**< Timestamp taken when a critical section of the task starts execution. */
 	uint64_t _syncCriticalSectionDuration; /**< The time, in hi-res ticks, it took to execute the lastest critical section. */
+	uint64_t _syncStallTime; /**< The time, in hi-res ticks, threads spent blocked at synchronization points, summed over all threads (updated under _synchronizeMutex, or atomically when synchronizing on _syncBarrier) */
 
 	bool _synchronized;
 	const char *_syncPointUniqueId;
@@ -62,11 +64,27 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	bool _useSyncBarrier; /**< True if threads synchronize on _syncBarrier rather than on _synchronizeMutex */
+	MM_ThreadBarrier _syncBarrier; /**< Spin-then-park barrier used for synchronization points when _useSyncBarrier is set */
 public:
 	
 	/*
 	 * Function members
 	 */
+private:
+	/**
+	 * Check the synchronization point and arrive at _syncBarrier.
+	 * The first thread to arrive records id, later threads assert they reached the same point.
+	 * @param id[in] unique identification of the synchronization point
+	 * @return true if the caller is the last thread to arrive
+	 */
+	bool arriveAtSyncBarrier(MM_EnvironmentBase *env, const char *id);
+
+	/**
+	 * Wait at _syncBarrier for the generation sampled before arriving to be released, accounting the time as stall.
+	 */
+	void waitAtSyncBarrier(MM_EnvironmentBase *env, uint32_t sense);
+
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -77,6 +95,12 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
+	MMINLINE virtual void
+	setSynchronizeBarrier(bool useBarrier, uintptr_t spinCount)
+	{
+		_useSyncBarrier = useBarrier;
+		_syncBarrier.initialize(spinCount, _synchronizeMutex);
+	}
 	virtual void complete(MM_EnvironmentBase *env);
 
 	/**
@@ -88,6 +112,7 @@ public:
 	}
 	MMINLINE virtual uintptr_t getThreadCount() { return _totalThreadCount; }
 	MMINLINE virtual void addToNotifyStallTime(MM_EnvironmentBase *env, uint64_t startTime, uint64_t endTime) {}
+	virtual uint64_t getSyncStallTime() { return _syncStallTime; }
 	
 	virtual bool isSynchronized();
 
@@ -98,6 +123,7 @@ public:
 		MM_Task(env, dispatcher)
 		,_syncCriticalSectionStartTime(0)
 		,_syncCriticalSectionDuration(0)
+		,_syncStallTime(0)
 		,_synchronized(false)
 		,_syncPointUniqueId(NULL)
 		,_syncPointWorkUnitIndex(0)
@@ -107,6 +133,8 @@ public:
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_useSyncBarrier(false)
+		,_syncBarrier()
 	{
 		_typeId = __FUNCTION__;
 	}
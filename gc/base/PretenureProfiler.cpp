@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "PretenureProfiler.hpp"
+
+MM_PretenureProfiler *
+MM_PretenureProfiler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_PretenureProfiler *profiler = (MM_PretenureProfiler *)env->getForge()->allocate(sizeof(MM_PretenureProfiler), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != profiler) {
+		new(profiler) MM_PretenureProfiler(env);
+		if (!profiler->initialize(env)) {
+			profiler->kill(env);
+			profiler = NULL;
+		}
+	}
+	return profiler;
+}
+
+void
+MM_PretenureProfiler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_PretenureProfiler::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	_survivalThreshold = extensions->pretenureSurvivalThreshold;
+
+	if (!_profiles.initialize(env, "MM_PretenureProfiler::mutex", extensions->pretenureSampleRate)) {
+		return false;
+	}
+
+	_candidates = rankingNew(env->getPortLibrary(), PRETENURE_MAXIMUM_SITES);
+	if (NULL == _candidates) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_PretenureProfiler::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _candidates) {
+		rankingFree(_candidates);
+		_candidates = NULL;
+	}
+
+	_profiles.tearDown(env);
+}
+
+bool
+MM_PretenureProfiler::recordSample(MM_EnvironmentBase *env, MM_PretenureAllocationSample *sample)
+{
+	SiteProfile *profile = _profiles.findOrInsert(env, sample->siteKey);
+	if (NULL == profile) {
+		return false;
+	}
+	profile->allocatedSamples += 1;
+	return true;
+}
+
+bool
+MM_PretenureProfiler::recordSample(MM_EnvironmentBase *env, MM_PretenureTenureSample *sample)
+{
+	SiteProfile *profile = _profiles.find(sample->siteKey);
+	if (NULL == profile) {
+		return false;
+	}
+	profile->tenuredSamples += 1;
+	return true;
+}
+
+void
+MM_PretenureProfiler::publish(MM_EnvironmentBase *env)
+{
+	_newlyPretenuredSiteCount = 0;
+	rankingClear(_candidates);
+
+	/* rank the sites whose survival rate reaches the threshold by their tenured samples */
+	for (uintptr_t i = 0; i < PROFILE_TABLE_SIZE; i++) {
+		SiteProfile *profile = _profiles.getEntry(i);
+		if ((NULL != profile->key) && !profile->pretenured) {
+			uintptr_t allocated = profile->allocatedSamples;
+			uintptr_t tenured = profile->tenuredSamples;
+			if ((PRETENURE_PROFILE_MINIMUM_SAMPLES <= allocated) && ((tenured * 100) >= (allocated * _survivalThreshold))) {
+				if ((_candidates->curSize < _candidates->size) || (tenured > rankingGetLowestCount(_candidates))) {
+					rankingUpdateLowest(_candidates, (void *)profile, tenured);
+				}
+			}
+			if (PRETENURE_PROFILE_WINDOW < allocated) {
+				profile->allocatedSamples = allocated / 2;
+				profile->tenuredSamples = tenured / 2;
+			}
+		}
+	}
+
+	uintptr_t candidateCount = _candidates->curSize;
+	for (uintptr_t rank = 1; (rank <= candidateCount) && (_pretenuredSiteCount < PRETENURE_MAXIMUM_SITES); rank++) {
+		SiteProfile *profile = (SiteProfile *)rankingGetKthHighest(_candidates, rank);
+		profile->pretenured = true;
+		_pretenuredSiteCount += 1;
+		_newlyPretenuredSiteCount += 1;
+	}
+}
+
+bool
+MM_PretenureProfiler::getSiteSurvivalRate(void *siteKey, uintptr_t *survivalRate, bool *pretenured)
+{
+	bool result = false;
+
+	_profiles.lock();
+	SiteProfile *profile = (NULL == siteKey) ? NULL : _profiles.find(siteKey);
+	if (NULL != profile) {
+		*pretenured = profile->pretenured;
+		if (PRETENURE_PROFILE_MINIMUM_SAMPLES <= profile->allocatedSamples) {
+			*survivalRate = OMR_MIN((profile->tenuredSamples * 100) / profile->allocatedSamples, (uintptr_t)100);
+			result = true;
+		}
+	}
+	_profiles.unlock();
+
+	return result;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(PRETENUREPROFILER_HPP_)
+#define PRETENUREPROFILER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "ranking.h"
+
+#include "BaseNonVirtual.hpp"
+#include "SampledProfileTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* Sampled allocations of a site needed before its survival rate is trusted. */
+#define PRETENURE_PROFILE_MINIMUM_SAMPLES 32
+/* Sampled allocations of a site past which its samples are halved, so that survival rates follow the application. */
+#define PRETENURE_PROFILE_WINDOW 4096
+/* Most allocation sites that are pretenured. */
+#define PRETENURE_MAXIMUM_SITES 64
+
+/**
+ * An allocation sampled by the allocation interface.
+ * @ingroup GC_Base_Core
+ */
+struct MM_PretenureAllocationSample {
+	void *siteKey; /**< Allocation site of the object */
+};
+
+/**
+ * An object sampled as the Scavenger tenured it.
+ * @ingroup GC_Base_Core
+ */
+struct MM_PretenureTenureSample {
+	void *siteKey; /**< Allocation site of the object */
+};
+
+/**
+ * Thread local buffer of sampled allocations, flushed to the MM_PretenureProfiler when full and when the thread
+ * flushes its allocation caches.
+ */
+typedef MM_ProfileSampleBuffer<MM_PretenureAllocationSample> MM_PretenureAllocationSampleBuffer;
+
+/**
+ * Thread local buffer of sampled tenured objects, flushed to the MM_PretenureProfiler when full and at the end of the scavenge.
+ */
+typedef MM_ProfileSampleBuffer<MM_PretenureTenureSample> MM_PretenureTenureSampleBuffer;
+
+/**
+ * Learns which allocation sites (see GC_ObjectModel::getAllocationSiteKey()) produce long lived objects, so that
+ * the allocator can place their objects in tenure space instead of having the Scavenger copy them until they tenure.
+ *
+ * The allocation interface samples the allocations of every site, the Scavenger samples the objects it tenures, and
+ * the ratio of the two is the survival rate of the site. At the end of every scavenge the sites whose survival rate
+ * reaches -Xgc:pretenureSurvivalThreshold= are ranked by tenured samples, and the top sites are pretenured. A site
+ * stays pretenured once selected, as its objects are no longer copied and its survival can not be observed.
+ * @ingroup GC_Base_Core
+ */
+class MM_PretenureProfiler : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	/**
+	 * The profile of one allocation site, keyed by the site key.
+	 */
+	struct SiteProfile : public MM_SampledProfile {
+		uintptr_t allocatedSamples; /**< Sampled allocations of the site */
+		uintptr_t tenuredSamples; /**< Sampled objects of the site tenured by the Scavenger */
+		volatile bool pretenured; /**< True if objects of the site are allocated in tenure space */
+
+		bool
+		initialize(MM_EnvironmentBase *env)
+		{
+			allocatedSamples = 0;
+			tenuredSamples = 0;
+			pretenured = false;
+			return true;
+		}
+
+		void tearDown(MM_EnvironmentBase *env) {}
+	};
+
+private:
+	MM_SampledProfileTable<SiteProfile> _profiles; /**< Profiles of the sampled allocation sites */
+	OMRRanking *_candidates; /**< Sites that may be pretenured, ranked by tenured samples */
+	uintptr_t _survivalThreshold; /**< Percentage of sampled allocations that must be tenured for a site to be pretenured */
+	volatile uintptr_t _pretenuredSiteCount; /**< Sites with pretenured set */
+	uintptr_t _newlyPretenuredSiteCount; /**< Sites pretenured at the last publish */
+
+/* Methods */
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_PretenureProfiler *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide whether the next event seen by the thread owning the buffer should be sampled.
+	 * @param buffer[in] the sample buffer of the calling thread
+	 * @return true once every pretenureSampleRate calls
+	 */
+	template <typename SAMPLE>
+	MMINLINE bool shouldSample(MM_ProfileSampleBuffer<SAMPLE> *buffer) { return _profiles.shouldSample(buffer); }
+
+	/**
+	 * Record a sampled event of an allocation site, flushing the buffer when it fills.
+	 * @param buffer[in] the sample buffer of the calling thread
+	 * @param siteKey[in] the allocation site key, not NULL
+	 */
+	template <typename SAMPLE>
+	MMINLINE void
+	addSample(MM_EnvironmentBase *env, MM_ProfileSampleBuffer<SAMPLE> *buffer, void *siteKey)
+	{
+		SAMPLE sample = { siteKey };
+		_profiles.addSample(env, buffer, sample, this);
+	}
+
+	/**
+	 * Add the samples in the buffer to the site profiles and empty the buffer. May be called by several threads concurrently.
+	 * @param buffer[in] the sample buffer of the calling thread
+	 */
+	template <typename SAMPLE>
+	MMINLINE void flushSamples(MM_EnvironmentBase *env, MM_ProfileSampleBuffer<SAMPLE> *buffer) { _profiles.flushSamples(env, buffer, this); }
+
+	/**
+	 * Count a sampled allocation in the profile of its site, see MM_SampledProfileTable::flushSamples().
+	 * @return false if the site has no profile and none could be inserted
+	 */
+	bool recordSample(MM_EnvironmentBase *env, MM_PretenureAllocationSample *sample);
+
+	/**
+	 * Count a sampled tenured object in the profile of its site, see MM_SampledProfileTable::flushSamples().
+	 * @return false if the site has no profile, objects tenured from sites the profile has no room for are of no interest
+	 */
+	bool recordSample(MM_EnvironmentBase *env, MM_PretenureTenureSample *sample);
+
+	/**
+	 * Pretenure the allocation sites that have earned it, once the Scavenger has flushed its samples.
+	 * Must be called by the main thread while no thread allocates.
+	 */
+	void publish(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide whether an object of the allocation site should be allocated in tenure space.
+	 * May be called concurrently with flushSamples(), but not with publish().
+	 * @param siteKey[in] the allocation site key, or NULL if the site is not known
+	 * @return true if the site is pretenured
+	 */
+	MMINLINE bool
+	shouldPretenure(void *siteKey)
+	{
+		if ((0 != _pretenuredSiteCount) && (NULL != siteKey)) {
+			SiteProfile *profile = _profiles.find(siteKey);
+			if (NULL != profile) {
+				return profile->pretenured;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Query the survival of an allocation site.
+	 * @param siteKey[in] the allocation site key
+	 * @param survivalRate[out] set to the percentage of the sampled allocations of the site that were tenured
+	 * @param pretenured[out] set to true if objects of the site are allocated in tenure space
+	 * @return false if the site has too few samples for a survival rate, true otherwise
+	 */
+	bool getSiteSurvivalRate(void *siteKey, uintptr_t *survivalRate, bool *pretenured);
+
+	MMINLINE uintptr_t getSiteCount() { return _profiles.getProfileCount(); }
+	MMINLINE uintptr_t getPretenuredSiteCount() { return _pretenuredSiteCount; }
+	MMINLINE uintptr_t getNewlyPretenuredSiteCount() { return _newlyPretenuredSiteCount; }
+	MMINLINE uintptr_t getDroppedSampleCount() { return _profiles.getDroppedSampleCount(); }
+
+	MM_PretenureProfiler(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _profiles()
+		, _candidates(NULL)
+		, _survivalThreshold(100)
+		, _pretenuredSiteCount(0)
+		, _newlyPretenuredSiteCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* PRETENUREPROFILER_HPP_ */
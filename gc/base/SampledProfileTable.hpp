@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(SAMPLEDPROFILETABLE_HPP_)
+#define SAMPLEDPROFILETABLE_HPP_
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+/* Samples a thread collects before handing them to a profile table. */
+#define PROFILE_SAMPLE_BUFFER_SIZE 64
+/* Profiles a table can hold, a power of two. Samples for further keys are dropped. */
+#define PROFILE_TABLE_SIZE 1024
+/* Entries probed to find (or insert) a key before giving up. */
+#define PROFILE_TABLE_MAXIMUM_PROBES 8
+
+/**
+ * Thread local buffer of samples, flushed to a MM_SampledProfileTable when full and whenever its owner
+ * needs the samples to be seen.
+ * @ingroup GC_Base_Core
+ */
+template <typename SAMPLE>
+struct MM_ProfileSampleBuffer {
+	uintptr_t count; /**< Samples in the buffer */
+	uintptr_t countdown; /**< Events to skip before the next one is sampled */
+	SAMPLE samples[PROFILE_SAMPLE_BUFFER_SIZE];
+};
+
+/**
+ * The part of a profile the table manages.
+ * @ingroup GC_Base_Core
+ */
+struct MM_SampledProfile {
+	void * volatile key; /**< Key of the profile, NULL for an unused entry. Published last when the entry is inserted */
+};
+
+/**
+ * Profiles keyed by address (classes, allocation sites), fed by samples that threads collect in a MM_ProfileSampleBuffer.
+ *
+ * Profiles live in a fixed size open addressed table that is never rehashed, so find() can probe it without locking
+ * while other threads insert profiles. Profiles are only inserted and updated under the table mutex, by flushSamples().
+ *
+ * PROFILE derives from MM_SampledProfile, and provides initialize(env), called before a profile is inserted, and
+ * tearDown(env), called for every inserted profile when the table is torn down.
+ * @ingroup GC_Base_Core
+ */
+template <typename PROFILE>
+class MM_SampledProfileTable
+{
+/* Data members */
+private:
+	omrthread_monitor_t _mutex; /**< Serializes updates of the profiles */
+	PROFILE *_profiles; /**< PROFILE_TABLE_SIZE entries */
+	uintptr_t _sampleRate; /**< One in this many events is sampled */
+	uintptr_t _profileCount; /**< Used entries of _profiles */
+	uintptr_t _droppedSamples; /**< Samples lost because the table was full */
+
+/* Methods */
+private:
+	MMINLINE uintptr_t
+	hashKey(void *key) const
+	{
+		/* keys are typically aligned addresses, discard the alignment bits before mixing */
+		return (((uintptr_t)key >> 3) * (uintptr_t)2654435761U) & (PROFILE_TABLE_SIZE - 1);
+	}
+
+public:
+	/**
+	 * @param mutexName[in] the name of the table mutex
+	 * @param sampleRate[in] one in this many events is sampled, at least 1
+	 * @return false if the table or its mutex could not be allocated
+	 */
+	bool
+	initialize(MM_EnvironmentBase *env, const char *mutexName, uintptr_t sampleRate)
+	{
+		_sampleRate = sampleRate;
+
+		if (0 != omrthread_monitor_init_with_name(&_mutex, 0, mutexName)) {
+			return false;
+		}
+
+		uintptr_t tableSize = sizeof(PROFILE) * PROFILE_TABLE_SIZE;
+		_profiles = (PROFILE *)env->getForge()->allocate(tableSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _profiles) {
+			return false;
+		}
+		memset((void *)_profiles, 0, tableSize);
+
+		return true;
+	}
+
+	void
+	tearDown(MM_EnvironmentBase *env)
+	{
+		if (NULL != _profiles) {
+			for (uintptr_t i = 0; i < PROFILE_TABLE_SIZE; i++) {
+				if (NULL != _profiles[i].key) {
+					_profiles[i].tearDown(env);
+				}
+			}
+			env->getForge()->free(_profiles);
+			_profiles = NULL;
+		}
+
+		if (NULL != _mutex) {
+			omrthread_monitor_destroy(_mutex);
+			_mutex = NULL;
+		}
+	}
+
+	/**
+	 * Decide whether the next event seen by the thread owning the buffer should be sampled.
+	 * @param buffer[in] the sample buffer of the calling thread
+	 * @return true once every sampleRate calls
+	 */
+	template <typename SAMPLE>
+	MMINLINE bool
+	shouldSample(MM_ProfileSampleBuffer<SAMPLE> *buffer)
+	{
+		if (0 == buffer->countdown) {
+			buffer->countdown = _sampleRate - 1;
+			return true;
+		}
+		buffer->countdown -= 1;
+		return false;
+	}
+
+	/**
+	 * Add a sample to the buffer, flushing the buffer when it fills.
+	 * @param buffer[in] the sample buffer of the calling thread
+	 * @param recorder[in] the profiler, see flushSamples()
+	 */
+	template <typename SAMPLE, typename RECORDER>
+	MMINLINE void
+	addSample(MM_EnvironmentBase *env, MM_ProfileSampleBuffer<SAMPLE> *buffer, const SAMPLE &sample, RECORDER *recorder)
+	{
+		buffer->samples[buffer->count] = sample;
+		buffer->count += 1;
+		if (PROFILE_SAMPLE_BUFFER_SIZE == buffer->count) {
+			flushSamples(env, buffer, recorder);
+		}
+	}
+
+	/**
+	 * Hand the samples in the buffer to recorder->recordSample(env, sample), under the table mutex, and empty the buffer.
+	 * recordSample() returns false when the sample is dropped. May be called by several threads concurrently.
+	 * @param buffer[in] the sample buffer of the calling thread
+	 * @param recorder[in] the profiler
+	 */
+	template <typename SAMPLE, typename RECORDER>
+	void
+	flushSamples(MM_EnvironmentBase *env, MM_ProfileSampleBuffer<SAMPLE> *buffer, RECORDER *recorder)
+	{
+		if (0 == buffer->count) {
+			return;
+		}
+
+		omrthread_monitor_enter(_mutex);
+		for (uintptr_t i = 0; i < buffer->count; i++) {
+			if (!recorder->recordSample(env, &buffer->samples[i])) {
+				_droppedSamples += 1;
+			}
+		}
+		omrthread_monitor_exit(_mutex);
+
+		buffer->count = 0;
+	}
+
+	/**
+	 * Find the profile of a key. May be called without the table mutex, concurrently with insertions.
+	 * @param key[in] the key, not NULL
+	 * @return the profile, or NULL if the key has none
+	 */
+	MMINLINE PROFILE *
+	find(void *key)
+	{
+		uintptr_t index = hashKey(key);
+		for (uintptr_t probe = 0; probe < PROFILE_TABLE_MAXIMUM_PROBES; probe++) {
+			PROFILE *profile = &_profiles[index];
+			void *entryKey = profile->key;
+			if (entryKey == key) {
+				return profile;
+			}
+			if (NULL == entryKey) {
+				break;
+			}
+			index = (index + 1) & (PROFILE_TABLE_SIZE - 1);
+		}
+		return NULL;
+	}
+
+	/**
+	 * Find the profile of a key, inserting one if the key has none. Must be called under the table mutex.
+	 * @param key[in] the key, not NULL
+	 * @return the profile, or NULL if the table has no room for it or it could not be initialized
+	 */
+	PROFILE *
+	findOrInsert(MM_EnvironmentBase *env, void *key)
+	{
+		uintptr_t index = hashKey(key);
+		for (uintptr_t probe = 0; probe < PROFILE_TABLE_MAXIMUM_PROBES; probe++) {
+			PROFILE *profile = &_profiles[index];
+			if (key == profile->key) {
+				return profile;
+			}
+			if (NULL == profile->key) {
+				/* a profile is only ever inserted under _mutex, but readers probe without it */
+				if (!profile->initialize(env)) {
+					return NULL;
+				}
+				MM_AtomicOperations::writeBarrier();
+				profile->key = key;
+				_profileCount += 1;
+				return profile;
+			}
+			index = (index + 1) & (PROFILE_TABLE_SIZE - 1);
+		}
+		return NULL;
+	}
+
+	/**
+	 * Serialize with flushSamples(), to read profiles while other threads may update them.
+	 */
+	MMINLINE void lock() { omrthread_monitor_enter(_mutex); }
+	MMINLINE void unlock() { omrthread_monitor_exit(_mutex); }
+
+	/**
+	 * @param index[in] less than PROFILE_TABLE_SIZE
+	 * @return the entry at the index, unused if its key is NULL
+	 */
+	MMINLINE PROFILE *getEntry(uintptr_t index) { return &_profiles[index]; }
+
+	MMINLINE uintptr_t getProfileCount() { return _profileCount; }
+	MMINLINE uintptr_t getDroppedSampleCount() { return _droppedSamples; }
+
+	MM_SampledProfileTable()
+		: _mutex(NULL)
+		, _profiles(NULL)
+		, _sampleRate(1)
+		, _profileCount(0)
+		, _droppedSamples(0)
+	{
+	}
+};
+
+#endif /* SAMPLEDPROFILETABLE_HPP_ */
@@ -37,6 +37,12 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCSTRIPEDCOMPACTION "-Xgc:stripedCompaction"
+#define OMR_XGCSTRIPEDCOMPACTION_LENGTH 22
+#define OMR_XGCPARTIALCOMPACTIONBUDGET "-Xgc:partialCompactionBudget="
+#define OMR_XGCPARTIALCOMPACTIONBUDGET_LENGTH 29
+#define OMR_XGCPARTIALCOMPACTION "-Xgc:partialCompaction"
+#define OMR_XGCPARTIALCOMPACTION_LENGTH 22
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +54,90 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORKSTEALING "-Xgc:workStealing"
+#define OMR_XGCWORKSTEALING_LENGTH 17
+#define OMR_XGCNUMAAFFINITY "-Xgc:numaAffinity"
+#define OMR_XGCNUMAAFFINITY_LENGTH 17
+#define OMR_XGCADAPTIVETASKTHREADS "-Xgc:adaptiveTaskThreads"
+#define OMR_XGCADAPTIVETASKTHREADS_LENGTH 24
+#define OMR_XGCSPINPARKBARRIER "-Xgc:spinParkBarrier"
+#define OMR_XGCSPINPARKBARRIER_LENGTH 20
+#define OMR_XGCSYNCBARRIERSPINCOUNT "-Xgc:syncBarrierSpinCount="
+#define OMR_XGCSYNCBARRIERSPINCOUNT_LENGTH 26
+#define OMR_XGCLAZYSWEEP "-Xgc:lazySweep"
+#define OMR_XGCLAZYSWEEP_LENGTH 14
+#define OMR_XGCFREECHUNKCACHE "-Xgc:freeChunkCache"
+#define OMR_XGCFREECHUNKCACHE_LENGTH 19
+#define OMR_XGCALLOCATIONLATENCYSTATS "-Xgc:allocationLatencyStats"
+#define OMR_XGCALLOCATIONLATENCYSTATS_LENGTH 27
+#define OMR_XGCADAPTIVETLHSIZING "-Xgc:adaptiveTLHSizing"
+#define OMR_XGCADAPTIVETLHSIZING_LENGTH 22
+#define OMR_XGCVERBOSETLHSTATS "-Xgc:verboseTLHStats"
+#define OMR_XGCVERBOSETLHSTATS_LENGTH 20
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+#define OMR_XGCBATCHCLEARTLH "-Xgc:batchClearTLH"
+#define OMR_XGCBATCHCLEARTLH_LENGTH 18
+#define OMR_XGCTLHZEROINGTHRESHOLD "-Xgc:tlhZeroingThreshold="
+#define OMR_XGCTLHZEROINGTHRESHOLD_LENGTH 25
+#define OMR_XGCTLHZEROING "-Xgc:tlhZeroing="
+#define OMR_XGCTLHZEROING_LENGTH 16
+#define OMR_XGCBACKGROUNDTLHZEROING "-Xgc:backgroundTLHZeroing"
+#define OMR_XGCBACKGROUNDTLHZEROING_LENGTH 25
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+#define OMR_XGCLOCKFREEREGIONQUEUES "-Xgc:lockFreeRegionQueues"
+#define OMR_XGCLOCKFREEREGIONQUEUES_LENGTH 25
+#define OMR_XGCSIZECLASSHISTOGRAM "-Xgc:sizeClassHistogram="
+#define OMR_XGCSIZECLASSHISTOGRAM_LENGTH 24
+#define OMR_XGCSIZECLASSTABLE "-Xgc:sizeClassTable="
+#define OMR_XGCSIZECLASSTABLE_LENGTH 20
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#define OMR_XGCSCAVENGERPREFETCHWINDOW "-Xgc:scavengerPrefetchWindow="
+#define OMR_XGCSCAVENGERPREFETCHWINDOW_LENGTH 29
+#define OMR_XGCLEARNHOTFIELDS "-Xgc:learnHotFields"
+#define OMR_XGCLEARNHOTFIELDS_LENGTH 19
+#define OMR_XGCLEARNEDHOTFIELDCOUNT "-Xgc:learnedHotFieldCount="
+#define OMR_XGCLEARNEDHOTFIELDCOUNT_LENGTH 26
+#define OMR_XGCHOTFIELDSAMPLERATE "-Xgc:hotFieldSampleRate="
+#define OMR_XGCHOTFIELDSAMPLERATE_LENGTH 24
+#define OMR_XGCREMEMBEREDSETSUMMARYTHRESHOLD "-Xgc:rememberedSetSummaryThreshold="
+#define OMR_XGCREMEMBEREDSETSUMMARYTHRESHOLD_LENGTH 35
+#define OMR_XGCPRETENURESURVIVALTHRESHOLD "-Xgc:pretenureSurvivalThreshold="
+#define OMR_XGCPRETENURESURVIVALTHRESHOLD_LENGTH 32
+#define OMR_XGCPRETENURESAMPLERATE "-Xgc:pretenureSampleRate="
+#define OMR_XGCPRETENURESAMPLERATE_LENGTH 25
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX)
+#define OMR_XGCCONCURRENTSCAVENGEPAGEPROTECTION "-Xgc:concurrentScavengePageProtection"
+#define OMR_XGCCONCURRENTSCAVENGEPAGEPROTECTION_LENGTH 37
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX) */
+#if defined(OMR_GC_REALTIME)
+#define OMR_XGCSATBBARRIERPACKETS "-Xgc:sATBBarrierPackets="
+#define OMR_XGCSATBBARRIERPACKETS_LENGTH 24
+#define OMR_XGCSATBBARRIERFLUSHBATCH "-Xgc:sATBBarrierFlushBatch="
+#define OMR_XGCSATBBARRIERFLUSHBATCH_LENGTH 27
+#define OMR_XGCSATBBARRIERFILTER "-Xgc:sATBBarrierFilter"
+#define OMR_XGCSATBBARRIERFILTER_LENGTH 22
+#endif /* defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCARDTABLESUMMARY "-Xgc:cardTableSummary"
+#define OMR_XGCCARDTABLESUMMARY_LENGTH 21
+#define OMR_XGCCONCURRENTPACERSLACK "-Xgc:concurrentPacerSlack="
+#define OMR_XGCCONCURRENTPACERSLACK_LENGTH 26
+#define OMR_XGCCONCURRENTPACER "-Xgc:concurrentPacer"
+#define OMR_XGCCONCURRENTPACER_LENGTH 20
+#define OMR_XGCCONCURRENTBACKGROUNDCPUPERCENT "-Xgc:concurrentBackgroundCPUPercent="
+#define OMR_XGCCONCURRENTBACKGROUNDCPUPERCENT_LENGTH 36
+#define OMR_XGCCONCURRENTBACKGROUNDMARK "-Xgc:concurrentBackgroundMark"
+#define OMR_XGCCONCURRENTBACKGROUNDMARK_LENGTH 29
+#define OMR_XGCCONCURRENTBACKGROUND "-Xgc:concurrentBackground="
+#define OMR_XGCCONCURRENTBACKGROUND_LENGTH 26
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +352,17 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCSTRIPEDCOMPACTION, OMR_XGCSTRIPEDCOMPACTION_LENGTH)) {
+		extensions->stripedCompaction = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCPARTIALCOMPACTIONBUDGET, OMR_XGCPARTIALCOMPACTIONBUDGET_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCPARTIALCOMPACTIONBUDGET_LENGTH, &extensions->partialCompactionBudget)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPARTIALCOMPACTION, OMR_XGCPARTIALCOMPACTION_LENGTH)) {
+		extensions->partialCompaction = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +375,189 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKSTEALING, OMR_XGCWORKSTEALING_LENGTH)) {
+		extensions->workStealingMarking = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMAAFFINITY, OMR_XGCNUMAAFFINITY_LENGTH)) {
+		extensions->numaAwareGCWorkers = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVETASKTHREADS, OMR_XGCADAPTIVETASKTHREADS_LENGTH)) {
+		extensions->adaptiveTaskThreading = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSPINPARKBARRIER, OMR_XGCSPINPARKBARRIER_LENGTH)) {
+		extensions->gcThreadSyncBarrier = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSYNCBARRIERSPINCOUNT, OMR_XGCSYNCBARRIERSPINCOUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSYNCBARRIERSPINCOUNT_LENGTH, &extensions->gcThreadSyncBarrierSpinCount)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCLAZYSWEEP, OMR_XGCLAZYSWEEP_LENGTH)) {
+		extensions->lazySweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCFREECHUNKCACHE, OMR_XGCFREECHUNKCACHE_LENGTH)) {
+		extensions->freeChunkCache = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATIONLATENCYSTATS, OMR_XGCALLOCATIONLATENCYSTATS_LENGTH)) {
+		extensions->allocationLatencyStats = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVETLHSIZING, OMR_XGCADAPTIVETLHSIZING_LENGTH)) {
+		extensions->adaptiveTLHSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSETLHSTATS, OMR_XGCVERBOSETLHSTATS_LENGTH)) {
+		extensions->verboseTLHStats = true;
+	}
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	else if (0 == strncmp(option, OMR_XGCBATCHCLEARTLH, OMR_XGCBATCHCLEARTLH_LENGTH)) {
+		extensions->batchClearTLH = 1;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHZEROINGTHRESHOLD, OMR_XGCTLHZEROINGTHRESHOLD_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCTLHZEROINGTHRESHOLD_LENGTH, &extensions->tlhZeroingThreshold)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHZEROING, OMR_XGCTLHZEROING_LENGTH)) {
+		char *strategy = option + OMR_XGCTLHZEROING_LENGTH;
+		if (0 == strcmp(strategy, "memset")) {
+			extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_DEFAULT;
+		} else if (0 == strcmp(strategy, "nonTemporal")) {
+			extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_NON_TEMPORAL;
+		} else if (0 == strcmp(strategy, "repStosb")) {
+			extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_REP_STOSB;
+		} else if (0 == strcmp(strategy, "auto")) {
+			extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_NON_TEMPORAL;
+#if defined(OMR_ARCH_X86)
+			/* rep stosb is only as fast as streaming stores on processors with enhanced rep movsb/stosb */
+			OMRProcessorDesc processorDescription;
+			if ((0 == omrsysinfo_get_processor_description(&processorDescription))
+				&& (TRUE == omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_ERMSB))
+			) {
+				extensions->tlhZeroingStrategy = MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_REP_STOSB;
+			}
+#endif /* defined(OMR_ARCH_X86) */
+		} else {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCBACKGROUNDTLHZEROING, OMR_XGCBACKGROUNDTLHZEROING_LENGTH)) {
+		extensions->backgroundTLHZeroing = true;
+	}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+	else if (0 == strncmp(option, OMR_XGCLOCKFREEREGIONQUEUES, OMR_XGCLOCKFREEREGIONQUEUES_LENGTH)) {
+		extensions->lockFreeRegionQueues = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZECLASSHISTOGRAM, OMR_XGCSIZECLASSHISTOGRAM_LENGTH)) {
+		extensions->sizeClassHistogramFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XGCSIZECLASSHISTOGRAM_LENGTH)+1, OMRMEM_CATEGORY_MM);
+		if (NULL == extensions->sizeClassHistogramFileName) {
+			result = false;
+		} else {
+			strcpy(extensions->sizeClassHistogramFileName, option + OMR_XGCSIZECLASSHISTOGRAM_LENGTH);
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZECLASSTABLE, OMR_XGCSIZECLASSTABLE_LENGTH)) {
+		extensions->sizeClassTableFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XGCSIZECLASSTABLE_LENGTH)+1, OMRMEM_CATEGORY_MM);
+		if (NULL == extensions->sizeClassTableFileName) {
+			result = false;
+		} else {
+			strcpy(extensions->sizeClassTableFileName, option + OMR_XGCSIZECLASSTABLE_LENGTH);
+		}
+	}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERPREFETCHWINDOW, OMR_XGCSCAVENGERPREFETCHWINDOW_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGERPREFETCHWINDOW_LENGTH, &extensions->scavengerPrefetchWindowSize)) {
+			result = false;
+		} else if (extensions->scavengerPrefetchWindowSize > MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE) {
+			extensions->scavengerPrefetchWindowSize = MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCLEARNEDHOTFIELDCOUNT, OMR_XGCLEARNEDHOTFIELDCOUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCLEARNEDHOTFIELDCOUNT_LENGTH, &extensions->learnedHotFieldCount)) {
+			result = false;
+		} else if (extensions->learnedHotFieldCount > MAXIMUM_LEARNED_HOT_FIELD_COUNT) {
+			extensions->learnedHotFieldCount = MAXIMUM_LEARNED_HOT_FIELD_COUNT;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHOTFIELDSAMPLERATE, OMR_XGCHOTFIELDSAMPLERATE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCHOTFIELDSAMPLERATE_LENGTH, &extensions->hotFieldSampleRate)) || (0 == extensions->hotFieldSampleRate)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCLEARNHOTFIELDS, OMR_XGCLEARNHOTFIELDS_LENGTH)) {
+		extensions->learnHotFields = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCREMEMBEREDSETSUMMARYTHRESHOLD, OMR_XGCREMEMBEREDSETSUMMARYTHRESHOLD_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCREMEMBEREDSETSUMMARYTHRESHOLD_LENGTH, &extensions->rememberedSetSummaryThreshold)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPRETENURESURVIVALTHRESHOLD, OMR_XGCPRETENURESURVIVALTHRESHOLD_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCPRETENURESURVIVALTHRESHOLD_LENGTH, &extensions->pretenureSurvivalThreshold)) || (100 < extensions->pretenureSurvivalThreshold)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPRETENURESAMPLERATE, OMR_XGCPRETENURESAMPLERATE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCPRETENURESAMPLERATE_LENGTH, &extensions->pretenureSampleRate)) || (0 == extensions->pretenureSampleRate)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTSCAVENGEPAGEPROTECTION, OMR_XGCCONCURRENTSCAVENGEPAGEPROTECTION_LENGTH)) {
+		extensions->concurrentScavenger = true;
+		extensions->concurrentScavengerPageProtection = true;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(LINUX) */
+#if defined(OMR_GC_REALTIME)
+	else if (0 == strncmp(option, OMR_XGCSATBBARRIERPACKETS, OMR_XGCSATBBARRIERPACKETS_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSATBBARRIERPACKETS_LENGTH, &extensions->sATBBarrierPackets)) || (0 == extensions->sATBBarrierPackets)) {
+			result = false;
+		} else if (extensions->sATBBarrierPackets > SATB_BARRIER_PACKETS_MAXIMUM) {
+			extensions->sATBBarrierPackets = SATB_BARRIER_PACKETS_MAXIMUM;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSATBBARRIERFLUSHBATCH, OMR_XGCSATBBARRIERFLUSHBATCH_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSATBBARRIERFLUSHBATCH_LENGTH, &extensions->sATBBarrierFlushBatch)) || (0 == extensions->sATBBarrierFlushBatch)) {
+			result = false;
+		} else if (extensions->sATBBarrierFlushBatch > SATB_BARRIER_PACKETS_MAXIMUM) {
+			extensions->sATBBarrierFlushBatch = SATB_BARRIER_PACKETS_MAXIMUM;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSATBBARRIERFILTER, OMR_XGCSATBBARRIERFILTER_LENGTH)) {
+		extensions->sATBBarrierFilter = true;
+	}
+#endif /* defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCARDTABLESUMMARY, OMR_XGCCARDTABLESUMMARY_LENGTH)) {
+		extensions->cardTableSummary = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTPACERSLACK, OMR_XGCCONCURRENTPACERSLACK_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCCONCURRENTPACERSLACK_LENGTH, &extensions->concurrentPacerSlack)) || (100 <= extensions->concurrentPacerSlack)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTPACER, OMR_XGCCONCURRENTPACER_LENGTH)) {
+		extensions->concurrentPacer = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTBACKGROUNDCPUPERCENT, OMR_XGCCONCURRENTBACKGROUNDCPUPERCENT_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCCONCURRENTBACKGROUNDCPUPERCENT_LENGTH, &extensions->concurrentBackgroundCPUPercent)) || (0 == extensions->concurrentBackgroundCPUPercent) || (100 < extensions->concurrentBackgroundCPUPercent)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTBACKGROUNDMARK, OMR_XGCCONCURRENTBACKGROUNDMARK_LENGTH)) {
+		extensions->concurrentBackgroundMark = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTBACKGROUND, OMR_XGCCONCURRENTBACKGROUND_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCCONCURRENTBACKGROUND_LENGTH, &extensions->concurrentBackground)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
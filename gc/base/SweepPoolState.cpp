@@ -84,7 +84,10 @@ MM_SweepPoolState::MM_SweepPoolState(MM_MemoryPool *memoryPool) :
 	_sweepFreeBytes(0),
 	_sweepFreeHoles(0),
 	_largestFreeEntry(0),
-	_previousLargestFreeEntry(NULL)
+	_previousLargestFreeEntry(NULL),
+	_lazySweepChunk(NULL),
+	_lazySweepBytes(0),
+	_lazySweepFreeListTail(NULL)
 {
 	_typeId = __FUNCTION__;
 }
@@ -57,6 +57,10 @@ public:
 	uintptr_t _sweepFreeHoles;  /**< Number of free entries connected */
 	uintptr_t _largestFreeEntry;  /**< Largest free entry found during the connection phase of a sweep */
 	MM_HeapLinkedFreeHeader *_previousLargestFreeEntry; /**< previous free entry of the Largest Free Entry */
+
+	MM_ParallelSweepChunk *_lazySweepChunk;  /**< Next chunk of the pool a lazy sweep has left to sweep and connect, NULL if the pool is completely swept */
+	uintptr_t _lazySweepBytes;  /**< Heap bytes of the pool a lazy sweep has left to sweep and connect */
+	MM_HeapLinkedFreeHeader *_lazySweepFreeListTail;  /**< Tail of the free list a lazy sweep resumes connecting after, kept current by allocations from the pool */
 	
 	/**
 	 * Build a MM_SweepPoolState object within the memory supplied
@@ -84,6 +88,7 @@ public:
 
 	/**
 	 * Initialize the data for sweep
+	 * @note lazy sweep progress is owned by the sweep scheme, and is not reset here
 	 */
 	virtual void initializeForSweep(MM_EnvironmentBase *env) {
 		_connectPreviousFreeEntry = NULL;
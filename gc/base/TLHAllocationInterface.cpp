@@ -43,6 +43,7 @@
 #include "GlobalCollector.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "PretenureProfiler.hpp"
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 /**
@@ -96,6 +97,11 @@ MM_TLHAllocationInterface::initialize(MM_EnvironmentBase *env)
 void
 MM_TLHAllocationInterface::tearDown(MM_EnvironmentBase *env)
 {
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/* the background zeroing thread must not be left with a request of the thread going away */
+	_tlhAllocationSupport.abandonNextTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	if (NULL != _frequentObjectsStats) {
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
@@ -166,10 +172,28 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 		Assert_MM_true(memorySpace->getTenureMemorySubSpace() == memorySpace->getDefaultMemorySubSpace());
 	}
 
+	bool pretenured = false;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MM_PretenureProfiler *pretenureProfiler = extensions->pretenureProfiler;
+	if ((NULL != pretenureProfiler) && !allocDescription->getTenuredFlag()) {
+		void *siteKey = allocDescription->getAllocationSiteKey();
+		if (NULL != siteKey) {
+			if (pretenureProfiler->shouldPretenure(siteKey)) {
+				/* objects of the site are expected to be tenured anyway, skip copying them through the nursery */
+				allocDescription->setTenuredFlag();
+				pretenured = true;
+			} else if (pretenureProfiler->shouldSample(&_pretenureSamples)) {
+				pretenureProfiler->addSample(env, &_pretenureSamples, siteKey);
+			}
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	/* Record the memory space from which the allocation takes place in the AD */
 	allocDescription->setMemorySpace(memorySpace);
 	if (allocDescription->getTenuredFlag()) {
-		Assert_MM_true(shouldCollectOnFailure);
+		/* only a pretenured allocation may fail in tenure space without collecting, the nursery is left to the retry */
+		Assert_MM_true(shouldCollectOnFailure || pretenured);
 		MM_AllocationContext *cac = env->getCommonAllocationContext();
 		if (NULL != cac) {
 			result = cac->allocateObject(env, allocDescription, shouldCollectOnFailure);
@@ -297,6 +321,12 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != extensions->pretenureProfiler) {
+		extensions->pretenureProfiler->flushSamples(env, &_pretenureSamples);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 }
 
 void
@@ -309,4 +339,21 @@ MM_TLHAllocationInterface::restartCache(MM_EnvironmentBase *env)
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 }
 
+bool
+MM_TLHAllocationInterface::getTLHRefreshStats(uintptr_t *refreshCount, uintptr_t *refreshBytes, uintptr_t *discardedBytes, uintptr_t *refreshSize)
+{
+	*refreshCount = _tlhAllocationSupport._refreshCount;
+	*refreshBytes = _tlhAllocationSupport._refreshBytes;
+	*discardedBytes = _tlhAllocationSupport._discardedBytes;
+	*refreshSize = _tlhAllocationSupport.getRefreshSize();
+
+#if defined(OMR_GC_NON_ZERO_TLH)
+	*refreshCount += _tlhAllocationSupportNonZero._refreshCount;
+	*refreshBytes += _tlhAllocationSupportNonZero._refreshBytes;
+	*discardedBytes += _tlhAllocationSupportNonZero._discardedBytes;
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	return true;
+}
+
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
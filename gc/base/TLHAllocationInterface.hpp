@@ -33,6 +33,7 @@
 #include "omrmodroncore.h"
 
 #include "ObjectAllocationInterface.hpp"
+#include "PretenureProfiler.hpp"
 #include "TLHAllocationSupport.hpp"
 
 class MM_AllocateDescription;
@@ -63,6 +64,9 @@ private:
 
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MM_PretenureAllocationSampleBuffer _pretenureSamples; /**< Allocation sites sampled by this thread that are not yet added to the site profiles */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 public:
 	static MM_TLHAllocationInterface *newInstance(MM_EnvironmentBase *env);
@@ -77,6 +81,8 @@ public:
 
 	virtual void flushCache(MM_EnvironmentBase *env);
 	virtual void restartCache(MM_EnvironmentBase *env);
+
+	virtual bool getTLHRefreshStats(uintptr_t *refreshCount, uintptr_t *refreshBytes, uintptr_t *discardedBytes, uintptr_t *refreshSize);
 	
 	/* BEN TODO: Collapse the env->enable/disableInlineTLHAllocate with these enable/disableCachedAllocations */
 	virtual void enableCachedAllocations(MM_EnvironmentBase* env) { _cachedAllocationsEnabled = true; }
@@ -106,6 +112,10 @@ private:
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		_pretenureSamples.count = 0;
+		_pretenureSamples.countdown = 0;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 		_tlhAllocationSupportNonZero._objectAllocationInterface = this;
@@ -92,10 +92,17 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 {
 	 MM_GCExtensionsBase *extensions = env->getExtensions();
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	abandonNextTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	/* Clear current information accumulated */
 	setAllZeroes();
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	_allocationRate = 0;
+	_maximumRefreshSize = extensions->tlhMaximumSize;
+	resetRefreshStats();
 }
 
 void
@@ -110,7 +117,49 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->adaptiveTLHSizing) {
+		_tlh->refreshSize = adaptRefreshSize(env);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+	resetRefreshStats();
+}
+
+uintptr_t
+MM_TLHAllocationSupport::adaptRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	uintptr_t allocatedBytes = (_refreshBytes > _discardedBytes) ? (_refreshBytes - _discardedBytes) : 0;
+	if (0 == _allocationRate) {
+		_allocationRate = allocatedBytes;
+	} else {
+		_allocationRate = (uintptr_t)MM_Math::weightedAverage((double)_allocationRate, (double)allocatedBytes, TLH_ADAPTIVE_ALLOCATION_RATE_WEIGHT);
+	}
+
+	/* Survivors of the last scavenge take nursery space away from allocation. Scavenges do not attribute
+	 * survivors to threads, so all threads share the survival rate of the nursery.
+	 */
+	MM_MemorySubSpace *subspace = _objectAllocationInterface->getOwningEnv()->getMemorySpace()->getDefaultMemorySubSpace();
+	uintptr_t nurserySize = subspace->getActiveMemorySize(MEMORY_TYPE_NEW);
+	if (0 == nurserySize) {
+		nurserySize = subspace->getActiveMemorySize();
+	}
+	double survivalRate = 0.0;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (extensions->scavengerEnabled) {
+		uintptr_t bytesAllocated = extensions->allocationStats.bytesAllocated();
+		uintptr_t bytesSurvived = extensions->scavengerStats._flipBytes + extensions->scavengerStats._tenureAggregateBytes;
+		if (0 != bytesAllocated) {
+			survivalRate = OMR_MIN(1.0, (double)bytesSurvived / (double)bytesAllocated);
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	uintptr_t maximumRefreshSize = (uintptr_t)((double)nurserySize * (1.0 - survivalRate)) / TLH_ADAPTIVE_NURSERY_FRACTION;
+	_maximumRefreshSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, OMR_MAX(maximumRefreshSize, extensions->tlhInitialSize));
+
+	uintptr_t refreshSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, _allocationRate / TLH_ADAPTIVE_REFRESHES_PER_CYCLE);
+	return OMR_MIN(OMR_MAX(refreshSize, extensions->tlhInitialSize), _maximumRefreshSize);
 }
 
 bool
@@ -124,13 +173,13 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	 */
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
 	uintptr_t tlhMinimumSize = extensions->tlhMinimumSize;
-	uintptr_t tlhMaximumSize = extensions->tlhMaximumSize;
+	uintptr_t tlhMaximumSize = getMaximumRefreshSize(extensions);
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
 		/* increase thread hungriness if we did not refresh */
 		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
-			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+			growRefreshSize(extensions);
 		}
 		return false;
 	}
@@ -144,6 +193,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	}
 
 	stats->_tlhDiscardedBytes += getRemainingSize();
+	_discardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
 
@@ -193,6 +243,8 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		stats->_tlhRefreshCountReused += 1;
 		stats->_tlhAllocatedReused += getSize();
 		stats->_tlhDiscardedBytes -= getSize();
+		/* the cached TLH may have been discarded before the stats were last reset */
+		_discardedBytes -= OMR_MIN(_discardedBytes, getSize());
 
 		didRefresh = true;
 	} else {
@@ -214,9 +266,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 			if (_zeroTLH) {
 				if (0 != extensions->batchClearTLH) {
-					void *base = getBase();
-					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					zeroFreshTLH(env, allocDescription);
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -252,12 +302,14 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		if (0 < getSize()) {
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
+			_refreshCount += 1;
+			_refreshBytes += getSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				growRefreshSize(extensions);
 			}
 			reserveTLHTopForGC(env);
 		}
@@ -324,12 +376,89 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	_discardedBytes += getRemainingSize();
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
 	clear(env);
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	abandonNextTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+}
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+void
+MM_TLHAllocationSupport::zeroFreshTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_TLHZeroing *tlhZeroing = extensions->tlhZeroing;
+	void *base = getBase();
+	void *top = getTop();
+	uintptr_t size = (uintptr_t)top - (uintptr_t)base;
+	/* the TLH the thread is left with must still satisfy the allocation that caused the refresh */
+	uintptr_t sizeRequired = allocDescription->getContiguousBytes();
+	uintptr_t firstSize = MM_Math::roundToFloor(extensions->getObjectAlignmentInBytes(), size / 2);
+
+	if ((NULL == tlhZeroing) || (0 == size) || (size < extensions->tlhZeroingThreshold)) {
+		MM_TLHZeroing::zeroTLH(extensions, base, size);
+	} else if (NULL != _nextTLH.base) {
+		void *nextBase = _nextTLH.base;
+		void *nextTop = _nextTLH.top;
+		if (((uintptr_t)nextTop - (uintptr_t)nextBase) < sizeRequired) {
+			/* the queued TLH is too small for this allocation, keep it for the next refresh */
+			MM_TLHZeroing::zeroTLH(extensions, base, size);
+		} else {
+			/* the queued TLH, most likely zeroed by now, replaces the fresh one, which is queued in its place */
+			if (!tlhZeroing->claim(&_nextTLH)) {
+				MM_TLHZeroing::zeroTLH(extensions, nextBase, (uintptr_t)nextTop - (uintptr_t)nextBase);
+			}
+			_nextTLH.base = NULL;
+			_nextTLH.top = NULL;
+
+			MM_MemorySubSpace *memorySubSpace = getMemorySubSpace();
+			MM_MemoryPool *memoryPool = getMemoryPool();
+			setupTLH(env, nextBase, nextTop, _nextTLHMemorySubSpace, _nextTLHMemoryPool);
+			queueNextTLH(env, base, top, memorySubSpace, memoryPool);
+		}
+	} else if (firstSize < sizeRequired) {
+		/* half of the fresh TLH is too small for this allocation */
+		MM_TLHZeroing::zeroTLH(extensions, base, size);
+	} else {
+		/* first refresh since the caches were flushed: zero the first half now and queue the second */
+		void *middle = (void *)((uintptr_t)base + firstSize);
+		MM_TLHZeroing::zeroTLH(extensions, base, firstSize);
+		setTop(middle);
+		queueNextTLH(env, middle, top, getMemorySubSpace(), getMemoryPool());
+	}
 }
 
+void
+MM_TLHAllocationSupport::queueNextTLH(MM_EnvironmentBase *env, void *base, void *top, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
+{
+	if (env->getExtensions()->tlhZeroing->post(&_nextTLH, base, top)) {
+		_nextTLHMemorySubSpace = memorySubSpace;
+		_nextTLHMemoryPool = memoryPool;
+	} else {
+		memoryPool->abandonTlhHeapChunk(base, top);
+	}
+}
+
+void
+MM_TLHAllocationSupport::abandonNextTLH(MM_EnvironmentBase *env)
+{
+	if (NULL != _nextTLH.base) {
+		env->getExtensions()->tlhZeroing->claim(&_nextTLH);
+		_nextTLHMemoryPool->abandonTlhHeapChunk(_nextTLH.base, _nextTLH.top);
+		_nextTLH.base = NULL;
+		_nextTLH.top = NULL;
+		_nextTLHMemorySubSpace = NULL;
+		_nextTLHMemoryPool = NULL;
+	}
+}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 void
 MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
 {
@@ -38,6 +38,7 @@
 #include "EnvironmentBase.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LanguageThreadLocalHeap.hpp"
+#include "TLHZeroing.hpp"
 #if defined(OMR_GC_OBJECT_MAP)
 #include "ObjectMap.hpp"
 #endif /* defined(OMR_GC_OBJECT_MAP) */
@@ -50,6 +51,13 @@ struct OMR_VMThread;
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 
+/* With -Xgc:adaptiveTLHSizing, the weight of the previous cycles in a thread's average TLH allocation per cycle */
+#define TLH_ADAPTIVE_ALLOCATION_RATE_WEIGHT 0.5
+/* A thread is sized to refresh its TLH this many times a cycle */
+#define TLH_ADAPTIVE_REFRESHES_PER_CYCLE 32
+/* No TLH is larger than this fraction of the nursery left to allocation by survivors */
+#define TLH_ADAPTIVE_NURSERY_FRACTION 64
+
 class MM_HeapLinkedFreeHeaderTLH : public MM_HeapLinkedFreeHeader
 {
 public:
@@ -84,6 +92,18 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uintptr_t _refreshCount; /**< TLH refreshes since the cache was last restarted */
+	uintptr_t _refreshBytes; /**< Bytes of the TLHs of those refreshes */
+	uintptr_t _discardedBytes; /**< Bytes of those TLHs left unused */
+	uintptr_t _allocationRate; /**< Bytes allocated in TLHs per cycle, averaged over cycles, with -Xgc:adaptiveTLHSizing */
+	uintptr_t _maximumRefreshSize; /**< Largest refresh size for the current cycle, with -Xgc:adaptiveTLHSizing */
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	MM_TLHZeroingRequest _nextTLH; /**< TLH zeroed in the background to replace the current one, with -Xgc:backgroundTLHZeroing */
+	MM_MemorySubSpace *_nextTLHMemorySubSpace; /**< The memory subspace of the next TLH */
+	MM_MemoryPool *_nextTLHMemoryPool; /**< The memory pool of the next TLH */
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 public:
 protected:
 private:
@@ -140,6 +160,41 @@ private:
 	MMINLINE uintptr_t getRefreshSize() { return _tlh->refreshSize; };
 	MMINLINE void setRefreshSize(uintptr_t size) { _tlh->refreshSize = size; };
 
+	/**
+	 * @return the size the refresh size grows to
+	 */
+	MMINLINE uintptr_t
+	getMaximumRefreshSize(MM_GCExtensionsBase *extensions)
+	{
+		return extensions->adaptiveTLHSizing ? _maximumRefreshSize : extensions->tlhMaximumSize;
+	}
+
+	/**
+	 * Increase thread hungriness by tlhIncrementSize. With -Xgc:adaptiveTLHSizing the refresh size was chosen for
+	 * the thread at the start of the cycle, and is only doubled, up to the maximum for the cycle, once the thread
+	 * has refreshed more often than planned.
+	 */
+	MMINLINE void
+	growRefreshSize(MM_GCExtensionsBase *extensions)
+	{
+		if (extensions->adaptiveTLHSizing) {
+			if (_refreshCount >= TLH_ADAPTIVE_REFRESHES_PER_CYCLE) {
+				setRefreshSize(OMR_MIN(getRefreshSize() * 2, _maximumRefreshSize));
+			}
+		} else {
+			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+		}
+	}
+
+	/**
+	 * Size the TLHs of the next cycle after the allocation of this thread in the previous ones, for
+	 * -Xgc:adaptiveTLHSizing. A thread is given a TLH large enough to refresh TLH_ADAPTIVE_REFRESHES_PER_CYCLE
+	 * times a cycle, and no more than TLH_ADAPTIVE_NURSERY_FRACTION of the nursery left over by the survivors
+	 * of the last scavenge, so slow threads do not hold on to nursery space that hot threads run short of.
+	 * @return the refresh size for the next cycle
+	 */
+	uintptr_t adaptRefreshSize(MM_EnvironmentBase *env);
+
 	MMINLINE MM_MemorySubSpace *getMemorySubSpace() { return (MM_MemorySubSpace *)_tlh->memorySubSpace; };
 	MMINLINE void setMemorySubSpace(MM_MemorySubSpace *memorySubSpace) { _tlh->memorySubSpace = (void *)memorySubSpace; };
 
@@ -237,6 +292,35 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/**
+	 * Zero the TLH just taken from the pool. With -Xgc:backgroundTLHZeroing the TLH queued to the background
+	 * thread takes its place and it is queued instead, or, when none is queued, it is split in two and its
+	 * second half is queued. Neither is done when the TLH the thread would be left with is too small for the
+	 * allocation that caused the refresh, the fresh TLH is zeroed in place instead.
+	 */
+	void zeroFreshTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Queue [base, top) as the next TLH, or give it back to its pool if the background thread is not running.
+	 */
+	void queueNextTLH(MM_EnvironmentBase *env, void *base, void *top, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+
+	/**
+	 * Claim the next TLH back from the background thread and give it back to its pool.
+	 * @note The calling environment may not be the receivers owning environment.
+	 */
+	void abandonNextTLH(MM_EnvironmentBase *env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+	MMINLINE void
+	resetRefreshStats()
+	{
+		_refreshCount = 0;
+		_refreshBytes = 0;
+		_discardedBytes = 0;
+	}
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -251,7 +335,17 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_refreshCount(0),
+		_refreshBytes(0),
+		_discardedBytes(0),
+		_allocationRate(0),
+		_maximumRefreshSize(0)
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		, _nextTLH()
+		, _nextTLHMemorySubSpace(NULL)
+		, _nextTLHMemoryPool(NULL)
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	{};
 
 	/*
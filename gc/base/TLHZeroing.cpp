@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrutil.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#include "TLHZeroing.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+MM_TLHZeroing *
+MM_TLHZeroing::newInstance(MM_EnvironmentBase *env)
+{
+	MM_TLHZeroing *tlhZeroing = (MM_TLHZeroing *)env->getForge()->allocate(sizeof(MM_TLHZeroing), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != tlhZeroing) {
+		new(tlhZeroing) MM_TLHZeroing(env);
+		if (!tlhZeroing->initialize(env)) {
+			tlhZeroing->kill(env);
+			tlhZeroing = NULL;
+		}
+	}
+	return tlhZeroing;
+}
+
+void
+MM_TLHZeroing::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_TLHZeroing::MM_TLHZeroing(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _head(NULL)
+	, _tail(NULL)
+	, _threadState(THREAD_NOT_STARTED)
+	, _zeroedBytes(0)
+	, _claimedBytes(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_TLHZeroing::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_TLHZeroing::_monitor");
+}
+
+void
+MM_TLHZeroing::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		shutdown(env);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+void
+MM_TLHZeroing::zeroTLH(MM_GCExtensionsBase *extensions, void *base, uintptr_t size)
+{
+	if (size < extensions->tlhZeroingThreshold) {
+		OMRZeroMemory(base, size);
+	} else {
+		switch (extensions->tlhZeroingStrategy) {
+		case MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_NON_TEMPORAL:
+			OMRZeroMemoryNonTemporal(base, size);
+			break;
+		case MM_GCExtensionsBase::OMR_GC_TLH_ZEROING_REP_STOSB:
+			OMRZeroMemoryRepStosb(base, size);
+			break;
+		default:
+			OMRZeroMemory(base, size);
+			break;
+		}
+	}
+}
+
+bool
+MM_TLHZeroing::startup(MM_EnvironmentBase *env)
+{
+	bool result = false;
+
+	/* hold the monitor so the thread cannot report it is running before we wait */
+	omrthread_monitor_enter(_monitor);
+	if (0 == createThreadWithCategory(NULL, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0, thread_proc, this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		while (THREAD_NOT_STARTED == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		result = (THREAD_RUNNING == _threadState);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_TLHZeroing::shutdown(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_RUNNING == _threadState) {
+		_threadState = THREAD_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_TLHZeroing::post(MM_TLHZeroingRequest *request, void *base, void *top)
+{
+	bool posted = false;
+
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_RUNNING == _threadState) {
+		request->base = base;
+		request->top = top;
+		request->state = MM_TLHZeroingRequest::STATE_PENDING;
+		request->previous = _tail;
+		request->next = NULL;
+		if (NULL == _tail) {
+			_head = request;
+		} else {
+			_tail->next = request;
+		}
+		_tail = request;
+		omrthread_monitor_notify_all(_monitor);
+		posted = true;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return posted;
+}
+
+bool
+MM_TLHZeroing::claim(MM_TLHZeroingRequest *request)
+{
+	omrthread_monitor_enter(_monitor);
+	while (MM_TLHZeroingRequest::STATE_ZEROING == request->state) {
+		omrthread_monitor_wait(_monitor);
+	}
+	bool zeroed = (MM_TLHZeroingRequest::STATE_DONE == request->state);
+	if (MM_TLHZeroingRequest::STATE_PENDING == request->state) {
+		remove(request);
+		_claimedBytes += (uintptr_t)request->top - (uintptr_t)request->base;
+	}
+	request->state = MM_TLHZeroingRequest::STATE_IDLE;
+	omrthread_monitor_exit(_monitor);
+
+	return zeroed;
+}
+
+int J9THREAD_PROC
+MM_TLHZeroing::thread_proc(void *info)
+{
+	((MM_TLHZeroing *)info)->run();
+	return 0;
+}
+
+void
+MM_TLHZeroing::run()
+{
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (THREAD_TERMINATION_REQUESTED != _threadState) {
+		MM_TLHZeroingRequest *request = _head;
+		if (NULL == request) {
+			omrthread_monitor_wait(_monitor);
+		} else {
+			remove(request);
+			request->state = MM_TLHZeroingRequest::STATE_ZEROING;
+			uintptr_t size = (uintptr_t)request->top - (uintptr_t)request->base;
+
+			/* the allocating thread waits for, and does not touch, a request being zeroed */
+			omrthread_monitor_exit(_monitor);
+			zeroTLH(_extensions, request->base, size);
+			omrthread_monitor_enter(_monitor);
+
+			request->state = MM_TLHZeroingRequest::STATE_DONE;
+			_zeroedBytes += size;
+			omrthread_monitor_notify_all(_monitor);
+		}
+	}
+
+	_threadState = THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_TLHZeroing::remove(MM_TLHZeroingRequest *request)
+{
+	if (NULL == request->previous) {
+		_head = request->next;
+	} else {
+		request->previous->next = request->next;
+	}
+	if (NULL == request->next) {
+		_tail = request->previous;
+	} else {
+		request->next->previous = request->previous;
+	}
+	request->previous = NULL;
+	request->next = NULL;
+}
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
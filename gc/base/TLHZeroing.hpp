@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(TLHZEROING_HPP_)
+#define TLHZEROING_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * A TLH handed to the background zeroing thread, embedded in the MM_TLHAllocationSupport that owns the memory.
+ */
+class MM_TLHZeroingRequest
+{
+public:
+	enum State {
+		STATE_IDLE = 0, /**< Not queued, the memory (if any) belongs to the allocating thread */
+		STATE_PENDING, /**< Queued for the background thread */
+		STATE_ZEROING, /**< Being zeroed by the background thread */
+		STATE_DONE /**< Zeroed by the background thread, to be claimed */
+	};
+
+	void *base; /**< First byte of the TLH, NULL when there is none */
+	void *top; /**< First byte after the TLH */
+	State state;
+	MM_TLHZeroingRequest *previous; /**< Previous request of the queue */
+	MM_TLHZeroingRequest *next; /**< Next request of the queue */
+
+	MM_TLHZeroingRequest()
+		: base(NULL)
+		, top(NULL)
+		, state(STATE_IDLE)
+		, previous(NULL)
+		, next(NULL)
+	{}
+};
+
+/**
+ * Zeroes batch cleared TLHs (-Xgc:batchClearTLH), and with -Xgc:backgroundTLHZeroing runs a thread that zeroes
+ * them ahead of demand.
+ *
+ * TLHs of at least tlhZeroingThreshold bytes are zeroed with the strategy of -Xgc:tlhZeroing=: streaming stores,
+ * which leave lines the allocating thread will not touch for a while out of its cache, or rep stosb on processors
+ * reporting ERMS.
+ *
+ * In the background, every allocating thread keeps one TLH queued past its current one. When it refreshes, the
+ * queued TLH, zeroed in the meantime, becomes the current one and the fresh TLH from the pool is queued in its
+ * place. A queued TLH the background thread has not started is claimed back and zeroed by the allocating thread,
+ * and queued TLHs are claimed back and abandoned to the pool whenever allocation caches are flushed, so the
+ * background thread never holds any memory while the heap is walked or collected.
+ */
+class MM_TLHZeroing : public MM_BaseVirtual
+{
+/* Data members & types */
+public:
+protected:
+private:
+	enum ThreadState {
+		THREAD_NOT_STARTED = 0,
+		THREAD_RUNNING,
+		THREAD_TERMINATION_REQUESTED,
+		THREAD_TERMINATED
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< Protects the queue and the request states, notified on every change */
+	MM_TLHZeroingRequest *_head; /**< Oldest queued request */
+	MM_TLHZeroingRequest *_tail; /**< Newest queued request */
+	volatile ThreadState _threadState;
+	uintptr_t _zeroedBytes; /**< Bytes zeroed by the background thread */
+	uintptr_t _claimedBytes; /**< Bytes of queued TLHs claimed back before the background thread got to them */
+
+/* Methods */
+public:
+	static MM_TLHZeroing *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Zero a TLH the way -Xgc:tlhZeroing= and -Xgc:tlhZeroingThreshold= ask for.
+	 */
+	static void zeroTLH(MM_GCExtensionsBase *extensions, void *base, uintptr_t size);
+
+	/**
+	 * Start the background thread.
+	 * @return false if the thread could not be started
+	 */
+	bool startup(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the background thread. Requests still queued stay so until they are claimed.
+	 */
+	void shutdown(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue [base, top) for zeroing.
+	 * @return false, leaving the request idle, if the background thread is not running
+	 */
+	bool post(MM_TLHZeroingRequest *request, void *base, void *top);
+
+	/**
+	 * Take a request back, waiting for the background thread if it is zeroing it. The request is idle on return.
+	 * @return true if the memory of the request was zeroed, false if the caller must zero it
+	 */
+	bool claim(MM_TLHZeroingRequest *request);
+
+	MMINLINE uintptr_t getZeroedBytes() const { return _zeroedBytes; }
+	MMINLINE uintptr_t getClaimedBytes() const { return _claimedBytes; }
+
+	MM_TLHZeroing(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC thread_proc(void *info);
+	void run();
+	void remove(MM_TLHZeroingRequest *request);
+};
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+#endif /* TLHZEROING_HPP_ */
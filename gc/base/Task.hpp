@@ -67,6 +67,11 @@ public:
 
 	virtual uintptr_t getRecommendedWorkingThreads() { return UDATA_MAX; }
 
+	/**
+	 * @return the time, in hi-res ticks, threads of the task spent blocked at synchronization points, summed over all threads
+	 */
+	virtual uint64_t getSyncStallTime() { return 0; }
+
 	/**
 	 * Single call setup routine for tasks invoked by the main thread before the task is dispatched.
 	 */
@@ -89,6 +94,16 @@ public:
 		/* in a Task we don't need a mutex */
 	}
 
+	/**
+	 * @param useBarrier[in] true if the threads of the task should synchronize on a spin-then-park barrier
+	 * @param spinCount[in] iterations a thread spins at the barrier before it parks
+	 * @note must be called after setSynchronizeMutex()
+	 */
+	MMINLINE virtual void setSynchronizeBarrier(bool useBarrier, uintptr_t spinCount)
+	{
+		/* in a Task we don't need a barrier */
+	}
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(LINUX)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
+#include "ThreadBarrier.hpp"
+
+void
+MM_ThreadBarrier::park(volatile uint32_t *address, uint32_t expectedValue)
+{
+#if defined(LINUX)
+	/* the kernel re-checks the value, so a change made before we sleep is never missed */
+	syscall(SYS_futex, (uint32_t *)address, FUTEX_WAIT_PRIVATE, expectedValue, NULL, NULL, 0);
+#else /* defined(LINUX) */
+	omrthread_monitor_enter(_monitor);
+	while (expectedValue == *address) {
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+#endif /* defined(LINUX) */
+}
+
+void
+MM_ThreadBarrier::unpark(volatile uint32_t *address)
+{
+#if defined(LINUX)
+	syscall(SYS_futex, (uint32_t *)address, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else /* defined(LINUX) */
+	omrthread_monitor_enter(_monitor);
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+#endif /* defined(LINUX) */
+}
+
+void
+MM_ThreadBarrier::waitForRelease(uint32_t sense)
+{
+	for (uintptr_t spin = 0; spin < _spinCount; spin++) {
+		if (sense != _sense) {
+			MM_AtomicOperations::readBarrier();
+			return;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	/* the waiter count is published (by an atomic update) before the sense is re-read, and release()
+	 * advances the sense (atomically) before it reads the count, so either we see the new sense or it sees us
+	 */
+	MM_AtomicOperations::addU32(&_releaseWaiters, 1);
+	while (sense == _sense) {
+		park(&_sense, sense);
+	}
+	MM_AtomicOperations::subtractU32(&_releaseWaiters, 1);
+	MM_AtomicOperations::readBarrier();
+}
+
+void
+MM_ThreadBarrier::waitForArrivals(uint32_t parties)
+{
+	for (uintptr_t spin = 0; spin < _spinCount; spin++) {
+		if (parties <= _arrived) {
+			MM_AtomicOperations::readBarrier();
+			return;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	MM_AtomicOperations::addU32(&_arrivalWaiters, 1);
+	uint32_t arrived = _arrived;
+	while (parties > arrived) {
+		park(&_arrived, arrived);
+		arrived = _arrived;
+	}
+	MM_AtomicOperations::subtractU32(&_arrivalWaiters, 1);
+	MM_AtomicOperations::readBarrier();
+}
+
+void
+MM_ThreadBarrier::release()
+{
+	/* threads leaving this generation may arrive at the next one as soon as they see the new sense */
+	_arrived = 0;
+	MM_AtomicOperations::writeBarrier();
+	MM_AtomicOperations::addU32(&_sense, 1);
+	if (0 != _releaseWaiters) {
+		unpark(&_sense);
+	}
+}
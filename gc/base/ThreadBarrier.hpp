@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(THREADBARRIER_HPP_)
+#define THREADBARRIER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+/**
+ * Sense reversing thread barrier which spins for a bounded number of iterations before parking.
+ * The sense is a generation counter advanced by every release: a thread samples it before arriving
+ * and waits until it changes, so the barrier can be reused immediately without resetting per thread state.
+ * The arrival counter and the sense word live on separate cache lines, so arriving threads do not
+ * invalidate the line the waiting threads spin on.
+ * On Linux parked threads block in a futex on the word they wait for; elsewhere they wait on the monitor
+ * given to initialize().
+ * @ingroup GC_Base
+ */
+class MM_ThreadBarrier : public MM_BaseNonVirtual
+{
+/* Data members */
+private:
+	volatile uint32_t _arrived; /**< Threads that reached the barrier in the current generation */
+	volatile uint32_t _arrivalWaiters; /**< Threads parked until every thread has arrived */
+	uint8_t _arrivedPadding[CACHE_LINE_SIZE - (2 * sizeof(uint32_t))];
+	volatile uint32_t _sense; /**< Generation of the barrier, advanced by every release */
+	volatile uint32_t _releaseWaiters; /**< Threads parked until the generation changes */
+	uint8_t _sensePadding[CACHE_LINE_SIZE - (2 * sizeof(uint32_t))];
+	uintptr_t _spinCount; /**< Iterations a waiting thread spins before it parks */
+	omrthread_monitor_t _monitor; /**< Parks waiting threads where futexes are not available */
+
+/* Methods */
+private:
+	/**
+	 * Block until the value at address is no longer expectedValue, or a spurious wakeup.
+	 */
+	void park(volatile uint32_t *address, uint32_t expectedValue);
+
+	/**
+	 * Wake every thread parked on address.
+	 */
+	void unpark(volatile uint32_t *address);
+
+public:
+	/**
+	 * Prepare the barrier for use.
+	 * @param spinCount[in] iterations a waiting thread spins before it parks, 0 to park immediately
+	 * @param monitor[in] monitor parked threads wait on when futexes are not available
+	 */
+	void initialize(uintptr_t spinCount, omrthread_monitor_t monitor)
+	{
+		_arrived = 0;
+		_arrivalWaiters = 0;
+		_releaseWaiters = 0;
+		_spinCount = spinCount;
+		_monitor = monitor;
+	}
+
+	/**
+	 * Sample the generation before arriving. The value is passed to waitForRelease().
+	 */
+	MMINLINE uint32_t getSense() { return _sense; }
+
+	/**
+	 * @return the number of threads that reached the barrier in the current generation
+	 */
+	MMINLINE uint32_t getArrivedCount() { return _arrived; }
+
+	/**
+	 * Record the arrival of the calling thread. The last of parties threads to arrive wakes
+	 * any thread parked in waitForArrivals().
+	 * @param parties[in] the number of threads taking part in the current generation
+	 * @return true if the caller is the last thread to arrive
+	 */
+	MMINLINE bool
+	arrive(uint32_t parties)
+	{
+		bool last = (parties == (uint32_t)MM_AtomicOperations::addU32(&_arrived, 1));
+		if (last && (0 != _arrivalWaiters)) {
+			unpark(&_arrived);
+		}
+		return last;
+	}
+
+	/**
+	 * Wait, spinning then parking, until the barrier is released out of generation sense.
+	 * @param sense[in] the generation sampled by getSense() before the caller arrived
+	 */
+	void waitForRelease(uint32_t sense);
+
+	/**
+	 * Wait, spinning then parking, until parties threads have arrived in the current generation.
+	 * @param parties[in] the number of threads taking part in the current generation
+	 */
+	void waitForArrivals(uint32_t parties);
+
+	/**
+	 * Start a new generation and wake every thread waiting for the current one to be released.
+	 */
+	void release();
+
+	/**
+	 * Arrive and wait for the other threads. The last thread to arrive releases the others.
+	 * @param parties[in] the number of threads taking part in the current generation
+	 * @return true for the last thread to arrive, which did not wait
+	 */
+	MMINLINE bool
+	arriveAndWait(uint32_t parties)
+	{
+		uint32_t sense = getSense();
+		bool last = arrive(parties);
+		if (last) {
+			release();
+		} else {
+			waitForRelease(sense);
+		}
+		return last;
+	}
+
+	MM_ThreadBarrier() :
+		MM_BaseNonVirtual()
+		,_arrived(0)
+		,_arrivalWaiters(0)
+		,_sense(0)
+		,_releaseWaiters(0)
+		,_spinCount(0)
+		,_monitor(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* THREADBARRIER_HPP_ */
@@ -171,7 +171,9 @@ MM_VirtualMemory::doubleMapArraylet(MM_EnvironmentBase *env, void* arrayletLeave
 
 	return omrvmem_get_contiguous_region_memory(arrayletLeaves, arrayletLeafCount, arrayletLeafSize, byteAmount, oldIdentifier, newIdentifier, mode, pageSize, omrmem_get_category(OMRMEM_CATEGORY_MM));
 }
+#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
 
+#if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) || defined(OMR_GC_CONCURRENT_SCAVENGER)
 void*
 MM_VirtualMemory::doubleMapRegions(MM_EnvironmentBase *env, void* regions[], UDATA regionsCount, UDATA regionSize, UDATA byteAmount, struct J9PortVmemIdentifier *newIdentifier, UDATA pageSize, void *preferredAddress)
 {
@@ -181,7 +183,7 @@ MM_VirtualMemory::doubleMapRegions(MM_EnvironmentBase *env, void* regions[], UDA
 
 	return omrvmem_create_double_mapped_region(regions, regionsCount, regionSize, byteAmount, oldIdentifier, newIdentifier, mode, pageSize, omrmem_get_category(OMRMEM_CATEGORY_MM), preferredAddress);
 }
-#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
+#endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) || defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 bool MM_VirtualMemory::freeMemory()
 {
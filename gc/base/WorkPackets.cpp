@@ -155,10 +155,47 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 			return false;
 		}
 	}
+
+	if (_extensions->workStealingMarking) {
+		if (!initializeStealingDeques(env)) {
+			return false;
+		}
+	}
 	
 	return true;
 }
 
+/**
+ * Allocate one work stealing deque per GC thread. Each deque is cache line aligned so that
+ * threads pushing to and popping from their own deques do not contend with each other.
+ * @return true on success, false on allocation failure
+ */
+bool
+MM_WorkPackets::initializeStealingDeques(MM_EnvironmentBase *env)
+{
+	uintptr_t dequeCount = OMR_MAX(_extensions->gcThreadCount, 1);
+	uintptr_t dequesSize = dequeCount * sizeof(MM_WorkStealingDeque);
+	uintptr_t buffersSize = dequeCount * _stealingDequeCapacity * sizeof(MM_Packet *);
+
+	_stealingDequeMemory = env->getForge()->allocate(dequesSize + buffersSize + CACHE_LINE_SIZE, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _stealingDequeMemory) {
+		return false;
+	}
+
+	MM_WorkStealingDeque *deques = (MM_WorkStealingDeque *)MM_Math::roundToCeiling(CACHE_LINE_SIZE, (uintptr_t)_stealingDequeMemory);
+	MM_Packet **buffers = (MM_Packet **)((uintptr_t)deques + dequesSize);
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		new(&deques[i]) MM_WorkStealingDeque();
+		deques[i].initialize(&buffers[i * _stealingDequeCapacity], _stealingDequeCapacity, i + 1);
+	}
+
+	_stealingDequeCount = dequeCount;
+	_stealingDequePacketCount = 0;
+	_stealingDeques = deques;
+
+	return true;
+}
+
 /**
  * Allocate another workpacket block
  * @return true on sucess, false on allocation failure or if _maxpackets is already reached
@@ -224,6 +261,13 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _stealingDequeMemory) {
+		env->getForge()->free(_stealingDequeMemory);
+		_stealingDequeMemory = NULL;
+		_stealingDeques = NULL;
+		_stealingDequeCount = 0;
+	}
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -262,6 +306,16 @@ void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
+
+	if (NULL != _stealingDeques) {
+		for (uintptr_t i = 0; i < _stealingDequeCount; i++) {
+			while (NULL != (packet = _stealingDeques[i].steal())) {
+				MM_AtomicOperations::subtract(&_stealingDequePacketCount, 1);
+				packet->resetData(env);
+				putPacket(env, packet);
+			}
+		}
+	}
 	
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
@@ -329,9 +383,13 @@ MM_WorkPackets::reuseDeferredPackets(MM_EnvironmentBase *env)
 bool
 MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 {
+	/* Packets queued on the work stealing deques count as available input, so a thread waiting in
+	 * getInputPacket() will not declare marking complete while another thread still holds queued work.
+	 */
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
+				|| (0 != _stealingDequePacketCount)
 				|| (!_overflowHandler->isEmpty()));
 				
 	return res;
@@ -384,13 +442,20 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packet = NULL;
 
 	if (!inputPacketAvailable(env)) {
 		return NULL;
 	}
 
-	if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
+	/* With work stealing the shared lists only hold packets flushed at the end of a task, so prefer the deques */
+	if (NULL != _stealingDeques) {
+		packet = getInputPacketFromStealingDeques(env);
+	}
+
+	if (NULL != packet) {
+		/* found a packet on a work stealing deque */
+	} else if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
 		if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
 			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
 				packet = getPacket(env, &_fullPacketList);
@@ -578,6 +643,10 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	MM_Packet *packet = NULL;
 	
 	packet = getPacket(env, &_fullPacketList);
+	if ((NULL == packet) && (NULL != _stealingDeques)) {
+		/* With work stealing full packets are queued on the deques rather than the full list */
+		packet = getInputPacketFromStealingDeques(env);
+	}
 	if(NULL != packet) {
 		/* Move the contents of the packet to overflow */
 		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
@@ -762,7 +831,108 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-	putPacket(env, packet);
+	if (!putPacketToStealingDeque(env, packet)) {
+		putPacket(env, packet);
+	}
+}
+
+MM_WorkStealingDeque *
+MM_WorkPackets::getStealingDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+
+	if ((NULL != _stealingDeques) && (NULL != env->_currentTask) && (env->getWorkerID() < _stealingDequeCount)) {
+		deque = &_stealingDeques[env->getWorkerID()];
+	}
+
+	return deque;
+}
+
+bool
+MM_WorkPackets::putPacketToStealingDeque(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	MM_WorkStealingDeque *deque = getStealingDeque(env);
+
+	if ((NULL == deque) || packet->isEmpty()) {
+		return false;
+	}
+
+	/* Count the packet before it becomes visible to thieves so the count never under-reports queued work */
+	MM_AtomicOperations::add(&_stealingDequePacketCount, 1);
+	packet->resetOwner();
+	if (!deque->push(packet)) {
+		MM_AtomicOperations::subtract(&_stealingDequePacketCount, 1);
+		return false;
+	}
+
+	if (_inputListWaitCount > 0) {
+		notifyWaitingThreads(env);
+	}
+
+	return true;
+}
+
+MM_Packet *
+MM_WorkPackets::getInputPacketFromStealingDeques(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	MM_WorkStealingDeque *deque = getStealingDeque(env);
+
+	if (NULL != deque) {
+		packet = deque->pop();
+	}
+
+	if ((NULL == packet) && (0 != _stealingDequePacketCount)) {
+		packet = stealPacket(env, deque);
+	}
+
+	if (NULL != packet) {
+		MM_AtomicOperations::subtract(&_stealingDequePacketCount, 1);
+		packet->setOwner(env);
+	}
+
+	return packet;
+}
+
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env, MM_WorkStealingDeque *thiefDeque)
+{
+	MM_ParallelDispatcher *dispatcher = _extensions->dispatcher;
+	uintptr_t victimStart = (NULL != thiefDeque) ? (thiefDeque->nextRandom() % _stealingDequeCount) : 0;
+	/* Threads that don't own a deque are not NUMA bound so have no local node to prefer */
+	uintptr_t thiefNode = (NULL != thiefDeque) ? dispatcher->getWorkerNUMANode(env->getWorkerID()) : 0;
+	/* pass 0 probes node-local victims, pass 1 probes the rest; without a node only the second pass runs over every victim */
+	uintptr_t pass = (0 != thiefNode) ? 0 : 1;
+
+	for (; pass < 2; pass++) {
+		uintptr_t victim = victimStart;
+		for (uintptr_t attempt = 0; attempt < _stealingDequeCount; attempt++) {
+			MM_WorkStealingDeque *victimDeque = &_stealingDeques[victim];
+			bool nodeLocal = (dispatcher->getWorkerNUMANode(victim) == thiefNode);
+			bool probe = (0 == thiefNode) || ((0 == pass) == nodeLocal);
+			if ((victimDeque != thiefDeque) && probe && (0 != victimDeque->getApproximateSize())) {
+				MM_Packet *packet = victimDeque->steal();
+				if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					env->_workPacketStats.workPacketsStolen += 1;
+					if ((0 != thiefNode) && !nodeLocal) {
+						env->_workPacketStats.workPacketsStolenRemote += 1;
+					}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					return packet;
+				}
+			}
+			victim += 1;
+			if (victim == _stealingDequeCount) {
+				victim = 0;
+			}
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.workPacketStealFailures += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	return NULL;
 }
 
 /**
@@ -38,6 +38,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -64,7 +65,8 @@ protected:
 		_fullPacketThreshold = _slotsInPacket >> 4,
 		_satisfactoryCapacity = _slotsInPacket / 2,
 		_indexMask = 0xff,
-		_maxPacketSearch = 20
+		_maxPacketSearch = 20,
+		_stealingDequeCapacity = 64
 	};
 
 	uintptr_t _packetsPerBlock;
@@ -89,9 +91,44 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkStealingDeque *_stealingDeques; /**< Per GC thread work stealing deques (indexed by worker ID), NULL unless -Xgc:workStealing was specified */
+	void *_stealingDequeMemory; /**< Backing store for the deques and their packet buffers */
+	uintptr_t _stealingDequeCount; /**< Number of entries in _stealingDeques */
+	volatile uintptr_t _stealingDequePacketCount; /**< Upper bound on the number of packets queued on the work stealing deques */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
+	bool initializeStealingDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the work stealing deque owned by the given thread. Only GC threads running a task
+	 * own a deque; any other thread may only steal.
+	 * @return the deque, or NULL if the thread does not own one
+	 */
+	MM_WorkStealingDeque *getStealingDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue a non-empty packet on the deque owned by the current thread.
+	 * @return true if the packet was queued, false if the thread has no deque or it is full
+	 */
+	bool putPacketToStealingDeque(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Take a packet from the deque owned by the current thread or, failing that, steal one
+	 * from another thread's deque.
+	 * @return a packet, or NULL if none could be found
+	 */
+	MM_Packet *getInputPacketFromStealingDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Steal a packet from a randomly chosen victim, probing every other deque once.
+	 * When GC workers are NUMA bound, the deques of workers on the thief's own node are probed
+	 * first and other nodes are only tried once local work has run dry.
+	 * @param thiefDeque[in] the deque owned by the current thread, or NULL
+	 * @return a packet, or NULL if all deques appeared empty
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env, MM_WorkStealingDeque *thiefDeque);
 
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
@@ -146,6 +183,14 @@ public:
 		return _inputListWaitCount;
 	}
 
+	/**
+	 * Returns TRUE if full output packets are distributed through per-thread work stealing deques
+	 */
+	MMINLINE bool isWorkStealingEnabled()
+	{
+		return (NULL != _stealingDeques);
+	}
+
 	/**
 	 * Returns number of non-empty packets 
 	 */
@@ -235,7 +280,11 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_stealingDeques(NULL),
+		_stealingDequeMemory(NULL),
+		_stealingDequeCount(0),
+		_stealingDequePacketCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
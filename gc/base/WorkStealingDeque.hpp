@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_Packet;
+
+/**
+ * Fixed capacity Chase-Lev work stealing deque of work packets.
+ * The owning GC thread pushes and pops packets at the bottom of the deque without
+ * taking any lock; any other thread may steal the oldest packet from the top.
+ * The owner and thief ends are kept on separate cache lines, as long as the deque itself is cache line
+ * aligned (see MM_WorkPackets::initializeStealingDeques()).
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+/* Data members */
+private:
+	volatile intptr_t _top; /**< Index of the oldest packet, advanced by thieves (and by the owner when racing for the last packet) */
+	uint8_t _topPadding[CACHE_LINE_SIZE - sizeof(MM_BaseNonVirtual) - sizeof(intptr_t)]; /**< Pads the inherited fields and _top to a cache line */
+	volatile intptr_t _bottom; /**< Index one past the newest packet, only written by the owner */
+	MM_Packet **_buffer; /**< Ring buffer of packets, capacity is a power of two */
+	uintptr_t _mask; /**< Capacity - 1 */
+	uintptr_t _stealSeed; /**< Owner-local random state used to pick steal victims */
+	uint8_t _bottomPadding[CACHE_LINE_SIZE - sizeof(intptr_t) - (2 * sizeof(uintptr_t)) - sizeof(MM_Packet **)]; /**< Pads the owner's fields to a cache line, so that the deques of an array stay aligned */
+
+/* Methods */
+private:
+	MMINLINE bool
+	casTop(intptr_t oldTop, intptr_t newTop)
+	{
+		return ((uintptr_t)oldTop == MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)oldTop, (uintptr_t)newTop));
+	}
+
+public:
+	/**
+	 * Attach the receiver to its backing store.
+	 * @param buffer[in] storage for capacity packet pointers
+	 * @param capacity[in] number of packets the deque can hold, must be a power of two
+	 * @param seed[in] initial (non-zero) value for the victim selection random state
+	 */
+	void
+	initialize(MM_Packet **buffer, uintptr_t capacity, uintptr_t seed)
+	{
+		_top = 0;
+		_bottom = 0;
+		_buffer = buffer;
+		_mask = capacity - 1;
+		_stealSeed = (0 == seed) ? 1 : seed;
+	}
+
+	/**
+	 * Push a packet to the bottom of the deque. Only the owning thread may call this.
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		intptr_t bottom = _bottom;
+		intptr_t top = _top;
+		if ((uintptr_t)(bottom - top) > _mask) {
+			return false;
+		}
+		_buffer[bottom & _mask] = packet;
+		/* the packet must be visible before a thief can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed packet. Only the owning thread may call this.
+	 * @return a packet, or NULL if the deque is empty (or the last packet was stolen)
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		MM_Packet *packet = NULL;
+		intptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the bottom store must be globally visible before top is read */
+		MM_AtomicOperations::readWriteBarrier();
+		intptr_t top = _top;
+		if (top <= bottom) {
+			packet = _buffer[bottom & _mask];
+			if (top == bottom) {
+				/* last packet - race any thief for it */
+				if (!casTop(top, top + 1)) {
+					packet = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			_bottom = bottom + 1;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet. May be called by any thread.
+	 * @return a packet, or NULL if the deque is empty or another thread won the race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		MM_Packet *packet = NULL;
+		intptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		intptr_t bottom = _bottom;
+		if (top < bottom) {
+			packet = _buffer[top & _mask];
+			if (!casTop(top, top + 1)) {
+				packet = NULL;
+			}
+		}
+		return packet;
+	}
+
+	/**
+	 * @return an approximation of the number of packets in the deque
+	 */
+	MMINLINE uintptr_t
+	getApproximateSize()
+	{
+		intptr_t size = _bottom - _top;
+		return (size > 0) ? (uintptr_t)size : 0;
+	}
+
+	/**
+	 * Advance the owner-local xorshift random state and return the next value.
+	 * Only the owning thread may call this.
+	 */
+	MMINLINE uintptr_t
+	nextRandom()
+	{
+		uintptr_t x = _stealSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_stealSeed = x;
+		return x;
+	}
+
+	MM_WorkStealingDeque() :
+		MM_BaseNonVirtual()
+		,_top(0)
+		,_bottom(0)
+		,_buffer(NULL)
+		,_mask(0)
+		,_stealSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
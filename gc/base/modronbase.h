@@ -53,5 +53,30 @@
 #define J9_GC_SINGLE_SLOT_HOLE 0x3
 #endif
 
+/* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
+ * a quick implementation
+ */
+#if !defined(CACHE_LINE_SIZE)
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define CACHE_LINE_SIZE 256
+#else
+#define CACHE_LINE_SIZE 64
+#endif
+#endif /* !defined(CACHE_LINE_SIZE) */
+
+/**
+ * Hint that the cache line holding address is about to be read. Expands to nothing where the compiler has no prefetch builtin.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define MM_PREFETCH_FOR_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define MM_PREFETCH_FOR_READ(address) _mm_prefetch((const char *)(address), _MM_HINT_T0)
+#else
+#define MM_PREFETCH_FOR_READ(address)
+#endif
+
 #endif /* MODRONBASE_H_ */
 
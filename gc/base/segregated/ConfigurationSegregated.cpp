@@ -102,6 +102,13 @@ MM_ConfigurationSegregated::tearDown(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 
 	if (NULL != extensions->defaultSizeClasses) {
+		if (extensions->defaultSizeClasses->isRecordingAllocationSizes()) {
+			/* the allocations of the other threads were merged when their environments were killed */
+			if (NULL != env->_allocationTracker) {
+				env->_allocationTracker->flushSizeHistogram(env);
+			}
+			extensions->defaultSizeClasses->writeAllocationSizeHistogram(env);
+		}
 		extensions->defaultSizeClasses->kill(env);
 		extensions->defaultSizeClasses = NULL;
 	}
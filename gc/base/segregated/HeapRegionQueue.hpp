@@ -76,6 +76,15 @@ public:
 
 	virtual uintptr_t debugCountFreeBytesInRegions() = 0;
 
+	/**
+	 * @return true if the queue is a MM_LockFreeHeapRegionQueue, which does not share the internals
+	 * other queues use to move all their regions at once
+	 */
+	virtual bool isLockFree() { return false; }
+
+	/* check that the receiver is not empty before paying for a dequeue */
+	MMINLINE MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty() { return (0 != _length) ? dequeue() : NULL; }
+
 	/* Virtual methods inherited from RegionList */
 	virtual bool isEmpty() = 0;
 	virtual uintptr_t getTotalRegions() = 0;
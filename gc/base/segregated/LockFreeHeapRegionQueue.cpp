@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionQueue *
+MM_LockFreeHeapRegionQueue::newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes)
+{
+	MM_LockFreeHeapRegionQueue *regionList = (MM_LockFreeHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionQueue), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != regionList) {
+		new (regionList) MM_LockFreeHeapRegionQueue(regionListKind, singleRegionsOnly, trackFreeBytes);
+		if (!regionList->initialize(env)) {
+			regionList->kill(env);
+			regionList = NULL;
+		}
+	}
+	return regionList;
+}
+
+void
+MM_LockFreeHeapRegionQueue::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionQueue::initialize(MM_EnvironmentBase *env)
+{
+	/* regions are identified by their index in the table, which must exist (and fit the low half of the top of the stack) by now */
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heapRegionManager;
+	if ((NULL == regionManager) || (NULL == regionManager->physicalTableDescriptorForIndex(0)) || (regionManager->getTableRegionCount() >= 0xFFFFFFFF)) {
+		return false;
+	}
+	_regions.initialize(regionManager->physicalTableDescriptorForIndex(0), regionManager->getTableDescriptorSize());
+	return true;
+}
+
+void
+MM_LockFreeHeapRegionQueue::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_LockFreeHeapRegionQueue::enqueue(MM_HeapRegionQueue *src)
+{
+	MM_HeapRegionDescriptorSegregated *front = NULL;
+	if (src->isLockFree()) {
+		front = ((MM_LockFreeHeapRegionQueue *)src)->_regions.popAll();
+	} else {
+		/* chain the regions of src, so that they are pushed with a single update of the top */
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->dequeue())) {
+			region->setNext(front);
+			front = region;
+		}
+	}
+
+	if (NULL != front) {
+		uintptr_t length = 0;
+		uintptr_t regionsCount = 0;
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		for (MM_HeapRegionDescriptorSegregated *cur = front; NULL != cur; cur = cur->getNext()) {
+			length += 1;
+			regionsCount += cur->getRange();
+			back = cur;
+		}
+		if (src->isLockFree()) {
+			((MM_LockFreeHeapRegionQueue *)src)->subtractCounts(length, regionsCount);
+		}
+		addCounts(length, regionsCount);
+		_regions.pushChain(front, back);
+	}
+}
+
+uintptr_t
+MM_LockFreeHeapRegionQueue::dequeue(MM_HeapRegionQueue *target, uintptr_t count)
+{
+	uintptr_t moved = 0;
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	while ((moved < count) && (NULL != (region = dequeue()))) {
+		target->enqueue(region);
+		moved += 1;
+	}
+	return moved;
+}
+
+/**
+ * @note Walks the queue, so no other thread may modify it at the same time.
+ */
+void
+MM_LockFreeHeapRegionQueue::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t index = 0;
+	uintptr_t count = 0;
+	omrtty_printf("LockFreeHeapRegionList 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = _regions.peek(); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, index, cur->getRange());
+		count += 1;
+		index += cur->getRange();
+	}
+	omrtty_printf("\n");
+}
+
+/**
+ * DEBUG method that iterates over all regions in the list and sums up the free bytes.
+ * @note Walks the queue, so no other thread may modify it at the same time.
+ * @see MM_HeapRegionDescriptorSegregated::debugCountFreeBytes()
+ */
+uintptr_t
+MM_LockFreeHeapRegionQueue::debugCountFreeBytesInRegions()
+{
+	uintptr_t freeBytes = 0;
+	for (MM_HeapRegionDescriptorSegregated *cur = _regions.peek(); cur != NULL; cur = cur->getNext()) {
+		freeBytes += cur->debugCountFreeBytes();
+	}
+	return freeBytes;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Realtime
+ */
+
+#if !defined(LOCKFREEHEAPREGIONQUEUE_HPP_)
+#define LOCKFREEHEAPREGIONQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionQueue.hpp"
+#include "LockFreeRegionStack.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A region queue shared by threads without a lock, used instead of MM_LockingHeapRegionQueue when
+ * -Xgc:lockFreeRegionQueues is enabled.
+ *
+ * Regions are kept on a MM_LockFreeRegionStack, so they are dequeued in LIFO rather than FIFO order, which
+ * no user of the region pool depends on. Lengths and region counts are updated with atomics, before regions
+ * are enqueued and after they are dequeued, so they are never lower than the number of regions on the queue.
+ */
+class MM_LockFreeHeapRegionQueue : public MM_HeapRegionQueue
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockFreeRegionStack<MM_HeapRegionDescriptorSegregated> _regions;
+	volatile uintptr_t _totalRegionsCount;
+
+public:
+	static MM_LockFreeHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes = false);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionQueue(RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes) :
+		MM_HeapRegionQueue(regionListKind, singleRegionsOnly, trackFreeBytes),
+		_regions(),
+		_totalRegionsCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual bool isEmpty() { return _regions.isEmpty(); }
+
+	virtual bool isLockFree() { return true; }
+
+	virtual uintptr_t getTotalRegions() { return _singleRegionsOnly ? _length : _totalRegionsCount; }
+
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *region)
+	{
+		addCounts(1, region->getRange());
+		_regions.push(region);
+	}
+
+	/* enqueue all the regions of src */
+	virtual void enqueue(MM_HeapRegionQueue *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeue()
+	{
+		MM_HeapRegionDescriptorSegregated *region = _regions.pop();
+		if (NULL != region) {
+			subtractCounts(1, region->getRange());
+		}
+		return region;
+	}
+
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count);
+
+	virtual uintptr_t debugCountFreeBytesInRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+
+protected:
+private:
+	MMINLINE void
+	addCounts(uintptr_t length, uintptr_t regionsCount)
+	{
+		MM_AtomicOperations::add(&_length, length);
+		if (!_singleRegionsOnly) {
+			MM_AtomicOperations::add(&_totalRegionsCount, regionsCount);
+		}
+	}
+
+	MMINLINE void
+	subtractCounts(uintptr_t length, uintptr_t regionsCount)
+	{
+		MM_AtomicOperations::subtract(&_length, length);
+		if (!_singleRegionsOnly) {
+			MM_AtomicOperations::subtract(&_totalRegionsCount, regionsCount);
+		}
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONQUEUE_HPP_ */
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Realtime
+ */
+
+#if !defined(LOCKFREEREGIONSTACK_HPP_)
+#define LOCKFREEREGIONSTACK_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+
+/**
+ * A lock free (Treiber) stack of the descriptors of a region table, linked through their next pointers.
+ *
+ * The top of the stack is a single 64 bit word holding the index of the top region in the table and a version,
+ * bumped by every update, so that a pop cannot succeed with a next pointer read before the top region was popped
+ * and pushed back by another thread. Descriptors are never freed while the table exists, so reading the next
+ * pointer of a region some other thread popped in the meantime is harmless.
+ *
+ * REGION only needs getNext() and setNext(), and must live in the table given to initialize().
+ */
+template <typename REGION>
+class MM_LockFreeRegionStack
+{
+/* Data members */
+private:
+	volatile uint64_t _top; /**< Index of the top region plus one in the low half (0 if the stack is empty), version in the high half */
+	uintptr_t _regionTableBase; /**< Address of the first descriptor of the table */
+	uintptr_t _regionDescriptorSize; /**< Distance between two descriptors of the table */
+
+/* Methods */
+private:
+	MMINLINE REGION *
+	regionForTop(uint64_t top) const
+	{
+		uintptr_t index = (uintptr_t)(top & 0xFFFFFFFF);
+		return (0 == index) ? NULL : (REGION *)(_regionTableBase + ((index - 1) * _regionDescriptorSize));
+	}
+
+	MMINLINE uint64_t
+	topForRegion(REGION *region, uint64_t oldTop) const
+	{
+		uint64_t index = (NULL == region) ? 0 : ((((uintptr_t)region - _regionTableBase) / _regionDescriptorSize) + 1);
+		/* the version wraps around in the high half */
+		return (((oldTop >> 32) + 1) << 32) | index;
+	}
+
+public:
+	/**
+	 * @param regionTableBase[in] the first descriptor of the table holding every region pushed
+	 * @param regionDescriptorSize[in] the distance between two descriptors of the table
+	 */
+	void
+	initialize(void *regionTableBase, uintptr_t regionDescriptorSize)
+	{
+		_regionTableBase = (uintptr_t)regionTableBase;
+		_regionDescriptorSize = regionDescriptorSize;
+	}
+
+	MMINLINE bool isEmpty() const { return 0 == (_top & 0xFFFFFFFF); }
+
+	/**
+	 * @return the top region, to walk the stack while no other thread modifies it
+	 */
+	MMINLINE REGION *peek() const { return regionForTop(_top); }
+
+	/**
+	 * Push a chain of regions, linked through their next pointers, at once.
+	 * @param first[in] the region to be on top of the stack
+	 * @param last[in] the last region of the chain, whose next pointer is overwritten
+	 */
+	MMINLINE void
+	pushChain(REGION *first, REGION *last)
+	{
+		uint64_t oldTop = MM_AtomicOperations::getU64(&_top);
+		while (true) {
+			last->setNext(regionForTop(oldTop));
+			uint64_t top = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, topForRegion(first, oldTop));
+			if (top == oldTop) {
+				break;
+			}
+			oldTop = top;
+		}
+	}
+
+	MMINLINE void push(REGION *region) { pushChain(region, region); }
+
+	/**
+	 * @return the top region, unlinked, or NULL if the stack is empty
+	 */
+	MMINLINE REGION *
+	pop()
+	{
+		uint64_t oldTop = MM_AtomicOperations::getU64(&_top);
+		REGION *region = regionForTop(oldTop);
+		while (NULL != region) {
+			uint64_t top = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, topForRegion(region->getNext(), oldTop));
+			if (top == oldTop) {
+				region->setNext(NULL);
+				break;
+			}
+			oldTop = top;
+			region = regionForTop(oldTop);
+		}
+		return region;
+	}
+
+	/**
+	 * Empty the stack.
+	 * @return the regions the stack held, linked through their next pointers, or NULL if it was empty
+	 */
+	MMINLINE REGION *
+	popAll()
+	{
+		uint64_t oldTop = MM_AtomicOperations::getU64(&_top);
+		while (0 != (oldTop & 0xFFFFFFFF)) {
+			uint64_t top = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, topForRegion(NULL, oldTop));
+			if (top == oldTop) {
+				break;
+			}
+			oldTop = top;
+		}
+		return regionForTop(oldTop);
+	}
+
+	MM_LockFreeRegionStack()
+		: _top(0)
+		, _regionTableBase(0)
+		, _regionDescriptorSize(0)
+	{
+	}
+};
+
+#endif /* LOCKFREEREGIONSTACK_HPP_ */
@@ -91,6 +91,14 @@ public:
 	/* enqueue src at the _end_ of the receiver's queue */
 	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
 	{
+		if (srcAsPQ->isLockFree()) {
+			/* the regions of a lock free queue can only be taken one at a time */
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			while (NULL != (region = srcAsPQ->dequeue())) {
+				enqueue(region);
+			}
+			return;
+		}
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
 		if (NULL == src->_head) { /* Nothing to move - single read needs no lock */
 			return;
@@ -144,6 +152,15 @@ public:
 
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
 	{
+		if (targetAsPQ->isLockFree()) {
+			uintptr_t moved = 0;
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			while ((moved < count) && (NULL != (region = dequeue()))) {
+				targetAsPQ->enqueue(region);
+				moved += 1;
+			}
+			return moved;
+		}
 		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
 		lock();
 		target->lock();
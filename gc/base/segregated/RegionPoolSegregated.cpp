@@ -25,6 +25,7 @@
  * @ingroup GC_Modron_Realtime
  */
 
+#include <string.h>
 
 #include "EnvironmentBase.hpp"
 #include "FreeHeapRegionList.hpp"
@@ -32,6 +33,7 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingFreeHeapRegionList.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -90,16 +92,17 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	Assert_MM_true(0 < _splitAvailableListSplitCount);
 	for (szClass=OMR_SIZECLASSES_MIN_SMALL; szClass<=OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			uintptr_t splitAvailableListsSize = sizeof(MM_LockingHeapRegionQueue) * _splitAvailableListSplitCount;
-			_smallAvailableRegions[szClass][i] = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			uintptr_t splitAvailableListsSize = sizeof(MM_HeapRegionQueue *) * _splitAvailableListSplitCount;
+			_smallAvailableRegions[szClass][i] = (MM_HeapRegionQueue **)env->getForge()->allocate(splitAvailableListsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 			if (NULL == _smallAvailableRegions[szClass][i]) {
 				return false;
 			}
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
+			MM_HeapRegionQueue **regionQueues = _smallAvailableRegions[szClass][i];
+			memset(regionQueues, 0, splitAvailableListsSize);
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				/* The available lists should track the free bytes in their regions (4th param = true) */
-				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
-				if (!(&regionQueue[j])->initialize(env)) {
+				/* The available lists should track the free bytes in their regions (5th param = true) */
+				regionQueues[j] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
+				if (NULL == regionQueues[j]) {
 					return false;
 				}
 			}
@@ -135,6 +138,10 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 MM_HeapRegionQueue*
 MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
 {
+	/* queues only one thread accesses need no lock in the first place */
+	if (concurrentAccess && env->getExtensions()->lockFreeRegionQueues) {
+		return MM_LockFreeHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, trackFreeBytes);
+	}
 	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
 }
 
@@ -186,12 +193,15 @@ MM_RegionPoolSegregated::tearDown(MM_EnvironmentBase *env)
 	
 	for (int32_t szClass=OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (uintptr_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
-			if (NULL != regionQueueArray) {
+			MM_HeapRegionQueue **regionQueues = _smallAvailableRegions[szClass][i];
+			if (NULL != regionQueues) {
 				for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-					(&regionQueueArray[j])->tearDown(env);
+					if (NULL != regionQueues[j]) {
+						regionQueues[j]->kill(env);
+					}
 				}
-				env->getForge()->free(regionQueueArray);
+				env->getForge()->free(regionQueues);
+				_smallAvailableRegions[szClass][i] = NULL;
 			}
 		}
 		if (_smallFullRegions[szClass]) {
@@ -221,9 +231,9 @@ MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 		_darkMatterCellCount[sizeClass] = 0;
 		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
+			MM_HeapRegionQueue **regionQueues = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
+				_smallSweepRegions[sizeClass]->enqueue(regionQueues[j]);
 			}
 		}
 		_initialCountOfSweepRegions[sizeClass] = _currentCountOfSweepRegions[sizeClass] = _smallSweepRegions[sizeClass]->getTotalRegions();
@@ -250,7 +260,7 @@ MM_RegionPoolSegregated::enqueueAvailable(MM_HeapRegionDescriptorSegregated *reg
 {
 	for (int32_t i = 0; i < NUM_DEFRAG_BUCKETS; i++) {
 		if (occupancy >= defragBucketThresholds[i]) {
-			(&(_smallAvailableRegions[sizeClass][i])[splitListIndex])->enqueue(region);
+			_smallAvailableRegions[sizeClass][i][splitListIndex]->enqueue(region);
 			break;
 		}
 	}
@@ -327,9 +337,9 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
 	uintptr_t splitIndex = env->getWorkerID() % _splitAvailableListSplitCount;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
-		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+		MM_HeapRegionQueue *primaryQueue = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET][splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
+			primaryQueue->enqueue(_smallAvailableRegions[sizeClass][i][splitIndex]);
 		}
 	}
 }
@@ -349,8 +359,8 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 
 	/* try bucket 0, i.e. primary bucket first */
 	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
-	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
-	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
+	MM_HeapRegionQueue **primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
+	MM_HeapRegionQueue *allocationQueue = primaryQueueArray[startList];
 	region = allocationQueue->dequeueIfNonEmpty();
 	if (region != NULL) {
 		return region;
@@ -358,7 +368,7 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 
 	/* if primary bucket fails, try the other split queues, starting from the current thread's split index */
 	for (uintptr_t j=startList+1; j<startList+_splitAvailableListSplitCount; j++) {
-		allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
+		allocationQueue = primaryQueueArray[j%_splitAvailableListSplitCount];
 		region = allocationQueue->dequeueIfNonEmpty();
 		if (region != NULL) {
 			return region;
@@ -368,9 +378,9 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 	/* if all split lists in the primary bucket fail, try the remaining buckets */
 	if (_isSweepingSmall) {
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
+			MM_HeapRegionQueue **queueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
-				allocationQueue = &queueArray[j%_splitAvailableListSplitCount];
+				allocationQueue = queueArray[j%_splitAvailableListSplitCount];
 				region = allocationQueue->dequeueIfNonEmpty();
 				if (region != NULL) {
 					return region;
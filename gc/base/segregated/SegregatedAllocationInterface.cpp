@@ -35,6 +35,7 @@
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
+#include "SegregatedAllocationTracker.hpp"
 
 #include "SegregatedAllocationInterface.hpp"
 
@@ -188,6 +189,10 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		++_stats._allocationCount;
 	}
 
+	if ((NULL != cell) && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) && (NULL != env->_allocationTracker)) {
+		env->_allocationTracker->recordAllocationSize(env, sizeInBytes);
+	}
+
 	return cell;
 }
 
@@ -204,6 +209,11 @@ MM_SegregatedAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_Allo
 		++_stats._allocationCount;
 	}
 
+	uintptr_t sizeInBytes = allocateDescription->getBytesRequested();
+	if ((NULL != result) && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) && (NULL != env->_allocationTracker)) {
+		env->_allocationTracker->recordAllocationSize(env, sizeInBytes);
+	}
+
 	return result;
 }
 
@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
 #include "omrcomp.h"
 #include "omrport.h"
 
@@ -28,6 +30,7 @@
 #include "GCExtensionsBase.hpp"
 
 #include "SegregatedAllocationTracker.hpp"
+#include "SizeClasses.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -60,6 +63,16 @@ MM_SegregatedAllocationTracker::initialize(MM_EnvironmentBase *env, uintptr_t vo
 	_flushThreshold = flushThreshold;
 	_globalBytesInUse = globalBytesInUse;
 	updateAllocationTrackerThreshold(env);
+
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	if ((NULL != sizeClasses) && sizeClasses->isRecordingAllocationSizes()) {
+		uintptr_t histogramSize = sizeof(uint64_t) * OMR_SIZECLASSES_HISTOGRAM_BINS;
+		_sizeHistogram = (uint64_t *)env->getForge()->allocate(histogramSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _sizeHistogram) {
+			return false;
+		}
+		memset(_sizeHistogram, 0, histogramSize);
+	}
 	return true;
 }
 
@@ -71,6 +84,12 @@ MM_SegregatedAllocationTracker::tearDown(MM_EnvironmentBase *env)
 	 */
 	flushBytes();
 	updateAllocationTrackerThreshold(env);
+
+	if (NULL != _sizeHistogram) {
+		flushSizeHistogram(env);
+		env->getForge()->free(_sizeHistogram);
+		_sizeHistogram = NULL;
+	}
 }
 
 void
@@ -124,6 +143,18 @@ MM_SegregatedAllocationTracker::addBytesFreed(MM_EnvironmentBase *env, uintptr_t
 	}
 }
 
+void
+MM_SegregatedAllocationTracker::flushSizeHistogram(MM_EnvironmentBase *env)
+{
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	/* the size classes are gone once the heap is torn down, after they were written */
+	if ((NULL != _sizeHistogram) && (0 != _sizeHistogramSamples) && (NULL != sizeClasses)) {
+		sizeClasses->mergeAllocationSizeHistogram(_sizeHistogram);
+		memset(_sizeHistogram, 0, sizeof(uint64_t) * OMR_SIZECLASSES_HISTOGRAM_BINS);
+		_sizeHistogramSamples = 0;
+	}
+}
+
 /**
  * Atomically adds this thread's bytes in use to the global memory pool's bytes in use variable used to obtain the current free space approximation.
  */
@@ -24,6 +24,9 @@
 #define SEGREGATEDALLOCATIONTRACKER_HPP_
 
 #include "omrcomp.h"
+#include "modronbase.h"
+
+#include "SizeClassTable.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -32,11 +35,16 @@ class MM_EnvironmentBase;
 class MM_SegregatedAllocationTracker : public MM_BaseVirtual
 {
 public:
+	enum {
+		SIZE_HISTOGRAM_FLUSH_SAMPLES = 4096 /**< Allocations a thread records before merging them into MM_SizeClasses */
+	};
 protected:
 private: 
 	intptr_t _bytesAllocated; /**< A negative amount indicates this tracker has freed more bytes than allocated. */
 	uintptr_t _flushThreshold; /**< If |bytesAllocated| > this threshold, we'll flush the bytes allocated to the pool. */
 	volatile uintptr_t *_globalBytesInUse; /**< The memory pool accumulator to flush bytes to */
+	uint64_t *_sizeHistogram; /**< Small allocations of this thread by size, not yet merged into MM_SizeClasses. NULL unless -Xgc:sizeClassHistogram= is specified. */
+	uintptr_t _sizeHistogramSamples; /**< Allocations recorded in _sizeHistogram since it was last merged */
 
 public:
 	static MM_SegregatedAllocationTracker* newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, uintptr_t flushThreshold);
@@ -48,6 +56,26 @@ public:
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	void addBytesFreed(MM_EnvironmentBase* env, uintptr_t bytesFreed);
 	intptr_t getUnflushedBytesAllocated(MM_EnvironmentBase* env) { return _bytesAllocated; }
+
+	/**
+	 * Record the size of a small allocation, when allocation sizes are being recorded.
+	 */
+	MMINLINE void
+	recordAllocationSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes)
+	{
+		if (NULL != _sizeHistogram) {
+			_sizeHistogram[MM_SizeClassTable::getHistogramBin(sizeInBytes)] += 1;
+			_sizeHistogramSamples += 1;
+			if (_sizeHistogramSamples >= SIZE_HISTOGRAM_FLUSH_SAMPLES) {
+				flushSizeHistogram(env);
+			}
+		}
+	}
+
+	/**
+	 * Merge the allocation sizes recorded by this thread into those of all threads.
+	 */
+	void flushSizeHistogram(MM_EnvironmentBase* env);
 	
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, uintptr_t flushThreshold);
@@ -58,6 +86,8 @@ private:
 		_bytesAllocated(0)
 		,_flushThreshold(0)
 		,_globalBytesInUse(NULL)
+		,_sizeHistogram(NULL)
+		,_sizeHistogramSamples(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdlib.h>
+
+#include "SizeClassTable.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* The smallest cell size, in granules */
+#define SMALLEST_CELL_GRANULES ((1 << OMR_SIZECLASSES_LOG_SMALLEST) / OMR_SIZECLASSES_HISTOGRAM_GRANULE)
+/* The largest cell size, in granules */
+#define LARGEST_CELL_GRANULES (OMR_SIZECLASSES_HISTOGRAM_BINS - 1)
+
+/**
+ * @return the bytes at the end of a region no cell of cellSize fits in, per cell of the region
+ */
+static double
+getRegionTailPerCell(uintptr_t cellSize, uintptr_t regionSize)
+{
+	return (double)(regionSize % cellSize) / (double)(regionSize / cellSize);
+}
+
+/**
+ * Skip whitespace and comments.
+ * @return the first character of the next token, or the terminating NUL
+ */
+static const char *
+skipToToken(const char *text)
+{
+	while ('\0' != *text) {
+		if ('#' == *text) {
+			while (('\0' != *text) && ('\n' != *text)) {
+				text += 1;
+			}
+		} else if ((' ' == *text) || ('\t' == *text) || ('\n' == *text) || ('\r' == *text)) {
+			text += 1;
+		} else {
+			break;
+		}
+	}
+	return text;
+}
+
+/**
+ * Parse the decimal number at the start of text.
+ * @return false if text does not start with a number
+ */
+static bool
+parseNumber(const char **text, uint64_t *value)
+{
+	char *end = NULL;
+	if ((**text < '0') || (**text > '9')) {
+		return false;
+	}
+	*value = (uint64_t)strtoull(*text, &end, 10);
+	*text = end;
+	return true;
+}
+
+bool
+MM_SizeClassTable::isValidTable(const uintptr_t *cellSizes, uintptr_t classCount)
+{
+	if ((0 == classCount) || (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES != cellSizes[classCount - 1])) {
+		return false;
+	}
+	uintptr_t previousCellSize = (1 << OMR_SIZECLASSES_LOG_SMALLEST) - 1;
+	for (uintptr_t sizeClass = 0; sizeClass < classCount; sizeClass++) {
+		if ((cellSizes[sizeClass] <= previousCellSize) || (0 != (cellSizes[sizeClass] % OMR_SIZECLASSES_HISTOGRAM_GRANULE))) {
+			return false;
+		}
+		previousCellSize = cellSizes[sizeClass];
+	}
+	return true;
+}
+
+void
+MM_SizeClassTable::computeWaste(const uint64_t *histogram, const uintptr_t *cellSizes, uintptr_t classCount, uintptr_t regionSize, Waste *waste)
+{
+	waste->allocations = 0;
+	waste->requestedBytes = 0;
+	waste->cellBytes = 0;
+	waste->regionTailBytes = 0.0;
+
+	uintptr_t sizeClass = 0;
+	double regionTailPerCell = getRegionTailPerCell(cellSizes[0], regionSize);
+	for (uintptr_t bin = 0; bin < OMR_SIZECLASSES_HISTOGRAM_BINS; bin++) {
+		uintptr_t size = bin * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		while (cellSizes[sizeClass] < size) {
+			sizeClass += 1;
+			regionTailPerCell = getRegionTailPerCell(cellSizes[sizeClass], regionSize);
+		}
+		uint64_t count = histogram[bin];
+		waste->allocations += count;
+		waste->requestedBytes += count * size;
+		waste->cellBytes += count * cellSizes[sizeClass];
+		waste->regionTailBytes += (double)count * regionTailPerCell;
+	}
+}
+
+bool
+MM_SizeClassTable::computeOptimalTable(const uint64_t *histogram, uintptr_t classCount, uintptr_t regionSize, uintptr_t *cellSizes)
+{
+	if ((0 == classCount) || (classCount > OMR_SIZECLASSES_NUM_SMALL) || (classCount > (LARGEST_CELL_GRANULES - SMALLEST_CELL_GRANULES + 1))) {
+		return false;
+	}
+
+	/* allocations and requested bytes of the bins before each bin */
+	double allocationsBefore[OMR_SIZECLASSES_HISTOGRAM_BINS + 1];
+	double bytesBefore[OMR_SIZECLASSES_HISTOGRAM_BINS + 1];
+	allocationsBefore[0] = 0.0;
+	bytesBefore[0] = 0.0;
+	for (uintptr_t bin = 0; bin < OMR_SIZECLASSES_HISTOGRAM_BINS; bin++) {
+		allocationsBefore[bin + 1] = allocationsBefore[bin] + (double)histogram[bin];
+		bytesBefore[bin + 1] = bytesBefore[bin] + ((double)histogram[bin] * (double)(bin * OMR_SIZECLASSES_HISTOGRAM_GRANULE));
+	}
+
+	/* The waste of a class of cells of last granules, given the allocations of bins first to last. Size classes
+	 * partition the bins, so the waste of the best table of k classes up to bin last is the least, over the
+	 * last bin of the (k - 1)th class, of the waste of the best table of k - 1 classes up to that bin plus the
+	 * waste of the kth class.
+	 */
+	double bestWaste[OMR_SIZECLASSES_HISTOGRAM_BINS];
+	double nextBestWaste[OMR_SIZECLASSES_HISTOGRAM_BINS];
+	uint16_t previousLastBin[OMR_SIZECLASSES_NUM_SMALL][OMR_SIZECLASSES_HISTOGRAM_BINS];
+	for (uintptr_t last = SMALLEST_CELL_GRANULES; last <= LARGEST_CELL_GRANULES; last++) {
+		uintptr_t cellSize = last * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		double allocations = allocationsBefore[last + 1];
+		bestWaste[last] = (allocations * ((double)cellSize + getRegionTailPerCell(cellSize, regionSize))) - bytesBefore[last + 1];
+		previousLastBin[0][last] = 0;
+	}
+	for (uintptr_t classes = 2; classes <= classCount; classes++) {
+		uintptr_t firstLast = SMALLEST_CELL_GRANULES + classes - 1;
+		for (uintptr_t last = firstLast; last <= LARGEST_CELL_GRANULES; last++) {
+			uintptr_t cellSize = last * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+			double cellCost = (double)cellSize + getRegionTailPerCell(cellSize, regionSize);
+			double best = -1.0;
+			for (uintptr_t previous = firstLast - 1; previous < last; previous++) {
+				double allocations = allocationsBefore[last + 1] - allocationsBefore[previous + 1];
+				double waste = bestWaste[previous] + (allocations * cellCost) - (bytesBefore[last + 1] - bytesBefore[previous + 1]);
+				if ((best < 0.0) || (waste < best)) {
+					best = waste;
+					previousLastBin[classes - 1][last] = (uint16_t)previous;
+				}
+			}
+			nextBestWaste[last] = best;
+		}
+		for (uintptr_t last = firstLast; last <= LARGEST_CELL_GRANULES; last++) {
+			bestWaste[last] = nextBestWaste[last];
+		}
+	}
+
+	/* the last class must hold the largest small allocations */
+	uintptr_t last = LARGEST_CELL_GRANULES;
+	for (uintptr_t sizeClass = classCount; sizeClass > 0; sizeClass--) {
+		cellSizes[sizeClass - 1] = last * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		last = previousLastBin[sizeClass - 1][last];
+	}
+	return true;
+}
+
+bool
+MM_SizeClassTable::parseHistogram(const char *text, uint64_t *histogram)
+{
+	text = skipToToken(text);
+	while ('\0' != *text) {
+		uint64_t size = 0;
+		uint64_t count = 0;
+		if (!parseNumber(&text, &size) || (size > OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+			return false;
+		}
+		text = skipToToken(text);
+		if (!parseNumber(&text, &count)) {
+			return false;
+		}
+		histogram[getHistogramBin((uintptr_t)size)] += count;
+		text = skipToToken(text);
+	}
+	return true;
+}
+
+bool
+MM_SizeClassTable::parseTable(const char *text, uintptr_t *cellSizes, uintptr_t maxClassCount, uintptr_t *classCount)
+{
+	uintptr_t count = 0;
+	text = skipToToken(text);
+	while ('\0' != *text) {
+		uint64_t cellSize = 0;
+		if ((count == maxClassCount) || !parseNumber(&text, &cellSize) || (cellSize > OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+			return false;
+		}
+		cellSizes[count] = (uintptr_t)cellSize;
+		count += 1;
+		text = skipToToken(text);
+	}
+	*classCount = count;
+	return isValidTable(cellSizes, count);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Realtime
+ */
+
+#if !defined(SIZECLASSTABLE_HPP_)
+#define SIZECLASSTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "sizeclasses.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* Allocation sizes are recorded, and cell sizes chosen, in multiples of this many bytes */
+#define OMR_SIZECLASSES_HISTOGRAM_GRANULE 8
+/* One histogram bin per granule of the small allocation sizes, bin 0 included */
+#define OMR_SIZECLASSES_HISTOGRAM_BINS ((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / OMR_SIZECLASSES_HISTOGRAM_GRANULE) + 1)
+
+/**
+ * Computations on size class tables shared by MM_SizeClasses, which records allocation size histograms and
+ * loads tables at startup, and the offline tool that turns histograms into tables (perftest/gcsizeclasses).
+ *
+ * A histogram counts small allocations by size, rounded up to OMR_SIZECLASSES_HISTOGRAM_GRANULE bytes: bin b
+ * counts the allocations of (b - 1) * granule + 1 to b * granule bytes. A table lists the cell size of every
+ * small size class in increasing order, the last being OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES.
+ *
+ * Histograms are written one "size count" pair per line, tables as whitespace separated cell sizes, and lines
+ * starting with '#' are comments in both.
+ */
+class MM_SizeClassTable
+{
+/* Data members */
+public:
+	/**
+	 * The fragmentation of the heap under a table, for the allocations of a histogram.
+	 */
+	struct Waste {
+		uint64_t allocations; /**< Allocations in the histogram */
+		uint64_t requestedBytes; /**< Bytes requested by the allocations, each rounded up to the granule */
+		uint64_t cellBytes; /**< Bytes of the cells the allocations were given */
+		double regionTailBytes; /**< Bytes at the end of regions no cell fits in, the share of the allocations' cells */
+
+		/**
+		 * @return the bytes lost to fragmentation, in percent of the bytes the allocations took from the heap
+		 */
+		double
+		getWastePercent() const
+		{
+			double heapBytes = (double)cellBytes + regionTailBytes;
+			return (0.0 == heapBytes) ? 0.0 : (100.0 * (heapBytes - (double)requestedBytes) / heapBytes);
+		}
+	};
+
+/* Methods */
+public:
+	/**
+	 * @return the histogram bin of an allocation of sizeInBytes
+	 */
+	MMINLINE static uintptr_t
+	getHistogramBin(uintptr_t sizeInBytes)
+	{
+		return (sizeInBytes + OMR_SIZECLASSES_HISTOGRAM_GRANULE - 1) / OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+	}
+
+	/**
+	 * @param cellSizes[in] the cell sizes of the table
+	 * @param classCount[in] the number of size classes of the table
+	 * @return true if the heap can use the table: strictly increasing multiples of the granule, no smaller than
+	 * 1 << OMR_SIZECLASSES_LOG_SMALLEST and up to OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES
+	 */
+	static bool isValidTable(const uintptr_t *cellSizes, uintptr_t classCount);
+
+	/**
+	 * Measure the fragmentation of the heap under a table.
+	 * @param histogram[in] OMR_SIZECLASSES_HISTOGRAM_BINS allocation counts
+	 * @param cellSizes[in] the cell sizes of a valid table
+	 * @param classCount[in] the number of size classes of the table
+	 * @param regionSize[in] the bytes of a region
+	 * @param waste[out] the fragmentation
+	 */
+	static void computeWaste(const uint64_t *histogram, const uintptr_t *cellSizes, uintptr_t classCount, uintptr_t regionSize, Waste *waste);
+
+	/**
+	 * Find the table of classCount size classes that wastes the fewest bytes, in cells and region tails, for the
+	 * allocations of a histogram.
+	 * @param histogram[in] OMR_SIZECLASSES_HISTOGRAM_BINS allocation counts
+	 * @param classCount[in] the number of size classes, at most OMR_SIZECLASSES_NUM_SMALL
+	 * @param regionSize[in] the bytes of a region
+	 * @param cellSizes[out] the classCount cell sizes of the table
+	 * @return false if no table of classCount size classes exists
+	 */
+	static bool computeOptimalTable(const uint64_t *histogram, uintptr_t classCount, uintptr_t regionSize, uintptr_t *cellSizes);
+
+	/**
+	 * Parse a histogram, adding its counts to histogram.
+	 * @param text[in] NUL terminated histogram
+	 * @param histogram[in,out] OMR_SIZECLASSES_HISTOGRAM_BINS allocation counts
+	 * @return false if the text is not a histogram of small allocation sizes
+	 */
+	static bool parseHistogram(const char *text, uint64_t *histogram);
+
+	/**
+	 * Parse a table.
+	 * @param text[in] NUL terminated table
+	 * @param cellSizes[out] up to maxClassCount cell sizes
+	 * @param maxClassCount[in] the capacity of cellSizes
+	 * @param classCount[out] the number of size classes of the table
+	 * @return false if the text does not hold a valid table of at most maxClassCount size classes
+	 */
+	static bool parseTable(const char *text, uintptr_t *cellSizes, uintptr_t maxClassCount, uintptr_t *classCount);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SIZECLASSTABLE_HPP_ */
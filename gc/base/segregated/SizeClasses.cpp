@@ -19,9 +19,16 @@
  *
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
+#include <string.h>
+
+#include "omrport.h"
+
 #include "SizeClasses.hpp"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SizeClassTable.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -61,7 +68,20 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 	_smallNumCells = sizeClasses->smallNumCells;
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
 	
+	MM_GCExtensionsBase *extensions = env->getExtensions();
 	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	if ((NULL != extensions->sizeClassTableFileName) && !loadCellSizes(env, extensions->sizeClassTableFileName)) {
+		return false;
+	}
+
+	if (NULL != extensions->sizeClassHistogramFileName) {
+		uintptr_t histogramSize = sizeof(uint64_t) * OMR_SIZECLASSES_HISTOGRAM_BINS;
+		_allocationSizeHistogram = (uint64_t *)env->getForge()->allocate(histogramSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _allocationSizeHistogram) {
+			return false;
+		}
+		memset(_allocationSizeHistogram, 0, histogramSize);
+	}
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
@@ -79,7 +99,100 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 void
 MM_SizeClasses::tearDown(MM_EnvironmentBase *envModron)
 {
-	
+	if (NULL != _allocationSizeHistogram) {
+		envModron->getForge()->free(_allocationSizeHistogram);
+		_allocationSizeHistogram = NULL;
+	}
+}
+
+/**
+ * Replace the cell sizes of sizeclasses.h with those of a table written by the size class table generator.
+ * The table must have as many size classes as sizeclasses.h, which fixes their number at build time.
+ * @return false if the file can not be read or does not hold such a table
+ */
+bool
+MM_SizeClasses::loadCellSizes(MM_EnvironmentBase *env, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	bool result = false;
+	char *text = NULL;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 != fd) {
+		int64_t fileSize = omrfile_flength(fd);
+		if (fileSize >= 0) {
+			text = (char *)env->getForge()->allocate((uintptr_t)fileSize + 1, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		}
+		if (NULL != text) {
+			intptr_t bytesRead = omrfile_read(fd, text, (intptr_t)fileSize);
+			if (bytesRead == (intptr_t)fileSize) {
+				uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL];
+				uintptr_t classCount = 0;
+				text[fileSize] = '\0';
+				if (MM_SizeClassTable::parseTable(text, cellSizes, OMR_SIZECLASSES_NUM_SMALL, &classCount) && (OMR_SIZECLASSES_NUM_SMALL == classCount)) {
+					memcpy(_smallCellSizes + OMR_SIZECLASSES_MIN_SMALL, cellSizes, sizeof(cellSizes));
+					result = true;
+				} else {
+					omrtty_printf("GC: %s does not hold a table of %d increasing cell sizes, multiples of %d bytes up to %d bytes\n",
+						fileName, OMR_SIZECLASSES_NUM_SMALL, OMR_SIZECLASSES_HISTOGRAM_GRANULE, OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES);
+				}
+			}
+			env->getForge()->free(text);
+		}
+		omrfile_close(fd);
+	}
+
+	if ((!result) && ((-1 == fd) || (NULL == text))) {
+		omrtty_printf("GC: unable to read size class table %s\n", fileName);
+	}
+	return result;
+}
+
+void
+MM_SizeClasses::mergeAllocationSizeHistogram(const uint64_t *histogram)
+{
+	for (uintptr_t bin = 0; bin < OMR_SIZECLASSES_HISTOGRAM_BINS; bin++) {
+		if (0 != histogram[bin]) {
+			MM_AtomicOperations::addU64(&_allocationSizeHistogram[bin], histogram[bin]);
+		}
+	}
+}
+
+bool
+MM_SizeClasses::writeAllocationSizeHistogram(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	const char *fileName = extensions->sizeClassHistogramFileName;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		omrtty_printf("GC: unable to write size class histogram %s\n", fileName);
+		return false;
+	}
+	omrfile_printf(fd, "# small allocation sizes, rounded up to %d bytes: size count\n", OMR_SIZECLASSES_HISTOGRAM_GRANULE);
+	for (uintptr_t bin = 0; bin < OMR_SIZECLASSES_HISTOGRAM_BINS; bin++) {
+		if (0 != _allocationSizeHistogram[bin]) {
+			omrfile_printf(fd, "%zu %llu\n", bin * OMR_SIZECLASSES_HISTOGRAM_GRANULE, (unsigned long long)_allocationSizeHistogram[bin]);
+		}
+	}
+	omrfile_close(fd);
+
+	/* how much better the size classes could fit these allocations */
+	uintptr_t optimalCellSizes[OMR_SIZECLASSES_NUM_SMALL];
+	MM_SizeClassTable::Waste currentWaste;
+	MM_SizeClassTable::Waste optimalWaste;
+	MM_SizeClassTable::computeWaste(_allocationSizeHistogram, _smallCellSizes + OMR_SIZECLASSES_MIN_SMALL, OMR_SIZECLASSES_NUM_SMALL, extensions->regionSize, &currentWaste);
+	if (MM_SizeClassTable::computeOptimalTable(_allocationSizeHistogram, OMR_SIZECLASSES_NUM_SMALL, extensions->regionSize, optimalCellSizes)) {
+		MM_SizeClassTable::computeWaste(_allocationSizeHistogram, optimalCellSizes, OMR_SIZECLASSES_NUM_SMALL, extensions->regionSize, &optimalWaste);
+		omrtty_printf("GC: %llu small allocations written to %s, fragmentation %.2f%% with the current size classes, %.2f%% with:\n",
+			(unsigned long long)currentWaste.allocations, fileName, currentWaste.getWastePercent(), optimalWaste.getWastePercent());
+		for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL; sizeClass++) {
+			omrtty_printf(" %zu", optimalCellSizes[sizeClass]);
+		}
+		omrtty_printf("\n");
+	}
+	return true;
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
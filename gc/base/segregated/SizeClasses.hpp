@@ -42,6 +42,7 @@ private:
 	uintptr_t* _smallCellSizes; /**< Array mapping size classes to the cell size of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _smallNumCells; /**< Array mapping size classes to the number of cells on a region of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _sizeClassIndex; /**< maps size request to size classes. The array actually lives in the OMR vm. */
+	uint64_t* _allocationSizeHistogram; /**< Small allocations of all threads by size, see MM_SizeClassTable. NULL unless -Xgc:sizeClassHistogram= is specified. */
 	
 /* Methods */
 public:
@@ -72,16 +73,36 @@ public:
 		}
 		return _sizeClassIndex[sizeInBytes / sizeof(uintptr_t)];
 	}
+
+	MMINLINE bool isRecordingAllocationSizes() const { return NULL != _allocationSizeHistogram; }
+
+	/**
+	 * Add the allocation sizes a thread recorded to those of all threads.
+	 * @param histogram[in] OMR_SIZECLASSES_HISTOGRAM_BINS allocation counts
+	 */
+	void mergeAllocationSizeHistogram(const uint64_t *histogram);
+
+	/**
+	 * Write the allocation sizes of all threads to the -Xgc:sizeClassHistogram= file, and report the
+	 * fragmentation of the heap under the current size classes and under the best ones for those sizes.
+	 * @return false if the file could not be written
+	 */
+	bool writeAllocationSizeHistogram(MM_EnvironmentBase *env);
 	
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	MM_SizeClasses(MM_EnvironmentBase* env)
+		: _smallCellSizes(NULL)
+		, _smallNumCells(NULL)
+		, _sizeClassIndex(NULL)
+		, _allocationSizeHistogram(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
 	
 private:
+	bool loadCellSizes(MM_EnvironmentBase *env, const char *fileName);
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -24,6 +24,10 @@
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
+#include <string.h>
+
+#include "omrthread.h"
+
 #include "CompactScheme.hpp"
 
 #include "ModronAssertions.h"
@@ -36,6 +40,7 @@
 #include "CompactSchemeFixupObject.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreeEntrySizeClassStats.hpp"
 #include "Heap.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "HeapMapIterator.hpp"
@@ -44,14 +49,17 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "HeapStats.hpp"
+#include "LargeObjectAllocateStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParallelSweepChunk.hpp"
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #include "SlotObject.hpp"
@@ -71,6 +79,9 @@
 #define getConsumedSizeInBytesWithHeaderForMove getConsumedSizeInBytesWithHeader
 #endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 
+/* Pauses a thread spins for while waiting on an earlier stripe before it yields the processor */
+#define STRIPE_WAIT_SPIN_COUNT 1024
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -280,12 +291,40 @@ public:
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 {
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* Objects may grow as they move, so their new location can not be derived from the mark map alone */
+	_extensions->stripedCompaction = false;
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 	return _delegate.initialize(env, _omrVM, _markMap, this);
 }
 
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _stripeBlocks) {
+		env->getForge()->free(_stripeBlocks);
+		_stripeBlocks = NULL;
+		_stripeBlockCount = 0;
+	}
+	if (NULL != _compactCardTable) {
+		_compactCardTable->kill(env);
+		_compactCardTable = NULL;
+	}
+	if (NULL != _fragmentationSamples) {
+		env->getForge()->free(_fragmentationSamples);
+		_fragmentationSamples = NULL;
+		_fragmentationSampleSize = 0;
+	}
+	if (NULL != _evacuationCandidates) {
+		env->getForge()->free(_evacuationCandidates);
+		_evacuationCandidates = NULL;
+		_evacuationCandidateSize = 0;
+	}
+	if (NULL != _evacuatedPages) {
+		env->getForge()->free(_evacuatedPages);
+		_evacuatedPages = NULL;
+		_evacuatedPageWords = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -358,6 +397,9 @@ MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThrea
 	setRealLimitsSubAreas(env);
 	removeNullSubAreas(env);
 	completeSubAreaTable(env);
+	if (_partialThisCycle) {
+		selectEvacuatedSubAreas(env);
+	}
 }
 
 void
@@ -369,9 +411,271 @@ MM_CompactScheme::mainSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	_stripedThisCycle = _extensions->stripedCompaction && ensureStripeBlocks(env);
 	_delegate.mainSetupForGC(env);
 }
 
+bool
+MM_CompactScheme::ensureStripeBlocks(MM_EnvironmentStandard *env)
+{
+	uintptr_t heapSize = (uintptr_t)_heap->getHeapTop() - _heapBase;
+	uintptr_t blockCount = (heapSize + J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+
+	if (blockCount > _stripeBlockCount) {
+		if (NULL != _stripeBlocks) {
+			env->getForge()->free(_stripeBlocks);
+		}
+		_stripeBlocks = (StripeBlock *)env->getForge()->allocate(blockCount * sizeof(StripeBlock), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		/* without the table we fall back to evacuating sub areas */
+		_stripeBlockCount = (NULL == _stripeBlocks) ? 0 : blockCount;
+	}
+
+	return NULL != _stripeBlocks;
+}
+
+void
+MM_CompactScheme::prepareCardTableForMark(MM_EnvironmentBase *env, bool fullMark)
+{
+	if (_extensions->partialCompaction) {
+		if (NULL == _compactCardTable) {
+			/* without the table every compaction is a full one */
+			_compactCardTable = MM_CompactCardTable::newInstance(env, _extensions->heap->getHeapBase(), _extensions->heap->getHeapTop());
+		}
+		if (NULL != _compactCardTable) {
+			if (fullMark) {
+				_compactCardTable->clear(env);
+				_markingScheme->setCompactCardTable(_compactCardTable);
+			} else {
+				/* objects scanned while mutators were running may have been updated since */
+				_compactCardTable->setValid(false);
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::finishCardTableAfterMark(MM_EnvironmentBase *env)
+{
+	if (NULL != _markingScheme->getCompactCardTable()) {
+		_markingScheme->setCompactCardTable(NULL);
+		_compactCardTable->setValid(true);
+	}
+}
+
+bool
+MM_CompactScheme::shouldCompactPartially(MM_EnvironmentStandard *env, bool aggressive)
+{
+	/* An aggressive compaction has to remove every hole, and with a single sub area per region (see compact())
+	 * there is nothing to choose from. The chunks of a concurrent sweep may not all have been swept.
+	 */
+	return _extensions->partialCompaction
+		&& !aggressive
+		&& (1 < env->_currentTask->getThreadCount())
+		&& !_extensions->usingSATBBarrier()
+		&& !_extensions->isConcurrentSweepEnabled()
+		&& (NULL != _compactCardTable)
+		&& _compactCardTable->isValid()
+		&& ensureEvacuatedPages(env)
+		&& sampleFragmentation(env);
+}
+
+bool
+MM_CompactScheme::ensureEvacuatedPages(MM_EnvironmentStandard *env)
+{
+	uintptr_t heapSize = (uintptr_t)_heap->getHeapTop() - _heapBase;
+	uintptr_t pageCount = (heapSize + sizeof_page - 1) / sizeof_page;
+	uintptr_t wordCount = (pageCount + J9BITS_BITS_IN_SLOT - 1) / J9BITS_BITS_IN_SLOT;
+
+	if (wordCount > _evacuatedPageWords) {
+		if (NULL != _evacuatedPages) {
+			env->getForge()->free(_evacuatedPages);
+		}
+		_evacuatedPages = (uintptr_t *)env->getForge()->allocate(wordCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		/* without the bitmap every compaction is a full one */
+		_evacuatedPageWords = (NULL == _evacuatedPages) ? 0 : wordCount;
+	}
+
+	return NULL != _evacuatedPages;
+}
+
+bool
+MM_CompactScheme::sampleFragmentation(MM_EnvironmentStandard *env)
+{
+	MM_SweepHeapSectioningIterator sectioningIterator(_extensions->sweepHeapSectioning);
+	uintptr_t chunkCount = 0;
+	while (NULL != sectioningIterator.nextChunk()) {
+		chunkCount += 1;
+	}
+
+	if (chunkCount > _fragmentationSampleSize) {
+		if (NULL != _fragmentationSamples) {
+			env->getForge()->free(_fragmentationSamples);
+		}
+		_fragmentationSamples = (FragmentationSample *)env->getForge()->allocate(chunkCount * sizeof(FragmentationSample), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_fragmentationSampleSize = (NULL == _fragmentationSamples) ? 0 : chunkCount;
+	}
+	if (NULL == _fragmentationSamples) {
+		return false;
+	}
+
+	_fragmentationSampleCount = 0;
+	sectioningIterator.restart(_extensions->sweepHeapSectioning);
+	MM_ParallelSweepChunk *chunk = NULL;
+	while (NULL != (chunk = sectioningIterator.nextChunk())) {
+		if (NULL != chunk->chunkBase) {
+			FragmentationSample *sample = &_fragmentationSamples[_fragmentationSampleCount];
+			sample->chunkBase = chunk->chunkBase;
+			sample->freeBytes = chunk->freeBytes;
+			/* the largest entry of a chunk is what allocation can still use, the rest of its free space is scattered */
+			sample->fragmentedBytes = chunk->_darkMatterBytes;
+			if (chunk->freeBytes > chunk->_largestFreeEntry) {
+				sample->fragmentedBytes += chunk->freeBytes - chunk->_largestFreeEntry;
+			}
+			_fragmentationSampleCount += 1;
+		}
+	}
+
+	/* free entries too small for a TLH only become usable once compacted */
+	_fragmentedFreeBytes = 0;
+	MM_HeapMemoryPoolIterator poolIterator(env, _heap);
+	MM_MemoryPool *memoryPool = NULL;
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		MM_LargeObjectAllocateStats *allocateStats = memoryPool->getLargeObjectAllocateStats();
+		if (NULL != allocateStats) {
+			MM_FreeEntrySizeClassStats *freeEntryStats = allocateStats->getFreeEntrySizeClassStats();
+			for (uintptr_t sizeClassIndex = 0; sizeClassIndex < freeEntryStats->getMaxSizeClasses(); sizeClassIndex++) {
+				uintptr_t sizeClassSize = allocateStats->getSizeClassSizes(sizeClassIndex);
+				if (sizeClassSize >= _extensions->tlhMinimumSize) {
+					break;
+				}
+				_fragmentedFreeBytes += freeEntryStats->getCount(sizeClassIndex) * sizeClassSize;
+			}
+		}
+	}
+
+	return true;
+}
+
+int
+MM_CompactScheme::compareEvacuationCandidates(const void *element1, const void *element2)
+{
+	EvacuationCandidate *candidate1 = (EvacuationCandidate *)element1;
+	EvacuationCandidate *candidate2 = (EvacuationCandidate *)element2;
+
+	if (candidate1->fragmentedBytes == candidate2->fragmentedBytes) {
+		/* keep the address order, so that evacuated sub areas tend to find free chunks below them */
+		if (candidate1->subAreaIndex == candidate2->subAreaIndex) {
+			return 0;
+		}
+		return (candidate1->subAreaIndex < candidate2->subAreaIndex) ? -1 : 1;
+	} else if (candidate1->fragmentedBytes > candidate2->fragmentedBytes) {
+		return -1;
+	} else {
+		return 1;
+	}
+}
+
+void
+MM_CompactScheme::selectEvacuatedSubAreas(MM_EnvironmentStandard *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* unless selected below, a sub area is only fixed up */
+		uintptr_t subAreaCount = 0;
+		uintptr_t endHeapIndex = 0;
+		for (; SubAreaEntry::end_heap != _subAreaTable[endHeapIndex].state; endHeapIndex++) {
+			SubAreaEntry *subArea = &_subAreaTable[endHeapIndex];
+			if (SubAreaEntry::init == subArea->state) {
+				subArea->state = SubAreaEntry::fixup_only;
+				subArea->liveBytes = (uintptr_t)subArea[1].firstObject - (uintptr_t)subArea->firstObject;
+				subArea->fragmentedBytes = 0;
+				subAreaCount += 1;
+			}
+		}
+
+		/* charge every sweep chunk to the sub area it starts in */
+		uintptr_t totalFragmentedBytes = 0;
+		for (uintptr_t s = 0; s < _fragmentationSampleCount; s++) {
+			FragmentationSample *sample = &_fragmentationSamples[s];
+			/* the last entry starting at or below the chunk */
+			uintptr_t low = 0;
+			uintptr_t high = endHeapIndex;
+			while ((low + 1) < high) {
+				uintptr_t middle = (low + high) / 2;
+				if ((void *)_subAreaTable[middle].firstObject <= sample->chunkBase) {
+					low = middle;
+				} else {
+					high = middle;
+				}
+			}
+			SubAreaEntry *subArea = &_subAreaTable[low];
+			if ((SubAreaEntry::end_segment == subArea->state) && (SubAreaEntry::end_heap != subArea[1].state)) {
+				/* the end of the previous region, the chunk belongs to the first sub area of the next one */
+				subArea += 1;
+			}
+			if (SubAreaEntry::fixup_only == subArea->state) {
+				subArea->fragmentedBytes += sample->fragmentedBytes;
+				subArea->liveBytes -= OMR_MIN(subArea->liveBytes, sample->freeBytes);
+				totalFragmentedBytes += sample->fragmentedBytes;
+			}
+		}
+
+		if (subAreaCount > _evacuationCandidateSize) {
+			if (NULL != _evacuationCandidates) {
+				env->getForge()->free(_evacuationCandidates);
+			}
+			_evacuationCandidates = (EvacuationCandidate *)env->getForge()->allocate(subAreaCount * sizeof(EvacuationCandidate), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			_evacuationCandidateSize = (NULL == _evacuationCandidates) ? 0 : subAreaCount;
+		}
+
+		uintptr_t candidateCount = 0;
+		if (NULL != _evacuationCandidates) {
+			for (uintptr_t i = 0; i < endHeapIndex; i++) {
+				if ((SubAreaEntry::fixup_only == _subAreaTable[i].state) && (0 != _subAreaTable[i].fragmentedBytes)) {
+					_evacuationCandidates[candidateCount].fragmentedBytes = _subAreaTable[i].fragmentedBytes;
+					_evacuationCandidates[candidateCount].subAreaIndex = i;
+					candidateCount += 1;
+				}
+			}
+			J9_SORT(_evacuationCandidates, candidateCount, sizeof(EvacuationCandidate), compareEvacuationCandidates);
+		}
+
+		/* Recover the free space too small for a TLH if the size class statistics tell how much there is, or else
+		 * all the fragmented space the sweep found, as long as the live bytes to move stay within the budget.
+		 */
+		uintptr_t targetBytes = (0 != _fragmentedFreeBytes) ? _fragmentedFreeBytes : totalFragmentedBytes;
+		uintptr_t budgetBytes = _extensions->partialCompactionBudget;
+		uintptr_t selectedFragmentedBytes = 0;
+		uintptr_t selectedLiveBytes = 0;
+		uintptr_t evacuatedCount = 0;
+		_evacuatedSectors = 0;
+		memset(_evacuatedPages, 0, _evacuatedPageWords * sizeof(uintptr_t));
+		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+		_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+		for (uintptr_t c = 0; (c < candidateCount) && (selectedFragmentedBytes < targetBytes); c++) {
+			SubAreaEntry *subArea = &_subAreaTable[_evacuationCandidates[c].subAreaIndex];
+			/* a less fragmented sub area with fewer live objects may still fit */
+			if ((selectedLiveBytes + subArea->liveBytes) <= budgetBytes) {
+				subArea->state = SubAreaEntry::init;
+				selectedLiveBytes += subArea->liveBytes;
+				selectedFragmentedBytes += subArea->fragmentedBytes;
+				evacuatedCount += 1;
+				_evacuatedSectors |= _compactCardTable->getSectorMask(subArea->firstObject, subArea[1].firstObject);
+				/* a sub area owns the pages from the one holding its first object up to the one holding the next sub area's */
+				for (uintptr_t page = pageIndex(subArea->firstObject); page < (uintptr_t)pageIndex(subArea[1].firstObject); page++) {
+					_evacuatedPages[page / J9BITS_BITS_IN_SLOT] |= (uintptr_t)1 << (page % J9BITS_BITS_IN_SLOT);
+				}
+				_compactFrom = OMR_MIN(_compactFrom, subArea->firstObject);
+				_compactTo = OMR_MAX(_compactTo, subArea[1].firstObject);
+			}
+		}
+
+		env->_compactStats._subAreas = subAreaCount;
+		env->_compactStats._evacuatedSubAreas = evacuatedCount;
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
 omrobjectptr_t
 MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
 {
@@ -509,6 +813,8 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				j++;
 			}
 		}
+		/* the table is walked up to end_heap as well as region by region */
+		_subAreaTable[j].state = SubAreaEntry::end_heap;
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
@@ -556,6 +862,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		 * done at a synchronize point?
 		 */
 		mainSetupForGC(env);
+		_partialThisCycle = shouldCompactPartially(env, aggressive);
+		if (_partialThisCycle) {
+			/* a striped compaction moves every object, which is what partial compaction avoids */
+			_stripedThisCycle = false;
+		}
 #if defined(DEBUG)
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
@@ -572,12 +883,16 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
 	 *  o no worker GC threads
 	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier())) {
+	if ((aggressive && !_stripedThisCycle) || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier())) {
+		/* striped compaction slides every region down to its base, so several stripes per segment leave no holes */
 		singleThreaded = true;
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
 	workerSetupForGC(env, singleThreaded);
+	if (_stripedThisCycle) {
+		computeStripeForwarding(env);
+	}
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
 	/* If a single threaded compaction force compact to run on main thread. Required
@@ -585,20 +900,33 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	 */
 	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
-		env->_compactStats._moveEndTime = omrtime_hires_clock();
+		if (_stripedThisCycle) {
+			/* objects are fixed up as they move, there is no separate fixup pass */
+			slideStripes(env, objectCount, byteCount, fixupObjectsCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
+			env->_compactStats._fixupStartTime = env->_compactStats._moveEndTime;
+			env->_compactStats._fixupEndTime = env->_compactStats._moveEndTime;
+		} else {
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
 
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
 
-		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
 
-		fixupObjects(env, fixupObjectsCount);
+			fixupObjects(env, fixupObjectsCount);
 
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
+		}
 
 		if (singleThreaded) {
 			env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -627,7 +955,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_stripedThisCycle) {
+			rebuildMarkbitsForStripes(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -679,7 +1011,15 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 		poolState->_memoryPool = subAreaTable[i].memoryPool;
 
 		do {
-			if (NULL != subAreaTable[i].freeChunk) {
+			if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Nothing moved in or out of the sub area, its free space lies between its marked objects */
+				if (NULL != currentFreeBase) {
+					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
+					addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+				}
+				currentFreeSize = 0;
+				currentFreeBase = addFreeEntriesBetweenMarkedObjects(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject);
+			} else if (NULL != subAreaTable[i].freeChunk) {
 				if (subAreaTable[i].freeChunk == subAreaTable[i].firstObject) {
 					/* The entire sub area is free */
 					if (NULL == currentFreeBase) {
@@ -699,9 +1039,7 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
 			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
-				 */
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -727,6 +1065,23 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void *
+MM_CompactScheme::addFreeEntriesBetweenMarkedObjects(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t firstObject, omrobjectptr_t finish)
+{
+	uintptr_t freeBase = (uintptr_t)firstObject;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((uintptr_t)objectPtr > freeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, (void *)freeBase, (uintptr_t)objectPtr - freeBase);
+		}
+		freeBase = (uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
+	/* the space above the last object joins whatever free space starts the next sub area */
+	return (freeBase < (uintptr_t)finish) ? (void *)freeBase : NULL;
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1286,6 +1641,17 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return objectPtr;
 	}
 
+	/* evacuated sub areas need not be contiguous, the fixup_only ones between them did not move */
+	if (_partialThisCycle && !isPageEvacuated(pageIndex(objectPtr))) {
+		return objectPtr;
+	}
+
+	if (_stripedThisCycle) {
+		omrobjectptr_t forwardingPtr = getStripedForwardingPtr(objectPtr);
+		MM_CompactSchemeFixupObject::verifyForwardingPtr(objectPtr, forwardingPtr);
+		return forwardingPtr;
+	}
+
 	intptr_t index = pageIndex(objectPtr);
 	omrobjectptr_t forwardingPtr = _compactTable[index].getAddr();
 	if (forwardingPtr == 0) {
@@ -1357,7 +1723,11 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		if (_partialThisCycle && (SubAreaEntry::fixup_only == subAreaTable[i].state)) {
+        			fixupSubAreaCards(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, objectCount);
+        		} else {
+        			fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		}
 			}
         }
         /* Number of regions in regionTable, including
@@ -1402,6 +1772,226 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 	}
 }
 
+void
+MM_CompactScheme::fixupSubAreaCards(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish, uintptr_t& objectCount)
+{
+	if (0 == _evacuatedSectors) {
+		/* nothing moved, so nothing refers to a moved object */
+		return;
+	}
+
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+	uintptr_t cardSize = (uintptr_t)1 << COMPACT_CARD_SIZE_SHIFT;
+	uintptr_t top = (uintptr_t)pageStart(pageIndex(finish));
+	uintptr_t scanBase = (uintptr_t)firstObject;
+
+	while (scanBase < top) {
+		/* find the next run of cards whose objects referred to an evacuated sub area when they were marked */
+		uintptr_t scanTop = scanBase;
+		while ((scanTop < top) && _compactCardTable->isCardReferringTo((void *)scanTop, _evacuatedSectors)) {
+			scanTop = _heapBase + MM_Math::roundToFloor(cardSize, scanTop - _heapBase) + cardSize;
+		}
+		scanTop = OMR_MIN(scanTop, top);
+
+		if (scanBase < scanTop) {
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)scanBase, (uintptr_t *)scanTop);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				objectCount++;
+				fixupObject.fixupObject(env, objectPtr);
+			}
+			scanBase = scanTop;
+		} else {
+			scanBase = _heapBase + MM_Math::roundToFloor(cardSize, scanBase - _heapBase) + cardSize;
+		}
+	}
+}
+
+void
+MM_CompactScheme::computeStripeForwarding(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+		if ((SubAreaEntry::end_segment != _subAreaTable[i].state) && changeSubAreaAction(env, &_subAreaTable[i], SubAreaEntry::summarizing)) {
+			summarizeStripe(env, &_subAreaTable[i]);
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		setStripeDestinations(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Blocks were summarized relative to the destination of their stripe, which is now known */
+	for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+		if ((SubAreaEntry::end_segment != _subAreaTable[i].state) && changeSubAreaAction(env, &_subAreaTable[i], SubAreaEntry::rebasing)) {
+			uintptr_t block = ((uintptr_t)_subAreaTable[i].firstObject - _heapBase) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+			uintptr_t endBlock = ((uintptr_t)pageStart(pageIndex(_subAreaTable[i + 1].firstObject)) - _heapBase) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+			uintptr_t destination = (uintptr_t)_subAreaTable[i].destination;
+			/* blocks without objects are rebased too, harmlessly, since no forwarding address is ever looked up in them */
+			for (; block < endBlock; block++) {
+				_stripeBlocks[block].forwardingPtr = (omrobjectptr_t)((uintptr_t)_stripeBlocks[block].forwardingPtr + destination);
+			}
+		}
+	}
+
+	/* Any thread may look up the forwarding address of any object as soon as objects start moving */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+}
+
+void
+MM_CompactScheme::summarizeStripe(MM_EnvironmentStandard *env, SubAreaEntry *stripe)
+{
+	/* as in doCompact(), no object of the stripe starts in the page of the first object of the next sub area */
+	omrobjectptr_t finish = pageStart(pageIndex(stripe[1].firstObject));
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)stripe[0].firstObject, (uintptr_t *)finish);
+	StripeBlock *block = NULL;
+	uintptr_t liveBytes = 0;
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t heapOffset = (uintptr_t)objectPtr - _heapBase;
+		StripeBlock *objectBlock = &_stripeBlocks[heapOffset / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT];
+		if (block != objectBlock) {
+			/* pages never straddle stripes, so the block belongs to this stripe alone */
+			block = objectBlock;
+			block->liveBits = 0;
+			block->forwardingPtr = (omrobjectptr_t)liveBytes;
+		}
+
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		assume0(0 == (objectSize % J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT));
+		uintptr_t bitIndex = (heapOffset % J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+		/* Granules past the end of the block are never needed: the objects that follow start in later blocks */
+		uintptr_t granules = OMR_MIN(objectSize / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT, J9BITS_BITS_IN_SLOT - bitIndex);
+		uintptr_t mask = (J9BITS_BITS_IN_SLOT == granules) ? UDATA_MAX : (((uintptr_t)1 << granules) - 1);
+		block->liveBits |= mask << bitIndex;
+		liveBytes += objectSize;
+	}
+
+	stripe[0].liveBytes = liveBytes;
+}
+
+void
+MM_CompactScheme::setStripeDestinations(MM_EnvironmentStandard *env)
+{
+	uintptr_t regionStart = 0;
+
+	while (SubAreaEntry::end_heap != _subAreaTable[regionStart].state) {
+		/* Every region slides down to its base, which is where its first sub area starts */
+		omrobjectptr_t destination = _subAreaTable[regionStart].firstObject;
+		uintptr_t regionEnd = regionStart;
+		for (; SubAreaEntry::end_segment != _subAreaTable[regionEnd].state; regionEnd++) {
+			_subAreaTable[regionEnd].destination = destination;
+			destination = (omrobjectptr_t)((uintptr_t)destination + _subAreaTable[regionEnd].liveBytes);
+		}
+		_subAreaTable[regionEnd].destination = destination;
+
+		/* Describe the free space above the compacted objects the way rebuildFreelist() expects it */
+		for (uintptr_t i = regionStart; i < regionEnd; i++) {
+			if (_subAreaTable[i].firstObject >= destination) {
+				_subAreaTable[i].freeChunk = _subAreaTable[i].firstObject;
+			} else if (_subAreaTable[i + 1].firstObject > destination) {
+				_subAreaTable[i].freeChunk = destination;
+			} else {
+				_subAreaTable[i].freeChunk = NULL;
+			}
+		}
+
+		regionStart = regionEnd + 1;
+	}
+}
+
+void
+MM_CompactScheme::slideStripes(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount)
+{
+	/* Stripes must be claimed in address order, see slideStripe() */
+	for (intptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+		if ((SubAreaEntry::end_segment != _subAreaTable[i].state) && changeSubAreaAction(env, &_subAreaTable[i], SubAreaEntry::evacuating)) {
+			slideStripe(env, i, objectCount, byteCount, fixupObjectCount);
+		}
+	}
+}
+
+void
+MM_CompactScheme::slideStripe(MM_EnvironmentStandard *env, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount)
+{
+	SubAreaEntry *stripe = &_subAreaTable[i];
+	omrobjectptr_t destinationEnd = (omrobjectptr_t)((uintptr_t)stripe->destination + stripe->liveBytes);
+
+	/* Objects only slide down, so the destination of the stripe may still hold objects of earlier stripes
+	 * of the region. Those were claimed before this one by threads that are not waiting on this stripe,
+	 * so waiting for them can not deadlock.
+	 */
+	for (intptr_t j = i - 1; (j >= 0) && (SubAreaEntry::end_segment != _subAreaTable[j].state) && (_subAreaTable[j + 1].firstObject > stripe->destination); j--) {
+		if (_subAreaTable[j].firstObject < destinationEnd) {
+			uintptr_t spinCount = 0;
+			while (SubAreaEntry::full != _subAreaTable[j].state) {
+				spinCount += 1;
+				if (0 == (spinCount % STRIPE_WAIT_SPIN_COUNT)) {
+					omrthread_yield();
+				} else {
+					MM_AtomicOperations::yieldCPU();
+				}
+			}
+			MM_AtomicOperations::loadSync();
+		}
+	}
+
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+	omrobjectptr_t finish = pageStart(pageIndex(_subAreaTable[i + 1].firstObject));
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)stripe->firstObject, (uintptr_t *)finish);
+	omrobjectptr_t objectPtr = NULL;
+	omrobjectptr_t forwardingPtr = stripe->destination;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		assume0(forwardingPtr == getStripedForwardingPtr(objectPtr));
+
+		if (forwardingPtr != objectPtr) {
+			preObjectMove(env, objectPtr);
+			memmove(forwardingPtr, objectPtr, objectSize);
+			postObjectMove(env, forwardingPtr);
+			objectCount += 1;
+			byteCount += objectSize;
+		}
+
+		/* Forwarding addresses come from the stripe blocks, so slots can be fixed up whether or not their referents have moved yet */
+		fixupObject.fixupObject(env, forwardingPtr);
+		fixupObjectCount += 1;
+
+		forwardingPtr = (omrobjectptr_t)((uintptr_t)forwardingPtr + objectSize);
+	}
+	Assert_MM_true(forwardingPtr == destinationEnd);
+
+	MM_AtomicOperations::storeSync();
+	uintptr_t state = MM_AtomicOperations::lockCompareExchange(&stripe->state, SubAreaEntry::init, SubAreaEntry::full);
+	Assert_MM_true(SubAreaEntry::init == state);
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsForStripes(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+		if ((SubAreaEntry::end_segment != _subAreaTable[i].state) && changeSubAreaAction(env, &_subAreaTable[i], SubAreaEntry::clearing_mark_bits)) {
+			_markMap->setBitsInRange(env, pageStart(pageIndex(_subAreaTable[i].firstObject)), pageStart(pageIndex(_subAreaTable[i + 1].firstObject)), true);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+		if ((SubAreaEntry::end_segment != _subAreaTable[i].state) && changeSubAreaAction(env, &_subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+			/* The objects of a stripe are contiguous from its destination. Neighbouring stripes may share mark words */
+			omrobjectptr_t end = (omrobjectptr_t)((uintptr_t)_subAreaTable[i].destination + _subAreaTable[i].liveBytes);
+			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, _subAreaTable[i].destination, end, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				_markMap->atomicSetBit(objectPtr);
+			}
+		}
+	}
+}
+
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
@@ -1417,7 +2007,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1492,7 +2082,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
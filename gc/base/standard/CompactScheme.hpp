@@ -29,6 +29,8 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 #include "BaseVirtual.hpp"
+#include "Bits.hpp"
+#include "CompactCardTable.hpp"
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
@@ -92,13 +94,19 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t liveBytes; /**< Bytes of marked objects in the sub area (striped and partial compaction only) */
+		omrobjectptr_t destination; /**< New address of the first marked object in the sub area (striped compaction only) */
+		uintptr_t fragmentedBytes; /**< Free bytes the sweep left outside the largest free entry of its chunks in the sub area (partial compaction only) */
         
 		/* legal values for currentAction */
 		enum {
 			none = 0,
 			setting_real_limits,
+			summarizing,
+			rebasing,
 			evacuating,
 			fixing_up,
+			clearing_mark_bits,
 			rebuilding_mark_bits,
 			fixing_heap_for_walk
 		};
@@ -139,6 +147,48 @@ protected:
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
 
+	/**
+	 * Summary of the objects starting in the heap covered by one mark map slot, used by striped compaction.
+	 */
+	struct StripeBlock {
+		uintptr_t liveBits; /**< One bit per mark map granule covered by an object starting in the block */
+		omrobjectptr_t forwardingPtr; /**< New address of the first object starting in the block */
+	};
+
+	StripeBlock            *_stripeBlocks; /**< One entry per mark map slot of the heap, allocated the first time a striped compaction is done */
+	uintptr_t              _stripeBlockCount; /**< Number of entries in _stripeBlocks */
+	bool                   _stripedThisCycle; /**< True if the current compaction slides the sub areas as stripes */
+
+	/**
+	 * Free space found by the sweep in one of its chunks, kept for partial compaction since the sub area table
+	 * reuses the storage of the sweep chunks.
+	 */
+	struct FragmentationSample {
+		void *chunkBase; /**< Base of the sweep chunk */
+		uintptr_t freeBytes; /**< Free bytes in the chunk */
+		uintptr_t fragmentedBytes; /**< Free bytes outside the largest free entry of the chunk, plus its dark matter */
+	};
+
+	/**
+	 * A sub area ranked for evacuation by partial compaction.
+	 */
+	struct EvacuationCandidate {
+		uintptr_t fragmentedBytes; /**< Fragmented free bytes of the sub area */
+		uintptr_t subAreaIndex; /**< Index of the sub area in the sub area table */
+	};
+
+	MM_CompactCardTable    *_compactCardTable; /**< References of the heap recorded by the last mark, allocated the first time partial compaction is enabled */
+	FragmentationSample    *_fragmentationSamples; /**< Samples of the sweep chunks of the current cycle (partial compaction only) */
+	uintptr_t              _fragmentationSampleCount; /**< Valid entries in _fragmentationSamples */
+	uintptr_t              _fragmentationSampleSize; /**< Allocated entries in _fragmentationSamples */
+	EvacuationCandidate    *_evacuationCandidates; /**< Sub areas of the current cycle, most fragmented first (partial compaction only) */
+	uintptr_t              _evacuationCandidateSize; /**< Allocated entries in _evacuationCandidates */
+	uintptr_t              _fragmentedFreeBytes; /**< Free bytes the heap holds in entries too small for a TLH, the most a partial compaction needs to recover */
+	uintptr_t              _evacuatedSectors; /**< Card table sectors overlapping the sub areas evacuated by the current partial compaction */
+	uintptr_t              *_evacuatedPages; /**< One bit per page of the heap, set for the pages of the sub areas evacuated by the current partial compaction */
+	uintptr_t              _evacuatedPageWords; /**< Allocated words in _evacuatedPages */
+	bool                   _partialThisCycle; /**< True if the current compaction only evacuates the most fragmented sub areas */
+
 public:
 
 	/*
@@ -218,8 +268,131 @@ protected:
 	void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
+	/**
+	 * Fix up the marked objects of a sub area that was not evacuated, skipping the cards which refer to none
+	 * of the evacuated sub areas.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] firstObject The first object in the subArea
+	 * @param[in] finish The first object of the next subArea
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 */
+	void fixupSubAreaCards(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish, uintptr_t& objectCount);
+
 	void rebuildFreelist(MM_EnvironmentStandard *env);
 
+	/**
+	 * Add the gaps between the marked objects of a sub area that was not evacuated to the free list.
+	 *
+	 * @return the start of the free space following the last marked object of the sub area, or NULL if there is none
+	 */
+	void *addFreeEntriesBetweenMarkedObjects(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t firstObject, omrobjectptr_t finish);
+
+	/**
+	 * Decide whether the current compaction can evacuate only the most fragmented sub areas, which needs the
+	 * references recorded by the mark of this cycle.
+	 */
+	bool shouldCompactPartially(MM_EnvironmentStandard *env, bool aggressive);
+
+	/**
+	 * Keep the free space found in each sweep chunk, and the free space held in entries too small for a TLH,
+	 * before the sub area table and the free list rebuild overwrite them.
+	 * @return true if the samples could be kept
+	 */
+	bool sampleFragmentation(MM_EnvironmentStandard *env);
+
+	/**
+	 * Make sure the evacuated page bitmap covers the whole heap.
+	 * @return true if the bitmap could be allocated
+	 */
+	bool ensureEvacuatedPages(MM_EnvironmentStandard *env);
+
+	/**
+	 * The compact table only holds forwarding information for the pages of evacuated sub areas, elsewhere it
+	 * still holds the mark map.
+	 * @return true if the page was evacuated by the current partial compaction
+	 */
+	MMINLINE bool
+	isPageEvacuated(uintptr_t page) const
+	{
+		return 0 != (_evacuatedPages[page / J9BITS_BITS_IN_SLOT] & ((uintptr_t)1 << (page % J9BITS_BITS_IN_SLOT)));
+	}
+
+	/**
+	 * Rank the sub areas by the fragmented free space the sweep found in them, and leave the most fragmented
+	 * ones to be evacuated until the partial compaction budget is spent or the fragmented free space of the
+	 * heap is covered. Every other sub area is only fixed up.
+	 */
+	void selectEvacuatedSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Order evacuation candidates by decreasing fragmented free bytes, for J9_SORT.
+	 */
+	static int compareEvacuationCandidates(const void *element1, const void *element2);
+
+	/**
+	 * Make sure the stripe block table covers the whole heap.
+	 * @return true if the table could be allocated
+	 */
+	bool ensureStripeBlocks(MM_EnvironmentStandard *env);
+
+	/**
+	 * Compute the forwarding addresses of all stripes (sub areas). Each thread summarizes the stripes it claims
+	 * from the mark map, the main thread turns the live bytes of the stripes into destinations with a prefix sum
+	 * over each region, and the forwarding addresses of the blocks of each stripe are then rebased in parallel.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void computeStripeForwarding(MM_EnvironmentStandard *env);
+
+	/**
+	 * Record the live granules and relative forwarding addresses of the objects starting in a stripe.
+	 *
+	 * @param env[in] the current thread
+	 * @param stripe[in] the stripe, followed by the sub area that bounds it
+	 */
+	void summarizeStripe(MM_EnvironmentStandard *env, SubAreaEntry *stripe);
+
+	/**
+	 * Set the destination of each stripe, and the free chunk later used to rebuild the free list, from the
+	 * live bytes of the stripes before it in the same region.
+	 */
+	void setStripeDestinations(MM_EnvironmentStandard *env);
+
+	/**
+	 * Slide the objects of every stripe to their destination, fixing up the slots of each object as soon as it
+	 * has moved. A stripe is moved once all earlier stripes overlapping its destination have been moved.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 * @param[in/out] fixupObjectCount the number of objects fixed up (accumulated)
+	 */
+	void slideStripes(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount);
+
+	/**
+	 * Slide and fix up the objects of the stripe at index i of the sub area table.
+	 */
+	void slideStripe(MM_EnvironmentStandard *env, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectCount);
+
+	/**
+	 * Rebuild the mark bits of the heap after a striped compaction.
+	 */
+	void rebuildMarkbitsForStripes(MM_EnvironmentStandard *env);
+
+	/**
+	 * Answer the new location of an object, from the stripe block table alone.
+	 */
+	MMINLINE omrobjectptr_t
+	getStripedForwardingPtr(omrobjectptr_t objectPtr) const
+	{
+		uintptr_t heapOffset = (uintptr_t)objectPtr - _heapBase;
+		StripeBlock *block = &_stripeBlocks[heapOffset / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT];
+		uintptr_t bitIndex = (heapOffset % J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+		uintptr_t granulesBefore = MM_Bits::populationCount(block->liveBits & (((uintptr_t)1 << bitIndex) - 1));
+		return (omrobjectptr_t)((uintptr_t)block->forwardingPtr + (granulesBefore * J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT));
+	}
+
 	void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -303,6 +476,20 @@ protected:
 	 */
 	bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
 public:
+	/**
+	 * Start recording the references of scanned objects in the card table used by partial compaction.
+	 * Must be called by the main thread before every global mark.
+	 *
+	 * @param env[in] the main thread
+	 * @param fullMark[in] true if the mark starts from a cleared mark map, with no mutator running until it completes
+	 */
+	void prepareCardTableForMark(MM_EnvironmentBase *env, bool fullMark);
+
+	/**
+	 * Stop recording references, once the mark has completed.
+	 */
+	void finishCardTableAfterMark(MM_EnvironmentBase *env);
+
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
 	void kill(MM_EnvironmentBase *env);
@@ -336,6 +523,20 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _stripeBlocks(NULL)
+		, _stripeBlockCount(0)
+		, _stripedThisCycle(false)
+		, _compactCardTable(NULL)
+		, _fragmentationSamples(NULL)
+		, _fragmentationSampleCount(0)
+		, _fragmentationSampleSize(0)
+		, _evacuationCandidates(NULL)
+		, _evacuationCandidateSize(0)
+		, _fragmentedFreeBytes(0)
+		, _evacuatedSectors(0)
+		, _evacuatedPages(NULL)
+		, _evacuatedPageWords(0)
+		, _partialThisCycle(false)
 	{
 		_typeId = __FUNCTION__;
 	}
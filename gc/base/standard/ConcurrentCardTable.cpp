@@ -26,6 +26,10 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#if defined(OMR_ARCH_X86) && (defined(OMR_ENV_DATA64) || defined(__SSE2__) || defined(_MSC_VER))
+#include <emmintrin.h>
+#define OMR_CARD_TABLE_SCAN_SSE2
+#endif /* defined(OMR_ARCH_X86) && (defined(OMR_ENV_DATA64) || defined(__SSE2__) || defined(_MSC_VER)) */
 
 #include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -592,6 +596,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 {
 	Card *baseCard = heapAddrToCardAddr(env, heapBase);
 	Card *topCard = heapAddrToCardAddr(env, heapTop);
+	Card *firstCard = baseCard;
 
 	while(baseCard <= topCard) {
 		/* If card not already dirty then dirty it */
@@ -600,6 +605,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		}
 		baseCard += 1;
 	}
+	summarizeCardRange(firstCard, baseCard);
 }
 
 /**
@@ -954,6 +960,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			summarizeCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1000,6 +1007,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isScavengerRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		summarizeCard(card);
 	}
 
 	return true;
@@ -1042,6 +1050,10 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 bool
 MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *bytesTraced)
 {
+	if (isSummaryEnabled()) {
+		return finalCleanCardsInPartitions(env, bytesTraced);
+	}
+
 	uintptr_t traceCount = 0;
 	Card * nextDirtyCard;
 	omrobjectptr_t objectPtr;
@@ -1100,6 +1112,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	env->_cardCleaningStats._cardsCleaned += cards;
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1108,6 +1121,101 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	return (NULL == nextDirtyCard) ? false : true;
 }
 
+/**
+ * Do final card cleaning a partition at a time.
+ *
+ * Used instead of finalCleanCards() when the card table is summarized. Rather than
+ * racing for every dirty card, each thread claims a partition of the cleaning ranges
+ * (the cards summarized by one slot of the summary) and cleans all the dirty cards in it,
+ * skipping the groups of cards the summary shows were not dirtied. A thread which has
+ * pushed enough references returns part way through its partition and resumes it on
+ * its next call.
+ *
+ * @param bytesTraced  - reference to counter to pass back count of bytes traced
+ * 						 to caller
+ *
+ * @return return TRUE is any more cards left to process; FALSE if all cards
+ * 			processed. Also returns number of bytes traced whilst cleaning cards.
+ */
+bool
+MM_ConcurrentCardTable::finalCleanCardsInPartitions(MM_EnvironmentBase *env, uintptr_t *bytesTraced)
+{
+	uintptr_t traceCount = 0;
+	uintptr_t phase1Cards = 0;
+	uintptr_t phase2Cards = 0;
+	bool moreCards = true;
+
+	/* Set upper limit of refs we push before returning to one packets worth */
+	uintptr_t maxPushes = _markingScheme->getWorkPackets()->getSlotsInPacket();
+
+	/* Reset the number of pushes to this threads stack to zero */
+	env->_workStack.clearPushCount();
+
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+
+	/* Resume the partition left when we last returned to process the refs pushed */
+	Card *card = env->_cardCleaningPartitionNext;
+	Card *partitionTop = env->_cardCleaningPartitionTop;
+
+	while (true) {
+		if (card >= partitionTop) {
+			if (!getNextCleaningPartition(env, &card, &partitionTop)) {
+				/* All partitions claimed and this thread has cleaned its own */
+				card = NULL;
+				partitionTop = NULL;
+				moreCards = false;
+				break;
+			}
+			env->_cardCleaningStats._cardPartitionsCleaned += 1;
+		}
+
+		card = skipCleanCards(env, card, partitionTop);
+		if (card < partitionTop) {
+			Card *dirtyCard = card;
+			card += 1;
+
+			if (0 != (*dirtyCard & _finalCardCleanMask)) {
+				if (dirtyCard < _firstCardInPhase2) {
+					phase1Cards += 1;
+				} else {
+					phase2Cards += 1;
+				}
+
+				/* Clean the card before we trace into it */
+				finalCleanCard(dirtyCard);
+
+				uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env, dirtyCard);
+				uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+
+				/* prevent loading mark bits prematurely */
+				MM_AtomicOperations::readBarrier();
+
+				MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
+				}
+
+				/* Have we pushed enough new refs ?*/
+				if (env->_workStack.getPushCount() >= maxPushes) {
+					break;
+				}
+			}
+		}
+	}
+
+	env->_cardCleaningPartitionNext = card;
+	env->_cardCleaningPartitionTop = partitionTop;
+
+	incFinalCleanedCards(phase1Cards, false);
+	incFinalCleanedCards(phase2Cards, true);
+	env->_cardCleaningStats._cardsCleaned += (phase1Cards + phase2Cards);
+
+	*bytesTraced = traceCount;
+
+	return moreCards;
+}
+
 /**
  * Process TLH mark bits
  * Set or clear bits within the TLH mark bit map. The bit map contains one bit for
@@ -1627,25 +1735,14 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
+			/* Is the card clean? If so skip the clean cards which follow it many at a
+	 		 * time until we find one which is not or the end of card table is found.
+	 		 * This is based on the premise that the card table will be mostly
+	 		 * empty and skipping cards in bulk will reduce the time taken to
 	 		 * scan the card table.
 	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
+			if ((Card)CARD_CLEAN == *currentCard) {
+				currentCard = skipCleanCards(env, currentCard, lastCardToClean);
 
 				if (currentCard >= lastCardToClean) {
 					break;
@@ -1726,6 +1823,139 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 	return NULL;
 }
 
+/**
+ * Find the first card which is not clean in a range, many cards at a time.
+ *
+ * @param card - first card of the range
+ * @param topCard - card after the last card of the range
+ *
+ * @return address of the first card which is not clean, topCard if none
+ */
+MMINLINE static Card *
+findCardNotClean(Card *card, Card *topCard)
+{
+#if defined(OMR_CARD_TABLE_SCAN_SSE2)
+	/* Get to a 16 byte boundary a card at a time, then compare 16 cards at a time */
+	while ((card < topCard) && (0 != ((uintptr_t)card & (sizeof(__m128i) - 1)))) {
+		if ((Card)CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+	const __m128i clean = _mm_setzero_si128();
+	while (((uintptr_t)topCard - (uintptr_t)card) >= sizeof(__m128i)) {
+		__m128i cards = _mm_load_si128((const __m128i *)card);
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(cards, clean))) {
+			break;
+		}
+		card += sizeof(__m128i);
+	}
+#else /* defined(OMR_CARD_TABLE_SCAN_SSE2) */
+	/* Get to an uintptr_t boundary a card at a time, then compare an uintptr_t worth of cards at a time */
+	while ((card < topCard) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+		if ((Card)CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+	while ((((uintptr_t)topCard - (uintptr_t)card) >= sizeof(uintptr_t)) && (SLOT_ALL_CLEAN == *(uintptr_t *)card)) {
+		card += sizeof(uintptr_t);
+	}
+#endif /* defined(OMR_CARD_TABLE_SCAN_SSE2) */
+
+	/* Either end of range or a block which contains a card not clean found */
+	while ((card < topCard) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+
+	return card;
+}
+
+Card *
+MM_ConcurrentCardTable::skipCleanCards(MM_EnvironmentBase *env, Card *card, Card *topCard)
+{
+	MM_CardCleaningStats *stats = &env->_cardCleaningStats;
+	Card *cardTableStart = getCardTableStart();
+	Card *found = topCard;
+
+	if (!isSummaryEnabled()) {
+		found = findCardNotClean(card, topCard);
+		stats->_cardsScanned += (found - card);
+	} else {
+		while (card < topCard) {
+			uintptr_t cardIndex = (uintptr_t)(card - cardTableStart);
+			if ((0 == (cardIndex % CARD_SUMMARY_CARDS_PER_SLOT)) && (0 == getSummarySlot(card))) {
+				/* No card dirtied in any group of the slot */
+				card += CARD_SUMMARY_CARDS_PER_SLOT;
+				stats->_cardGroupsSkipped += CARD_SUMMARY_BITS_IN_SLOT;
+			} else {
+				Card *groupTop = cardTableStart + MM_Math::roundToFloor(CARD_SUMMARY_GROUP_SIZE, cardIndex) + CARD_SUMMARY_GROUP_SIZE;
+				if (!isCardGroupSummarized(card)) {
+					/* No card dirtied in the group */
+					stats->_cardGroupsSkipped += 1;
+				} else {
+					Card *scanTop = OMR_MIN(groupTop, topCard);
+					Card *notClean = findCardNotClean(card, scanTop);
+					stats->_cardsScanned += (notClean - card);
+					if (notClean < scanTop) {
+						found = notClean;
+						break;
+					}
+				}
+				card = groupTop;
+			}
+		}
+	}
+
+	return found;
+}
+
+/**
+ * Get the next partition of the cleaning ranges for final card cleaning.
+ *
+ * @param partitionBase - set to the first card of the partition
+ * @param partitionTop - set to the card after the last card of the partition
+ *
+ * @return false if no cards are left to claim.
+ */
+bool
+MM_ConcurrentCardTable::getNextCleaningPartition(MM_EnvironmentBase *env, Card **partitionBase, Card **partitionTop)
+{
+	Card *cardTableStart = getCardTableStart();
+	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
+
+	while (currentRange < _lastCleaningRange) {
+		Card *firstCard = (Card *)currentRange->nextCard;
+		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
+		Card *lastCardInPhase = _lastCardInPhase;
+		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
+
+		if (firstCard < lastCardToClean) {
+			/* Partitions end where the cards summarized by a slot of the summary do */
+			uintptr_t firstIndex = (uintptr_t)(firstCard - cardTableStart);
+			Card *top = cardTableStart + MM_Math::roundToFloor(CARD_SUMMARY_CARDS_PER_SLOT, firstIndex) + CARD_SUMMARY_CARDS_PER_SLOT;
+			top = OMR_MIN(top, lastCardToClean);
+
+			/* If we fail then someone beat us to it so re-sync with race winner and try again */
+			if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+																				(uintptr_t)firstCard,
+																				(uintptr_t)top)) {
+				*partitionBase = firstCard;
+				*partitionTop = top;
+				return true;
+			}
+		} else {
+			/* Range complete so switch to next cleaning range */
+			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange, (uintptr_t)currentRange, (uintptr_t)(currentRange + 1));
+		}
+
+		currentRange = (CleaningRange *)_currentCleaningRange;
+	}
+
+	/* All ranges claimed */
+	return false;
+}
+
 /**
  * Set TLH mark bits
  *
@@ -231,6 +231,25 @@ protected:
 	
 	bool cleanSingleCard(MM_EnvironmentBase *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
 	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
+
+	/**
+	 * Skip the clean cards of a range, a group of the summary (or a slot of groups) at a time when the card table
+	 * is summarized, and otherwise (within the groups that may hold dirty cards) many cards at a time.
+	 * @param[in] card First card to look at
+	 * @param[in] topCard Card after the last card to look at
+	 * @return The first card of the range which is not clean, topCard if none
+	 */
+	Card *skipCleanCards(MM_EnvironmentBase *env, Card *card, Card *topCard);
+
+	/**
+	 * Claim the next partition of the cleaning ranges for final card cleaning. Partitions end on the cards
+	 * summarized by a slot of the summary, so cleaning one only looks up the summary a slot at a time.
+	 * @param[out] partitionBase First card of the partition
+	 * @param[out] partitionTop Card after the last card of the partition
+	 * @return false if all the cleaning ranges have been claimed
+	 */
+	bool getNextCleaningPartition(MM_EnvironmentBase *env, Card **partitionBase, Card **partitionTop);
+	bool finalCleanCardsInPartitions(MM_EnvironmentBase *env, uintptr_t *bytesTraced);
 	
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
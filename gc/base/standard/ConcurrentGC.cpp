@@ -461,6 +461,19 @@ MM_ConcurrentGC::initialize(MM_EnvironmentBase *env)
 	_allocToTraceRateMinFactor = ((float)1) / interpolateInRange(MIN_ALLOC_2_TRACE_RATE_1, MIN_ALLOC_2_TRACE_RATE_8, MIN_ALLOC_2_TRACE_RATE_10, _allocToTraceRateNormal);
 	_allocToTraceRateMaxFactor = interpolateInRange(MAX_ALLOC_2_TRACE_RATE_1, MAX_ALLOC_2_TRACE_RATE_8, MAX_ALLOC_2_TRACE_RATE_10, _allocToTraceRateNormal);
 
+	if (_extensions->concurrentPacer) {
+		_stats.setPacer(&_pacer);
+	}
+
+	if (_extensions->concurrentBackgroundMark && (_conHelperThreads > 0)) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t budgetPercent = (uint64_t)_extensions->concurrentBackgroundCPUPercent * omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+		/* No need to throttle helpers that cannot use more processors than they are allowed */
+		if (budgetPercent < ((uint64_t)_conHelperThreads * 100)) {
+			_conHelperCPUBudget = ((uint64_t)CONCURRENT_HELPER_BUDGET_WINDOW_MILLIS * 1000000 * OMR_MAX(budgetPercent, 1)) / 100;
+		}
+	}
+
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 	/* Has user elected to run with an LOA ? */
 	if (_extensions->largeObjectArea) {
@@ -791,6 +804,50 @@ MM_ConcurrentGC::getConHelperRequest(MM_EnvironmentBase *env)
 	return result;
 }
 
+MM_ConcurrentGC::ConHelperRequest
+MM_ConcurrentGC::throttleConHelper(MM_EnvironmentBase *env, int64_t *cpuTime)
+{
+	if (0 == _conHelperCPUBudget) {
+		return getConHelperRequest(env);
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	int64_t currentCPUTime = omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread);
+	uint64_t cpuTimeUsed = ((-1 != currentCPUTime) && (currentCPUTime > *cpuTime)) ? (uint64_t)(currentCPUTime - *cpuTime) : 0;
+	*cpuTime = currentCPUTime;
+	_stats.incConHelperCPUTime((uintptr_t)(cpuTimeUsed / 1000));
+
+	uint64_t waitMillis = 0;
+	omrthread_monitor_enter(_conHelpersActivationMonitor);
+	uint64_t now = omrtime_hires_clock();
+	uint64_t elapsedMillis = omrtime_hires_delta(_conHelperBudgetWindowStart, now, OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+	if (elapsedMillis >= CONCURRENT_HELPER_BUDGET_WINDOW_MILLIS) {
+		/* Start a new window, carrying over what the helpers used beyond the budget of the last one */
+		_conHelperBudgetCPUTime = (_conHelperBudgetCPUTime > _conHelperCPUBudget) ? (_conHelperBudgetCPUTime - _conHelperCPUBudget) : 0;
+		_conHelperBudgetWindowStart = now;
+		elapsedMillis = 0;
+	}
+	_conHelperBudgetCPUTime += cpuTimeUsed;
+	if ((CONCURRENT_HELPER_MARK == _conHelpersRequest) && (_conHelperBudgetCPUTime > _conHelperCPUBudget)) {
+		waitMillis = CONCURRENT_HELPER_BUDGET_WINDOW_MILLIS - elapsedMillis;
+	}
+	omrthread_monitor_exit(_conHelpersActivationMonitor);
+
+	if (0 != waitMillis) {
+		_stats.incConHelperThrottleCount();
+		/* Let a collection proceed while waiting; a shutdown or a request to stop marking ends the wait */
+		env->releaseVMAccess();
+		omrthread_monitor_enter(_conHelpersActivationMonitor);
+		if (CONCURRENT_HELPER_MARK == _conHelpersRequest) {
+			omrthread_monitor_wait_timed(_conHelpersActivationMonitor, (int64_t)waitMillis, 0);
+		}
+		omrthread_monitor_exit(_conHelpersActivationMonitor);
+		env->acquireVMAccess();
+	}
+
+	return getConHelperRequest(env);
+}
+
 void
 MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID)
 {
@@ -799,6 +856,7 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 	uintptr_t sizeTraced = 0;
 	uintptr_t totalScanned = 0;
 	uintptr_t sizeToTrace = 0;
+	int64_t cpuTime = 0;
 	MM_SpinLimiter spinLimiter(env);
 
 	/* Thread not a mutator so identify its type */
@@ -833,6 +891,7 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 		reportConcurrentBackgroundThreadActivated(env);
 
 		spinLimiter.reset();
+		cpuTime = omrthread_get_self_cpu_time(omrThread->_os_thread);
 
 		/* perform trace work */
 		while ((CONCURRENT_HELPER_MARK == request)
@@ -844,7 +903,7 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 				totalScanned += sizeTraced;
 				spinLimiter.reset();
 			}
-			request = getConHelperRequest(env);
+			request = throttleConHelper(env, &cpuTime);
 		}
 
 		/* Collector specific Con Helper Work */
@@ -1126,6 +1185,11 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 
 		thisTraceRate = (float)((traceTarget - workCompleteSoFar) / (float)(remainingFree));
 
+		if (isBackgroundMarking() && (thisTraceRate <= _allocToTraceRate)) {
+			/* The helpers are keeping the cycle on schedule, so the mutator gets away without paying any tax */
+			return 0;
+		}
+
 		if (thisTraceRate > _allocToTraceRate) {
 	    /* The "over tracing" should not only adjust to the current ratio between
 	     * free space and estimated remaining tracing, but also try to do even more tracing, in
@@ -1367,7 +1431,7 @@ MM_ConcurrentGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool
 	if (_extensions->concurrentSweep) {
 		return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
 	}
-	return false;
+	return MM_ParallelGlobalGC::replenishPoolForAllocate(env, memoryPool, size);
 }
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
@@ -1465,7 +1529,8 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 			case CONCURRENT_TRACE_ONLY:
 			case CONCURRENT_CLEAN_TRACE:
 				sizeToTrace = calculateTraceSize(env, allocDescription);
-				if (sizeToTrace > 0) {
+				/* Without tax a background marking mutator still scans its stack and moves the cycle through its phases */
+				if ((sizeToTrace > 0) || isBackgroundMarking()) {
 					sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
 				}
 
@@ -1625,23 +1690,15 @@ MM_ConcurrentGC::forceKickoff(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpa
 }
 
 /**
- * Decide if we have reached the kickoff threshold for concurrent mark.
- *
- * @note This is a potential GC point.
+ * Determine how much "taxable" free space remains to be allocated.
  *
- * @return TRUE if concurrent KO threshold reached; FALSE  otherwise
+ * @return the free space the kickoff threshold is compared against
  */
-bool
-MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+uintptr_t
+MM_ConcurrentGC::taxableFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
 	uintptr_t remainingFree = 0;
 
-	/* If -Xgc:noConcurrentMarkKO specified then we never kickoff concurrent mark */
-	if (!_extensions->concurrentKickoffEnabled) {
-		return false;
-	}
-
-	/* Determine how much "taxable" free space remains to be allocated. */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if(_extensions->scavengerEnabled) {
 		remainingFree = potentialFreeSpace(env, allocDescription);
@@ -1658,6 +1715,26 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		remainingFree = targetPool->getApproximateFreeMemorySize();
 	}
 
+	return remainingFree;
+}
+
+/**
+ * Decide if we have reached the kickoff threshold for concurrent mark.
+ *
+ * @note This is a potential GC point.
+ *
+ * @return TRUE if concurrent KO threshold reached; FALSE  otherwise
+ */
+bool
+MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	/* If -Xgc:noConcurrentMarkKO specified then we never kickoff concurrent mark */
+	if (!_extensions->concurrentKickoffEnabled) {
+		return false;
+	}
+
+	uintptr_t remainingFree = taxableFreeSpace(env, allocDescription);
+
 	/* If we are already out of storage no point even starting concurrent */
 	if (0 == remainingFree) {
 		return false;
@@ -1677,6 +1754,9 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 				_languageKickoffReason = NO_LANGUAGE_KICKOFF_REASON;
 			}
 			_extensions->setConcurrentGlobalGCInProgress(true);
+			if (_extensions->concurrentPacer) {
+				_pacer.startCycle(remainingFree, _stats.getTraceSizeTarget());
+			}
 			reportConcurrentKickoff(env);
 		}
 		return true;
@@ -1685,6 +1765,37 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 	}
 }
 
+/**
+ * Replace the kickoff threshold and buffer just calculated by tuneToHeap() with those of the pacer,
+ * if -Xgc:concurrentPacer is set.
+ */
+void
+MM_ConcurrentGC::paceConcurrentKickoff(MM_EnvironmentBase *env)
+{
+	if (_extensions->concurrentPacer) {
+		uintptr_t tunedThreshold = _stats.getKickoffThreshold();
+		uintptr_t tunedBuffer = _kickoffThresholdBuffer;
+
+		_stats.setKickoffThreshold(_pacer.getKickoffThreshold(_stats.getTraceSizeTarget(), tunedThreshold, tunedBuffer, getAllocToTraceRateMax()));
+		/* calculateTraceSize() aims to complete tracing when free space drops to the buffer */
+		_kickoffThresholdBuffer = _pacer.getReserve(tunedBuffer);
+
+		if (_extensions->debugConcurrentMark) {
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			omrtty_printf("Pace kickoff : KO threshold=\"%zu\" (tuned \"%zu\") KO threshold buffer=\"%zu\" (tuned \"%zu\") correction=\"%.3f\"\n",
+								_stats.getKickoffThreshold(), tunedThreshold, _kickoffThresholdBuffer, tunedBuffer, _pacer.getCorrection());
+		}
+	}
+}
+
+void
+MM_ConcurrentGC::concurrentTracingExhausted(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	if (_extensions->concurrentPacer) {
+		_pacer.completeCycle(taxableFreeSpace(env, allocDescription));
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Run a concurrent sweep as part of the current allocation tax.
@@ -1978,6 +2089,20 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 	updateMeteringHistoryBeforeGC(env);
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 
+	if (_extensions->concurrentPacer) {
+		/* Explicit collections say nothing about the pacing, and cycles they cut short are not counted */
+		if (MM_GCCode(gcCode).isExplicitGC()) {
+			_pacer.abandonCycle();
+		} else if (_pacer.isCycleActive()) {
+			_pacer.endCycle(workCompleted());
+		} else if (_extensions->concurrentKickoffEnabled && (J9MMCONSTANT_IMPLICIT_GC_DEFAULT == gcCode)) {
+			/* Only a plain allocation failure before any cycle was kicked off says the kickoff came too late;
+			 * percolates and aggressive collections are caused by something other than the pacing.
+			 */
+			_pacer.endCycle(0);
+		}
+	}
+
 	/* Empty all the Packets if we are aborting concurrent mark.
 	 * If we have had a RS overflow or an explicit gc (resulting for idleness) then 
 	 * abort the concurrent collection regardless of how far we got to force a full STW mark.
@@ -2115,6 +2240,7 @@ MM_ConcurrentGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 	 */
 	if (_retuneAfterHeapResize || (CONCURRENT_OFF < _stats.getExecutionModeAtGC())) {
 		tuneToHeap(env);
+		paceConcurrentKickoff(env);
 	}
 
 	/* Collection is complete so reset flags */
@@ -2305,6 +2431,7 @@ MM_ConcurrentGC::heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReason re
 			 */
 			if (CONCURRENT_INIT_COMPLETE > _stats.getExecutionMode()) {
 				tuneToHeap(env);
+				paceConcurrentKickoff(env);
 			} else {
 				/* Heap expand/contract is during a concurrent cycle..we need to adjust the trace target so
 				 * that the trace rate is adjusted correctly on  subsequent allocates.
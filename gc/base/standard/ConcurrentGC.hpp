@@ -35,6 +35,7 @@
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGCStats.hpp"
+#include "ConcurrentPacer.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -75,6 +76,8 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define INITIAL_OLD_AREA_NON_LEAF_FACTOR ((float)0.4)
 #define NON_LEAF_HISTORY_WEIGHT ((float)0.8)
 #define CONCURRENT_HELPER_HISTORY_WEIGHT ((float)0.6)
+/* Interval over which the CPU time used by concurrent helpers is held to -Xgc:concurrentBackgroundCPUPercent */
+#define CONCURRENT_HELPER_BUDGET_WINDOW_MILLIS 20
 
 #define TUNING_HEAP_SIZE_FACTOR ((float)0.05)
 #define CONCURRENT_STOP_SAMPLE_GRAIN 0x0F
@@ -165,6 +168,11 @@ private:
 	uintptr_t _lastConHelperTraceSizeCount;
 	float _alloc2ConHelperTraceRate;
 
+	/* Background helper thread CPU budget, -Xgc:concurrentBackgroundMark only */
+	uint64_t _conHelperCPUBudget; /**< CPU time in nanoseconds the helpers may use together per budget window, 0 if not limited */
+	uint64_t _conHelperBudgetWindowStart; /**< Hires clock at the start of the current budget window */
+	uint64_t _conHelperBudgetCPUTime; /**< CPU time in nanoseconds the helpers have used in the current budget window */
+
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
 
 	uintptr_t _languageKickoffReason;
@@ -224,6 +232,7 @@ protected:
 	MM_ConcurrentSafepointCallback *_callback;
 	MM_ConcurrentGCStats _stats;
 	MM_ConcurrentMarkPhaseStats _concurrentPhaseStats;
+	MM_ConcurrentPacer _pacer; /**< Feedback controller of the kickoff threshold and allocation tax, used if -Xgc:concurrentPacer is set */
 
 	/*
 	 * Function members
@@ -245,7 +254,9 @@ private:
 
 	bool initializeConcurrentHelpers(MM_GCExtensionsBase *extensions);
 	void shutdownConHelperThreads(MM_GCExtensionsBase *extensions);
+	uintptr_t taxableFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	bool timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+	void paceConcurrentKickoff(MM_EnvironmentBase *env);
 
 	void reportConcurrentKickoff(MM_EnvironmentBase *env);
 	void reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbortReason reason);
@@ -292,6 +303,20 @@ protected:
 	 */
 	ConHelperRequest getConHelperRequest(MM_EnvironmentBase *env);
 	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned) {};
+
+	/**
+	 * Charge the CPU time a concurrent helper has used since it last called to the CPU budget of the helpers.
+	 * If the helpers are over budget, wait without VM access until the budget window ends.
+	 *
+	 * @param cpuTime[in/out] CPU time of the calling helper at its last call, updated to its current CPU time
+	 * @return the value of _conHelperRequest.
+	 */
+	ConHelperRequest throttleConHelper(MM_EnvironmentBase *env, int64_t *cpuTime);
+
+	/**
+	 * @return true if marking is left to the concurrent helpers, mutators only paying tax when they fall behind
+	 */
+	MMINLINE bool isBackgroundMarking() { return _extensions->concurrentBackgroundMark && (0 < _conHelpersStarted); }
 	void resumeConHelperThreads(MM_EnvironmentBase *env);
 
 	virtual uintptr_t doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeToTrace, MM_MemorySubSpace *subspace, bool tlhAllocation) = 0;
@@ -300,6 +325,13 @@ protected:
 	uintptr_t calculateInitSize(MM_EnvironmentBase *env, uintptr_t allocationSize);
 	uintptr_t calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
+	/**
+	 * Concurrent tracing has got through all work, the final collection will follow.
+	 * Must be called by the thread that switched the execution mode to CONCURRENT_EXHAUSTED.
+	 * @param allocDescription[in] the allocation the thread was paying tax for
+	 */
+	void concurrentTracingExhausted(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+
 	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
 	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
 
@@ -490,6 +522,9 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_conHelperCPUBudget(0)
+		,_conHelperBudgetWindowStart(0)
+		,_conHelperBudgetCPUTime(0)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_initRanges(NULL)
@@ -510,6 +545,7 @@ public:
 		,_callback(NULL)
 		,_stats()
 		,_concurrentPhaseStats()
+		,_pacer(_extensions->concurrentPacerSlack)
 		{
 			_typeId = __FUNCTION__;
 		}
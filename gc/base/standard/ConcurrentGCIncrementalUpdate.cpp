@@ -1050,6 +1050,7 @@ MM_ConcurrentGCIncrementalUpdate::doConcurrentTrace(MM_EnvironmentBase *env, MM_
 				* point before paying allocation tax.
 				*/
 				subspace->setAllocateAtSafePointOnly(env, true);
+				concurrentTracingExhausted(env, allocDescription);
 			}
 		}
 
@@ -1196,8 +1197,11 @@ MM_ConcurrentGCIncrementalUpdate::finalCleanCards(MM_EnvironmentBase *env)
 	uintptr_t totalTraced = 0;
 	uintptr_t totalCleaned = 0;
 	uintptr_t bytesCleaned = 0;
+	MM_ConcurrentCardTable *cardTable = (MM_ConcurrentCardTable *)_cardTable;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
+	env->_cardCleaningStats.clear();
 
 	/* Until no more refs to process */
 	while (moreRefs) {
@@ -1257,12 +1261,15 @@ MM_ConcurrentGCIncrementalUpdate::finalCleanCards(MM_EnvironmentBase *env)
 		/* Process some cards if there are any left */
 		if(moreCards) {
 			/* Clean some more cards and remember if we cleaned last one or not */
-			moreCards = ((MM_ConcurrentCardTable *)_cardTable)->finalCleanCards(env, &bytesCleaned);
+			uint64_t cleanStartTime = omrtime_hires_clock();
+			moreCards = cardTable->finalCleanCards(env, &bytesCleaned);
+			env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, omrtime_hires_clock());
 			/* ..count any objects we traced whilst cleaning the cards */
 			totalCleaned += bytesCleaned;
 		}
 	}
 
+	cardTable->getCardTableStats()->mergeFinalCardCleaningStats(&env->_cardCleaningStats);
 	flushLocalBuffers(env);
 	_stats.incFinalTraceCount(totalTraced);
 	_stats.incFinalCardCleanCount(totalCleaned);
@@ -1365,6 +1372,7 @@ void
 MM_ConcurrentGCIncrementalUpdate::conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned)
 {
 	uintptr_t sizeTraced = 0;
+	int64_t cpuTime = omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread);
 
 	spinLimiter->reset();
 
@@ -1381,7 +1389,7 @@ MM_ConcurrentGCIncrementalUpdate::conHelperDoWorkInternal(MM_EnvironmentBase *en
 				spinLimiter->reset();
 			}
 		}
-		*request = getConHelperRequest(env);
+		*request = throttleConHelper(env, &cpuTime);
 	}
 }
 
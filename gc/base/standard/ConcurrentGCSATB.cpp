@@ -81,6 +81,10 @@ MM_ConcurrentGCSATB::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (NULL != _extensions->sATBBarrierRememberedSet) {
+		_extensions->sATBBarrierRememberedSet->setConcurrentGCStats(&_stats);
+	}
+
 	return true;
 
 error_no_memory:
@@ -455,6 +459,7 @@ MM_ConcurrentGCSATB::doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescr
 		if(_stats.switchExecutionMode(CONCURRENT_TRACE_ONLY, CONCURRENT_EXHAUSTED)) {
 			/* Tell all MSS to use slow path allocate and so get to a safe  point before paying allocation tax. */
 			subspace->setAllocateAtSafePointOnly(env, true);
+			concurrentTracingExhausted(env, allocDescription);
 		}
 	}
 
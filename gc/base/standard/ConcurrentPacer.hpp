@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTPACER_HPP_)
+#define CONCURRENTPACER_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+/* Concurrent cycles the observed allocation to trace rate is averaged over */
+#define CONCURRENT_PACER_HISTORY_SIZE 5
+/* Gains of the controller, applied to the error of a cycle as a fraction of the free space at kickoff */
+#define CONCURRENT_PACER_PROPORTIONAL_GAIN ((float)0.6)
+#define CONCURRENT_PACER_INTEGRAL_GAIN ((float)0.2)
+#define CONCURRENT_PACER_DERIVATIVE_GAIN ((float)0.1)
+/* Bound of the accumulated error, so that a long run of early cycles does not delay reacting to a late one */
+#define CONCURRENT_PACER_INTEGRAL_LIMIT ((float)2.0)
+/* Bounds of the correction applied to the predicted kickoff threshold */
+#define CONCURRENT_PACER_MINIMUM_CORRECTION ((float)0.5)
+#define CONCURRENT_PACER_MAXIMUM_CORRECTION ((float)4.0)
+
+/**
+ * Feedback controller for the concurrent mark kickoff point and allocation tax (-Xgc:concurrentPacer).
+ *
+ * The fixed tuning kicks off concurrent mark when the free space drops to the bytes the trace target needs at
+ * the normal allocation to trace rate, whether or not the mutators achieved that rate in past cycles. The pacer
+ * instead predicts the free space the mark will consume from the rate observed over the last cycles, and corrects
+ * the prediction with a PID controller on the error of every cycle: the free space left when tracing completed,
+ * less the targeted slack, as a fraction of the free space at kickoff. A cycle that did not complete before the
+ * heap was exhausted has a negative error for the part of the trace target it did not get through.
+ *
+ * The correction scales both the kickoff threshold and the reserve of free space the allocation tax aims to
+ * complete the mark within, so a late cycle brings the next kickoff forward and makes mutators trace harder.
+ *
+ * The pacer only does arithmetic, so that verbose GC logs can be replayed through it offline.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentPacer : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct CycleHistory {
+		uintptr_t freeConsumed; /**< Free space allocated while the cycle was tracing */
+		uintptr_t traced; /**< Bytes traced by the cycle */
+	};
+
+	float _slack; /**< Fraction of the free space at kickoff that should be left when tracing completes */
+
+	uintptr_t _freeAtKickoff; /**< Free space when the current cycle was kicked off, 0 if no cycle is active */
+	uintptr_t _freeAtCompletion; /**< Free space when the current cycle completed tracing */
+	uintptr_t _traceTarget; /**< Bytes the current cycle was predicted to trace */
+	bool _completed; /**< True if the current cycle completed tracing */
+
+	CycleHistory _history[CONCURRENT_PACER_HISTORY_SIZE];
+	uintptr_t _historyCount; /**< Valid entries of _history */
+	uintptr_t _currentHistory; /**< Entry of _history the next cycle is recorded in */
+
+	float _error; /**< Error of the last cycle */
+	float _integral; /**< Accumulated error of past cycles */
+	float _correction; /**< Factor the predicted kickoff threshold and the reserve are scaled by */
+	uintptr_t _cycleCount; /**< Cycles the controller was updated for */
+	uintptr_t _lateCycleCount; /**< Cycles that did not complete tracing before the heap was exhausted */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * A concurrent cycle was kicked off.
+	 * @param freeAtKickoff[in] taxable free space at kickoff
+	 * @param traceTarget[in] bytes the cycle is predicted to trace
+	 */
+	MMINLINE void
+	startCycle(uintptr_t freeAtKickoff, uintptr_t traceTarget)
+	{
+		_freeAtKickoff = OMR_MAX(freeAtKickoff, 1);
+		_freeAtCompletion = 0;
+		_traceTarget = traceTarget;
+		_completed = false;
+	}
+
+	/**
+	 * The current cycle has traced all work and is waiting for the final collection.
+	 * @param freeAtCompletion[in] taxable free space when tracing completed
+	 */
+	MMINLINE void
+	completeCycle(uintptr_t freeAtCompletion)
+	{
+		if (0 != _freeAtKickoff) {
+			_freeAtCompletion = OMR_MIN(freeAtCompletion, _freeAtKickoff);
+			_completed = true;
+		}
+	}
+
+	/**
+	 * Forget the current cycle without updating the controller.
+	 */
+	MMINLINE void abandonCycle() { _freeAtKickoff = 0; }
+
+	/**
+	 * A global collection ended the current cycle, or found no cycle active. Updates the controller.
+	 * @param traced[in] bytes the cycle traced concurrently
+	 */
+	MMINLINE void
+	endCycle(uintptr_t traced)
+	{
+		float error = 0.0;
+		if (0 == _freeAtKickoff) {
+			/* the heap was exhausted before the cycle was kicked off at all */
+			error = -1.0;
+			_lateCycleCount += 1;
+		} else {
+			uintptr_t freeConsumed = _freeAtKickoff - _freeAtCompletion;
+			if (_completed) {
+				error = ((float)_freeAtCompletion / (float)_freeAtKickoff) - _slack;
+			} else {
+				float unfinished = 0.0;
+				if (traced < _traceTarget) {
+					unfinished = (float)(_traceTarget - traced) / (float)_traceTarget;
+				}
+				error = OMR_MAX(-1.0f, -(_slack + unfinished));
+				_lateCycleCount += 1;
+			}
+
+			if ((0 != freeConsumed) && (0 != traced)) {
+				_history[_currentHistory].freeConsumed = freeConsumed;
+				_history[_currentHistory].traced = traced;
+				_currentHistory = (_currentHistory + 1) % CONCURRENT_PACER_HISTORY_SIZE;
+				_historyCount = OMR_MIN(_historyCount + 1, CONCURRENT_PACER_HISTORY_SIZE);
+			}
+		}
+
+		float derivative = (0 == _cycleCount) ? 0.0f : (error - _error);
+		_integral = OMR_MIN(OMR_MAX(_integral + error, -CONCURRENT_PACER_INTEGRAL_LIMIT), CONCURRENT_PACER_INTEGRAL_LIMIT);
+		float output = (CONCURRENT_PACER_PROPORTIONAL_GAIN * error) + (CONCURRENT_PACER_INTEGRAL_GAIN * _integral) + (CONCURRENT_PACER_DERIVATIVE_GAIN * derivative);
+
+		/* a positive error left free space unused, kick off later; a negative one ran out, kick off earlier */
+		_correction = OMR_MIN(OMR_MAX(1.0f - output, CONCURRENT_PACER_MINIMUM_CORRECTION), CONCURRENT_PACER_MAXIMUM_CORRECTION);
+		_error = error;
+		_cycleCount += 1;
+		_freeAtKickoff = 0;
+	}
+
+	/**
+	 * @return the bytes traced per byte of free space allocated over the last cycles, 0 if no cycle traced
+	 */
+	MMINLINE float
+	getObservedTraceRate()
+	{
+		uintptr_t freeConsumed = 0;
+		uintptr_t traced = 0;
+		for (uintptr_t i = 0; i < _historyCount; i++) {
+			freeConsumed += _history[i].freeConsumed;
+			traced += _history[i].traced;
+		}
+		return (0 == freeConsumed) ? 0.0f : ((float)traced / (float)freeConsumed);
+	}
+
+	/**
+	 * Calculate the kickoff threshold of the next cycle.
+	 * @param traceTarget[in] bytes the next cycle is predicted to trace
+	 * @param tunedThreshold[in] kickoff threshold of the fixed tuning, including tunedReserve
+	 * @param tunedReserve[in] free space the fixed tuning aims to complete tracing within
+	 * @param maximumTraceRate[in] highest allocation to trace rate mutators are taxed at
+	 * @return the kickoff threshold, including getReserve()
+	 */
+	MMINLINE uintptr_t
+	getKickoffThreshold(uintptr_t traceTarget, uintptr_t tunedThreshold, uintptr_t tunedReserve, float maximumTraceRate)
+	{
+		/* free space the mark is predicted to consume, from the fixed tuning until a cycle has been observed */
+		float predicted = (float)(tunedThreshold - OMR_MIN(tunedReserve, tunedThreshold));
+		float observedRate = getObservedTraceRate();
+		if (observedRate > 0.0f) {
+			predicted = (float)traceTarget / OMR_MIN(observedRate, maximumTraceRate);
+		}
+		return (uintptr_t)(predicted * _correction) + getReserve(tunedReserve);
+	}
+
+	/**
+	 * @param tunedReserve[in] free space the fixed tuning aims to complete tracing within
+	 * @return free space the allocation tax should aim to complete tracing within; larger after late cycles
+	 */
+	MMINLINE uintptr_t getReserve(uintptr_t tunedReserve) { return (uintptr_t)((float)tunedReserve * OMR_MAX(_correction, 1.0f)); }
+
+	MMINLINE bool isCycleActive() { return 0 != _freeAtKickoff; }
+	MMINLINE float getError() { return _error; }
+	MMINLINE float getCorrection() { return _correction; }
+	MMINLINE uintptr_t getCycleCount() { return _cycleCount; }
+	MMINLINE uintptr_t getLateCycleCount() { return _lateCycleCount; }
+
+	/**
+	 * @param slackPercent[in] percentage of the free space at kickoff that should be left when tracing completes
+	 */
+	MM_ConcurrentPacer(uintptr_t slackPercent)
+		: MM_Base()
+		, _slack((float)slackPercent / 100.0f)
+		, _freeAtKickoff(0)
+		, _freeAtCompletion(0)
+		, _traceTarget(0)
+		, _completed(false)
+		, _historyCount(0)
+		, _currentHistory(0)
+		, _error(0.0)
+		, _integral(0.0)
+		, _correction(1.0)
+		, _cycleCount(0)
+		, _lateCycleCount(0)
+	{}
+};
+
+#endif /* CONCURRENTPACER_HPP_ */
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryManager.hpp"
+#include "ModronAssertions.h"
+
+#include "ConcurrentScavengerPageProtection.hpp"
+
+MM_ConcurrentScavengerPageProtection *
+MM_ConcurrentScavengerPageProtection::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentScavengerPageProtection *protection = (MM_ConcurrentScavengerPageProtection *)env->getForge()->allocate(sizeof(MM_ConcurrentScavengerPageProtection), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != protection) {
+		new(protection) MM_ConcurrentScavengerPageProtection(env);
+		if (!protection->initialize(env)) {
+			protection->kill(env);
+			protection = NULL;
+		}
+	}
+	return protection;
+}
+
+void
+MM_ConcurrentScavengerPageProtection::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentScavengerPageProtection::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* the view maps the file the heap was reserved with (see MM_MemoryManager::createVirtualMemoryForHeap), a split heap has two */
+	if (extensions->enableSplitHeap) {
+		return false;
+	}
+
+	/* cover the whole reserved heap, so that the tables do not grow with the heap */
+	MM_Heap *heap = extensions->heap;
+	_heapBase = (uintptr_t)heap->getHeapBase();
+	_heapTop = (uintptr_t)heap->getHeapTop();
+	_pageSize = heap->getPageSize();
+	while (((uintptr_t)1 << _pageShift) < _pageSize) {
+		_pageShift += 1;
+	}
+	Assert_MM_true(((uintptr_t)1 << _pageShift) == _pageSize);
+	_pageCount = (_heapTop - _heapBase + _pageSize - 1) >> _pageShift;
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_ConcurrentScavengerPageProtection::_monitor")) {
+		return false;
+	}
+
+	uintptr_t statesSize = sizeof(uint32_t) * _pageCount;
+	_pageStates = (volatile uint32_t *)env->getForge()->allocate(statesSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_publishedBytes = (volatile uint32_t *)env->getForge()->allocate(statesSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_firstObjects = (volatile uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * _pageCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if ((NULL == _pageStates) || (NULL == _publishedBytes) || (NULL == _firstObjects)) {
+		return false;
+	}
+	memset((void *)_pageStates, 0, statesSize);
+	memset((void *)_publishedBytes, 0, statesSize);
+	memset((void *)_firstObjects, 0, sizeof(uintptr_t) * _pageCount);
+
+	/* NULL unless the heap is backed by a shared file (memfd) */
+	void *heapBase = (void *)_heapBase;
+	MM_MemoryHandle *handle = (MM_MemoryHandle *)((MM_HeapVirtualMemory *)heap)->getVmemHandle();
+	_view = extensions->memoryManager->doubleMapRegions(handle, env, &heapBase, 1, _heapTop - _heapBase, _heapTop - _heapBase, &_viewIdentifier, _pageSize, NULL);
+	if (NULL == _view) {
+		return false;
+	}
+	_viewDelta = (uintptr_t)_view - _heapBase;
+
+	return true;
+}
+
+void
+MM_ConcurrentScavengerPageProtection::tearDown(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (NULL != _view) {
+		omrvmem_release_double_mapped_region(_view, _heapTop - _heapBase, &_viewIdentifier);
+		_view = NULL;
+	}
+	if (NULL != _firstObjects) {
+		env->getForge()->free((void *)_firstObjects);
+		_firstObjects = NULL;
+	}
+	if (NULL != _publishedBytes) {
+		env->getForge()->free((void *)_publishedBytes);
+		_publishedBytes = NULL;
+	}
+	if (NULL != _pageStates) {
+		env->getForge()->free((void *)_pageStates);
+		_pageStates = NULL;
+	}
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+void
+MM_ConcurrentScavengerPageProtection::notifyWaiters()
+{
+	if (0 != _waiters) {
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_ConcurrentScavengerPageProtection::protectChunk(MM_EnvironmentBase *env, void *base, void *top)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Assert_MM_true(0 == ((uintptr_t)base & (_pageSize - 1)));
+	Assert_MM_true(0 == ((uintptr_t)top & (_pageSize - 1)));
+
+	uintptr_t endPage = getPageIndex(top);
+	for (uintptr_t page = getPageIndex(base); page < endPage; page++) {
+		_publishedBytes[page] = 0;
+		_pageStates[page] = page_filling;
+	}
+	/* nothing references the chunk yet, so no mutator can fault on it before the states are set */
+	intptr_t rc = omrmmap_protect(base, (uintptr_t)top - (uintptr_t)base, OMRPORT_PAGE_PROTECT_NONE);
+	Assert_MM_true(0 == rc);
+}
+
+void
+MM_ConcurrentScavengerPageProtection::publish(void *base, void *top)
+{
+	uintptr_t rangeBase = (uintptr_t)base;
+	uintptr_t rangeTop = (uintptr_t)top;
+	bool filledPage = false;
+
+	if (rangeBase < rangeTop) {
+		uintptr_t endPage = getPageIndex((void *)(rangeTop - 1)) + 1;
+		/* the contents of the range must be seen before a page they complete is seen filled */
+		MM_AtomicOperations::writeBarrier();
+		for (uintptr_t page = getPageIndex(base); page < endPage; page++) {
+			if (page_filling == _pageStates[page]) {
+				uintptr_t pageBase = (uintptr_t)getPageBase(page);
+				uintptr_t pageTop = pageBase + _pageSize;
+				if (rangeBase <= pageBase) {
+					_firstObjects[page] = rangeBase;
+				}
+				uintptr_t bytes = OMR_MIN(rangeTop, pageTop) - OMR_MAX(rangeBase, pageBase);
+				if (_pageSize == MM_AtomicOperations::addU32(&_publishedBytes[page], (uint32_t)bytes)) {
+					_pageStates[page] = page_filled;
+					filledPage = true;
+				}
+			}
+		}
+	}
+
+	if (filledPage) {
+		notifyWaiters();
+	}
+}
+
+void
+MM_ConcurrentScavengerPageProtection::finishPage(MM_EnvironmentBase *env, uintptr_t page)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Assert_MM_true(page_scanning == _pageStates[page]);
+
+	intptr_t rc = omrmmap_protect(getPageBase(page), _pageSize, OMRPORT_PAGE_PROTECT_READ | OMRPORT_PAGE_PROTECT_WRITE);
+	Assert_MM_true(0 == rc);
+	MM_AtomicOperations::writeBarrier();
+	_pageStates[page] = page_scanned;
+
+	notifyWaiters();
+}
+
+void
+MM_ConcurrentScavengerPageProtection::waitForPage(uintptr_t page)
+{
+	omrthread_monitor_enter(_monitor);
+	_waiters += 1;
+	uint32_t state = _pageStates[page];
+	if ((page_filling == state) || (page_scanning == state)) {
+		/* timed, since a page may change state between the check and the wait of a notifier */
+		omrthread_monitor_wait_timed(_monitor, 1, 0);
+	}
+	_waiters -= 1;
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_ConcurrentScavengerPageProtection::unprotectAll(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	_active = false;
+
+	/* unprotect runs of protected pages with one call each, scanned pages are already unprotected but joining them makes longer runs */
+	uintptr_t page = 0;
+	while (page < _pageCount) {
+		if (page_unprotected == _pageStates[page]) {
+			page += 1;
+		} else {
+			uintptr_t runBase = page;
+			while ((page < _pageCount) && (page_unprotected != _pageStates[page])) {
+				page += 1;
+			}
+			intptr_t rc = omrmmap_protect(getPageBase(runBase), (page - runBase) << _pageShift, OMRPORT_PAGE_PROTECT_READ | OMRPORT_PAGE_PROTECT_WRITE);
+			Assert_MM_true(0 == rc);
+			for (uintptr_t runPage = runBase; runPage < page; runPage++) {
+				_pageStates[runPage] = page_unprotected;
+				_publishedBytes[runPage] = 0;
+			}
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
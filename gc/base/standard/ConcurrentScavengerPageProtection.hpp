@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSCAVENGERPAGEPROTECTION_HPP_)
+#define CONCURRENTSCAVENGERPAGEPROTECTION_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+
+/**
+ * Page protection of the copy destinations of a Concurrent Scavenger cycle, for runtimes without a read barrier
+ * (-Xgc:concurrentScavengePageProtection).
+ *
+ * Every chunk of survivor or tenure space the Scavenger copies into during a cycle is protected from the mutators
+ * before the first object is copied into it. The Scavenger copies and scans through a second, always writable,
+ * mapping of the heap (the view). A mutator touching a protected page faults, and its fault handler scans the
+ * objects of the page (see MM_Scavenger::handlePageProtectionFault()) so that they only reference copied objects,
+ * before the page is unprotected and the mutator resumes. The remaining pages are unprotected by the final
+ * (stop-the-world) phase of the cycle.
+ *
+ * A page is filling while objects are copied into it, and filled once every byte of it has been published, i.e.
+ * holds a complete object or a hole. Only a filled page can be scanned by a mutator; a mutator faulting on a page
+ * that is filling or being scanned waits until the page is filled or scanned.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentScavengerPageProtection : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	enum PageState {
+		page_unprotected = 0, /**< Not protected in this cycle, or unprotected by the final phase */
+		page_filling, /**< Protected, and objects are still copied into it */
+		page_filled, /**< Protected, and every byte of it has been published */
+		page_scanning, /**< Protected, and a mutator scans its objects */
+		page_scanned /**< Scanned by a mutator and unprotected */
+	};
+
+private:
+	uintptr_t _heapBase; /**< Base of the first page */
+	uintptr_t _heapTop; /**< Top of the last page */
+	void *_view; /**< Base of the writable view of the heap */
+	struct J9PortVmemIdentifier _viewIdentifier; /**< Identifier of the writable view */
+	uintptr_t _viewDelta; /**< Distance from an address in the heap to the same address in the view */
+	uintptr_t _pageSize; /**< Heap page size, the unit of protection */
+	uintptr_t _pageShift; /**< log2 of _pageSize */
+	uintptr_t _pageCount; /**< Entries in the page tables */
+	volatile uint32_t *_pageStates; /**< PageState of every page */
+	volatile uint32_t *_publishedBytes; /**< Bytes of every filling page that have been published */
+	volatile uintptr_t *_firstObjects; /**< Object (or hole) that contains or starts at the base of every protected page */
+	volatile bool _active; /**< Copy destinations are protected */
+	omrthread_monitor_t _monitor; /**< Mutators wait on it for a page to be filled or scanned */
+	volatile uintptr_t _waiters; /**< Mutators waiting on _monitor */
+
+/* Methods */
+private:
+	void notifyWaiters();
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ConcurrentScavengerPageProtection *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the distance from an address in the heap to the same address in the writable view
+	 */
+	MMINLINE uintptr_t getViewDelta() { return _viewDelta; }
+
+	MMINLINE uintptr_t getPageSize() { return _pageSize; }
+
+	/**
+	 * @return true if copy destinations are protected from the mutators
+	 */
+	MMINLINE bool isActive() { return _active; }
+
+	/**
+	 * Start protecting copy destinations. Must be called while the mutators are stopped, before anything is copied.
+	 */
+	MMINLINE void activate() { _active = true; }
+
+	/**
+	 * @param address[in] an address in the heap
+	 * @return true if the page of the address has been protected in this cycle (and not unprotected by the final phase)
+	 */
+	MMINLINE bool
+	isProtected(void *address)
+	{
+		return page_unprotected != _pageStates[getPageIndex(address)];
+	}
+
+	MMINLINE bool isInHeap(void *address) { return (_heapBase <= (uintptr_t)address) && ((uintptr_t)address < _heapTop); }
+	MMINLINE uintptr_t getPageIndex(void *address) { return ((uintptr_t)address - _heapBase) >> _pageShift; }
+	MMINLINE void *getPageBase(uintptr_t page) { return (void *)(_heapBase + (page << _pageShift)); }
+	MMINLINE uint32_t getPageState(uintptr_t page) { return _pageStates[page]; }
+
+	/**
+	 * @param page[in] index of a page that is filled, scanning or scanned
+	 * @return the object (or hole) that contains or starts at the base of the page
+	 */
+	MMINLINE omrobjectptr_t getFirstObject(uintptr_t page) { return (omrobjectptr_t)_firstObjects[page]; }
+
+	/**
+	 * Claim a filled page for scanning.
+	 * @param page[in] index of a page
+	 * @return true if the calling thread is to scan the page, false if the page is not filled
+	 */
+	MMINLINE bool
+	claimPage(uintptr_t page)
+	{
+		return page_filled == MM_AtomicOperations::lockCompareExchangeU32(&_pageStates[page], page_filled, page_scanning);
+	}
+
+	/**
+	 * Protect a chunk the Scavenger is about to copy into.
+	 * @param base[in] page aligned base of the chunk
+	 * @param top[in] page aligned top of the chunk
+	 */
+	void protectChunk(MM_EnvironmentBase *env, void *base, void *top);
+
+	/**
+	 * Publish a range of a protected chunk that now holds complete objects or holes, and mark the pages it completes filled.
+	 * May be called by several threads concurrently, for disjoint ranges.
+	 * @param base[in] the first object (or hole) of the range
+	 * @param top[in] the top of the range
+	 */
+	void publish(void *base, void *top);
+
+	/**
+	 * Unprotect a page the calling thread has scanned, and wake up the mutators waiting for it.
+	 * @param page[in] index of a page claimed by the calling thread
+	 */
+	void finishPage(MM_EnvironmentBase *env, uintptr_t page);
+
+	/**
+	 * Wait (briefly) for a page that is filling or being scanned to change state.
+	 * @param page[in] index of a page
+	 */
+	void waitForPage(uintptr_t page);
+
+	/**
+	 * Stop protecting copy destinations and unprotect every page protected in this cycle. Must be called while
+	 * the mutators are stopped.
+	 */
+	void unprotectAll(MM_EnvironmentBase *env);
+
+	MM_ConcurrentScavengerPageProtection(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _heapBase(0)
+		, _heapTop(0)
+		, _view(NULL)
+		, _viewDelta(0)
+		, _pageSize(0)
+		, _pageShift(0)
+		, _pageCount(0)
+		, _pageStates(NULL)
+		, _publishedBytes(NULL)
+		, _firstObjects(NULL)
+		, _active(false)
+		, _monitor(NULL)
+		, _waiters(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#endif /* CONCURRENTSCAVENGERPAGEPROTECTION_HPP_ */
@@ -88,6 +88,21 @@ MM_ConfigurationGenerational::initialize(MM_EnvironmentBase* env)
 		extensions->dnssExpectedRatioMinimum._valueSpecified = 0.01;
 	}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (extensions->concurrentScavengerPageProtection) {
+		/* concurrent mark helpers would trace into protected copy destinations outside of the fault handler */
+		extensions->concurrentMark = false;
+		/* copies are scanned through the writable heap view, which the hierarchical slot by slot scan does not use */
+		if ((MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering)
+			|| (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL == extensions->scavengerScanOrdering)
+		) {
+			extensions->scavengerScanOrdering = extensions->learnHotFields
+				? MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST
+				: MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+		}
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 	return MM_ConfigurationStandard::initialize(env);
 }
 
@@ -162,6 +162,11 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+	if (extensions->lazySweep) {
+		/* a lazy sweep resumes connecting a single address ordered free list where it left it */
+		doSplit = false;
+	}
+
 	if ((UDATA_MAX == extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold) && extensions->processLargeAllocateStats) {
 		extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold = OMR_MAX(10*1024*1024, extensions->memoryMax/100);
 	}
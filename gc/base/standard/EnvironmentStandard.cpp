@@ -60,7 +60,8 @@ MM_EnvironmentStandard::initialize(MM_GCExtensionsBase *extensions)
 #endif
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	if (extensions->concurrentScavenger) {
+	/* threads attached while the collectors are being created (concurrent mark helpers) precede the scavenger */
+	if (extensions->concurrentScavenger && (NULL != extensions->scavenger)) {
 		extensions->scavenger->mutatorSetupForGC(this);
 	}
 #endif
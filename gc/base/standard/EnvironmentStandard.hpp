@@ -35,6 +35,9 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HotFieldProfiler.hpp"
+#include "PretenureProfiler.hpp"
+#include "RememberedSetSummary.hpp"
 #include "SublistFragment.hpp"
 
 class MM_CopyScanCacheStandard;
@@ -60,6 +63,9 @@ public:
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	MM_HotFieldSampleBuffer _hotFieldSamples; /**< slots sampled by this thread that are not yet added to the hot field profiles */
+	MM_RememberedSetSummaryFilter _rememberedSetSummaryFilter; /**< chunks of the remembered set summary this thread has published to */
+	MM_PretenureTenureSampleBuffer _pretenureSamples; /**< allocation sites of objects tenured by this thread that are not yet added to the site profiles */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -100,6 +106,13 @@ public:
 		,_survivorTLHRemainderTop(NULL)
 	{
 		_typeId = __FUNCTION__;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		_hotFieldSamples.count = 0;
+		_hotFieldSamples.countdown = 0;
+		_rememberedSetSummaryFilter.epoch = 0;
+		_pretenureSamples.count = 0;
+		_pretenureSamples.countdown = 0;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	}
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
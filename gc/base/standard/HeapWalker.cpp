@@ -31,6 +31,7 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectIterator.hpp"
 #include "ObjectModel.hpp"
@@ -233,3 +234,55 @@ MM_HeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc fun
 		}
 	}
 }
+
+bool
+MM_HeapWalker::isRegionEmpty(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region)
+{
+	if (!region->containsObjects() || (0 == region->getSize())) {
+		return true;
+	}
+
+	bool empty = false;
+	switch (region->getRegionType()) {
+	case MM_HeapRegionDescriptor::ADDRESS_ORDERED:
+	case MM_HeapRegionDescriptor::ADDRESS_ORDERED_MARKED:
+	case MM_HeapRegionDescriptor::BUMP_ALLOCATED:
+	case MM_HeapRegionDescriptor::BUMP_ALLOCATED_MARKED:
+	{
+		/* a region that starts with a hole spanning all of it holds no objects */
+		GC_ObjectModel *objectModel = &env->getExtensions()->objectModel;
+		omrobjectptr_t first = (omrobjectptr_t)region->getLowAddress();
+		empty = objectModel->isDeadObject(first) && (objectModel->getSizeInBytesDeadObject(first) >= region->getSize());
+		break;
+	}
+	default:
+		break;
+	}
+	return empty;
+}
+
+/**
+ * Walk all objects in the heap in batches, in a single threaded linear fashion.
+ */
+void
+MM_HeapWalker::allObjectBatchesDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags, bool parallel, bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if ((typeFlags == (region->getTypeFlags() & typeFlags)) && !isRegionEmpty(env, region)) {
+			GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, region);
+			omrobjectptr_t *batch = NULL;
+			uintptr_t count = 0;
+			while (0 != (count = objectHeapIterator.nextObjectBatch(&batch))) {
+				function(omrVMThread, region, batch, count, userData);
+			}
+		}
+	}
+}
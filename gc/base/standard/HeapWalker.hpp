@@ -38,6 +38,10 @@ class MM_MemorySubSpace;
 
 typedef void (*MM_HeapWalkerObjectFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t, void *);
 typedef void (*MM_HeapWalkerSlotFunc)(OMR_VM *, omrobjectptr_t *, void *, uint32_t);
+/**
+ * Applied to a batch of objects of one region, in address order. The batch is only valid during the call.
+ */
+typedef void (*MM_HeapWalkerObjectBatchFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t *, uintptr_t, void *);
 
 class MM_HeapWalker : public MM_BaseVirtual
 {
@@ -48,10 +52,21 @@ protected:
 	void rememberedObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlotFunc function, void *userData, uintptr_t walkFlags, bool parallel);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	bool initialize(MM_EnvironmentBase *env);
+	/**
+	 * @return true if the region holds no object to walk, without walking it
+	 */
+	bool isRegionEmpty(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region);
 
 public:
 	virtual void allObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlotFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
+	/**
+	 * Walk all objects of the heap, handing them to the function in batches of up to a few hundred objects of
+	 * one region rather than one at a time. Regions that are free, or entirely covered by a free entry, are skipped.
+	 * @param typeFlags[in] MEMORY_TYPE_* flags a region must have to be walked, 0 to walk all regions
+	 * @param parallel[in] true to walk the heap on the GC threads, which may call the function concurrently
+	 */
+	virtual void allObjectBatchesDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t typeFlags, bool parallel, bool prepareHeapForWalk);
 
 	static MM_HeapWalker *newInstance(MM_EnvironmentBase *env); 	
 	virtual void kill(MM_EnvironmentBase *env);
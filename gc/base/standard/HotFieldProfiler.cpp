@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "Forge.hpp"
+#include "HotFieldProfiler.hpp"
+
+MM_HotFieldProfiler *
+MM_HotFieldProfiler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HotFieldProfiler *profiler = (MM_HotFieldProfiler *)env->getForge()->allocate(sizeof(MM_HotFieldProfiler), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != profiler) {
+		new(profiler) MM_HotFieldProfiler(env);
+		if (!profiler->initialize(env)) {
+			profiler->kill(env);
+			profiler = NULL;
+		}
+	}
+	return profiler;
+}
+
+void
+MM_HotFieldProfiler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HotFieldProfiler::initialize(MM_EnvironmentBase *env)
+{
+	return _profiles.initialize(env, "MM_HotFieldProfiler::mutex", _extensions->hotFieldSampleRate);
+}
+
+void
+MM_HotFieldProfiler::tearDown(MM_EnvironmentBase *env)
+{
+	_profiles.tearDown(env);
+}
+
+bool
+MM_HotFieldProfiler::recordSample(MM_EnvironmentBase *env, MM_HotFieldSample *sample)
+{
+	ClassProfile *profile = _profiles.findOrInsert(env, sample->classKey);
+	if (NULL == profile) {
+		return false;
+	}
+	spaceSavingUpdate(profile->slotCounts, (void *)(sample->slotIndex + 1), 1);
+	profile->samples += 1;
+	return true;
+}
+
+bool
+MM_HotFieldProfiler::deriveHotFields(ClassProfile *profile)
+{
+	uint8_t hotFields[MAXIMUM_LEARNED_HOT_FIELD_COUNT];
+	uintptr_t hotFieldCount = 0;
+
+	if (HOT_FIELD_PROFILE_MINIMUM_SAMPLES <= profile->samples) {
+		uintptr_t rankedSlots = spaceSavingGetCurSize(profile->slotCounts);
+		uintptr_t maximumHotFields = OMR_MIN(_extensions->learnedHotFieldCount, rankedSlots);
+		/* ranks are 1-based, hottest first */
+		for (uintptr_t rank = 1; (rank <= rankedSlots) && (hotFieldCount < maximumHotFields); rank++) {
+			uintptr_t count = spaceSavingGetKthMostFreqCount(profile->slotCounts, rank);
+			if ((count * 100) < (profile->samples * HOT_FIELD_PROFILE_MINIMUM_SHARE)) {
+				break;
+			}
+			uintptr_t slotIndex = (uintptr_t)spaceSavingGetKthMostFreq(profile->slotCounts, rank) - 1;
+			/* hot fields are given to copyHotField() as 8 bit offsets, and U_8_MAX means none */
+			if (slotIndex < U_8_MAX) {
+				hotFields[hotFieldCount] = (uint8_t)slotIndex;
+				hotFieldCount += 1;
+			}
+		}
+	} else {
+		/* too few samples to change our mind */
+		return false;
+	}
+
+	bool changed = (hotFieldCount != profile->hotFieldCount);
+	for (uintptr_t i = 0; i < hotFieldCount; i++) {
+		changed = changed || (hotFields[i] != profile->hotFields[i]);
+		profile->hotFields[i] = hotFields[i];
+	}
+	profile->hotFieldCount = hotFieldCount;
+	return changed;
+}
+
+void
+MM_HotFieldProfiler::publish(MM_EnvironmentBase *env)
+{
+	_learnedClassCount = 0;
+	_updatedClassCount = 0;
+
+	for (uintptr_t i = 0; i < PROFILE_TABLE_SIZE; i++) {
+		ClassProfile *profile = _profiles.getEntry(i);
+		if (NULL != profile->key) {
+			if (deriveHotFields(profile)) {
+				if (_updatedClassCount < HOT_FIELD_PROFILE_REPORT_SIZE) {
+					_updatedClasses[_updatedClassCount] = profile;
+				}
+				_updatedClassCount += 1;
+			}
+			if (0 != profile->hotFieldCount) {
+				_learnedClassCount += 1;
+			}
+		}
+	}
+}
+
+void
+MM_HotFieldProfiler::resetSamples(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < PROFILE_TABLE_SIZE; i++) {
+		ClassProfile *profile = _profiles.getEntry(i);
+		if (NULL != profile->key) {
+			spaceSavingClear(profile->slotCounts);
+			profile->samples = 0;
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(HOTFIELDPROFILER_HPP_)
+#define HOTFIELDPROFILER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "spacesaving.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SampledProfileTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* Samples of a class needed before its hot fields are derived. */
+#define HOT_FIELD_PROFILE_MINIMUM_SAMPLES 32
+/* Percentage of the samples of a class a field must account for to be hot. */
+#define HOT_FIELD_PROFILE_MINIMUM_SHARE 10
+/* Classes whose hot fields changed that are kept for reporting after every scavenge. */
+#define HOT_FIELD_PROFILE_REPORT_SIZE 8
+
+/**
+ * A slot sampled by the Scavenger.
+ * @ingroup GC_Modron_Standard
+ */
+struct MM_HotFieldSample {
+	void *classKey; /**< Layout key of the object the slot belongs to */
+	uintptr_t slotIndex; /**< Index of the slot from the start of the object, in slots */
+};
+
+/**
+ * Thread local buffer of sampled slots, flushed to the MM_HotFieldProfiler when full and at the end of the scavenge.
+ */
+typedef MM_ProfileSampleBuffer<MM_HotFieldSample> MM_HotFieldSampleBuffer;
+
+/**
+ * Learns the hot fields of classes (objects sharing a layout key, see GC_ObjectModel::getHotFieldProfileKey())
+ * from the slots the Scavenger scans.
+ *
+ * A sampled slot is one whose referent was in evacuate space, so the fields that most often lead to surviving
+ * young objects are the ones depth copied after their parent, putting parent and child on the same cache line.
+ * Slot counts are kept per class in a space saving top-k structure and hot fields are derived from them at
+ * the end of every scavenge, by the main thread, while no other thread reads them.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HotFieldProfiler : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	/**
+	 * The profile of one class, keyed by its layout key.
+	 */
+	struct ClassProfile : public MM_SampledProfile {
+		OMRSpaceSaving *slotCounts; /**< Sampled slot indexes (plus one, so that no key is NULL) ranked by frequency */
+		uintptr_t samples; /**< Samples taken for this class since the profile was last reset */
+		uintptr_t hotFieldCount; /**< Number of valid entries in hotFields */
+		uint8_t hotFields[MAXIMUM_LEARNED_HOT_FIELD_COUNT]; /**< Learned hot field slot indexes, hottest first */
+
+		bool
+		initialize(MM_EnvironmentBase *env)
+		{
+			slotCounts = spaceSavingNew(env->getPortLibrary(), 2 * MAXIMUM_LEARNED_HOT_FIELD_COUNT);
+			samples = 0;
+			hotFieldCount = 0;
+			return NULL != slotCounts;
+		}
+
+		void
+		tearDown(MM_EnvironmentBase *env)
+		{
+			spaceSavingFree(slotCounts);
+		}
+	};
+
+private:
+	MM_GCExtensionsBase *_extensions;
+	MM_SampledProfileTable<ClassProfile> _profiles; /**< Profiles of the sampled classes */
+	uintptr_t _learnedClassCount; /**< Classes with at least one learned hot field, as of the last publish */
+	uintptr_t _updatedClassCount; /**< Classes whose hot fields changed at the last publish */
+	ClassProfile *_updatedClasses[HOT_FIELD_PROFILE_REPORT_SIZE]; /**< The first of the classes whose hot fields changed at the last publish */
+
+/* Methods */
+private:
+	bool deriveHotFields(ClassProfile *profile);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_HotFieldProfiler *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide whether the next object scanned by the thread owning the buffer should be sampled.
+	 * @param buffer[in] the sample buffer of the scanning thread
+	 * @return true once every hotFieldSampleRate calls
+	 */
+	MMINLINE bool shouldSample(MM_HotFieldSampleBuffer *buffer) { return _profiles.shouldSample(buffer); }
+
+	/**
+	 * Record that a slot of an object of the given class referred to an object in evacuate space.
+	 * @param env[in] the scanning thread
+	 * @param buffer[in] the sample buffer of the scanning thread
+	 * @param classKey[in] the layout key of the object holding the slot
+	 * @param slotIndex[in] the index of the slot from the start of the object, in slots
+	 */
+	MMINLINE void
+	addSample(MM_EnvironmentBase *env, MM_HotFieldSampleBuffer *buffer, void *classKey, uintptr_t slotIndex)
+	{
+		MM_HotFieldSample sample = { classKey, slotIndex };
+		_profiles.addSample(env, buffer, sample, this);
+	}
+
+	/**
+	 * Add the samples in the buffer to the class profiles and empty the buffer. May be called by several threads concurrently.
+	 */
+	MMINLINE void flushSamples(MM_EnvironmentBase *env, MM_HotFieldSampleBuffer *buffer) { _profiles.flushSamples(env, buffer, this); }
+
+	/**
+	 * Count a sample in the profile of its class, see MM_SampledProfileTable::flushSamples().
+	 * @return false if the class has no profile and none could be inserted
+	 */
+	bool recordSample(MM_EnvironmentBase *env, MM_HotFieldSample *sample);
+
+	/**
+	 * Derive the hot fields of every class from its samples, once all threads have flushed their samples.
+	 * Must be called by the main thread while no other thread calls getHotFields().
+	 */
+	void publish(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the samples taken so far, so that hot fields follow changes in the behaviour of the application.
+	 * Learned hot fields are kept until they are relearned. Must be called while no thread is sampling.
+	 */
+	void resetSamples(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the learned hot fields of a class. May be called concurrently with flushSamples(), but not with publish().
+	 * @param classKey[in] the layout key of the class
+	 * @param hotFields[out] set to the slot indexes of the hot fields, hottest first
+	 * @return the number of hot fields, 0 if none have been learned for the class
+	 */
+	MMINLINE uintptr_t
+	getHotFields(void *classKey, const uint8_t **hotFields)
+	{
+		if (NULL != classKey) {
+			ClassProfile *profile = _profiles.find(classKey);
+			if (NULL != profile) {
+				*hotFields = profile->hotFields;
+				return profile->hotFieldCount;
+			}
+		}
+		return 0;
+	}
+
+	MMINLINE uintptr_t getClassCount() { return _profiles.getProfileCount(); }
+	MMINLINE uintptr_t getLearnedClassCount() { return _learnedClassCount; }
+	MMINLINE uintptr_t getDroppedSampleCount() { return _profiles.getDroppedSampleCount(); }
+
+	/**
+	 * @return the number of classes whose hot fields changed at the last publish
+	 */
+	MMINLINE uintptr_t getUpdatedClassCount() { return _updatedClassCount; }
+
+	/**
+	 * @param index[in] less than both getUpdatedClassCount() and HOT_FIELD_PROFILE_REPORT_SIZE
+	 * @return a class whose hot fields changed at the last publish
+	 */
+	MMINLINE ClassProfile *getUpdatedClass(uintptr_t index) { return _updatedClasses[index]; }
+
+	MM_HotFieldProfiler(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _extensions(env->getExtensions())
+		, _profiles()
+		, _learnedClassCount(0)
+		, _updatedClassCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* HOTFIELDPROFILER_HPP_ */
@@ -441,6 +441,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 	/* Reset memory pools of associated memory spaces */
 	_extensions->heap->resetSpacesForGarbageCollect(env);
+	_sweepScheme->abandonLazySweep(env);
 	
 	/* Clear the gc stats structure */
 	_extensions->globalGCStats.clear();
@@ -720,7 +721,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -919,10 +920,10 @@ MM_ParallelGlobalGC::completeFreelistRebuildRequired(MM_EnvironmentBase *env, Sw
 		*reason = COMPACTION_REQUIRED;
 	} else 
 #endif 	/* OMR_GC_MODRON_COMPACTION */
-	if (activeSubSpace->getActiveLOAMemorySize(MEMORY_TYPE_OLD) > 0  && 0 != activeSubSpace->getExpansionSize()) {
+	if ((activeSubSpace->getActiveLOAMemorySize(MEMORY_TYPE_OLD) > 0 || !_sweepScheme->isSweepCompleted(env)) && 0 != activeSubSpace->getExpansionSize()) {
 		//todo remove once we sort out how to reallocate sweep chunks if heap expands
 		// after a concurrent sweep cycle has started but for now we need to complete sweep
-		// if current LOA size is > 0.
+		// if current LOA size is > 0, or if chunks were left to a lazy sweep.
 		*reason = EXPANSION_REQUIRED;
 	} else if (0 != activeSubSpace->getContractionSize()) {
 		*reason = CONTRACTION_REQUIRED;
@@ -950,12 +951,20 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 	}
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	_compactScheme->prepareCardTableForMark(env, initMarkMap);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
 	_dispatcher->run(env, &markTask);
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	_compactScheme->finishCardTableAfterMark(env);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
 	/* Do any post mark checks */
 	postMark(env);
 	_markingScheme->mainCleanupAfterGC(env);
@@ -1353,6 +1362,17 @@ MM_ParallelGlobalGC::heapReconfigured(MM_EnvironmentBase *env, HeapReconfigReaso
 	_sweepScheme->heapReconfigured(env);
 }
 
+/**
+ * Replenish a pools free lists to satisfy a given allocate, from the chunks a lazy sweep has left.
+ * @note This call is made under the pools allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ParallelGlobalGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
 bool
 MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
 #include "Bits.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -47,6 +48,7 @@
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
+#include "HeapMapScanner.hpp"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
@@ -104,6 +106,15 @@ MM_ParallelSweepTask::cleanup(MM_EnvironmentBase *env)
 		(uint32_t)omrtime_hires_delta(0, env->_sweepStats.mergeTime, OMRPORT_TIME_DELTA_IN_MILLISECONDS));
 }
 
+/**
+ * Run the lazy sweep completion task.
+ */
+void
+MM_ParallelLazySweepCompletionTask::run(MM_EnvironmentBase *env)
+{
+	_sweepScheme->internalCompleteLazySweep(env);
+}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 /**
  * Stats gathering for synchronizing threads during sweep.
@@ -277,6 +288,11 @@ bool
 MM_ParallelSweepScheme::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
 	/* this method is called too often in some configurations (ie: Tarok) so we update the sectioning table in heapReconfigured */
+
+	/* The range is about to be added to the free list of its pool, which a lazy sweep could not connect chunks in front of */
+	if ((0 != _lazySweepPoolCount) && (MEMORY_TYPE_OLD == (subspace->getTypeFlags() & MEMORY_TYPE_OLD))) {
+		completeLazySweep(env);
+	}
 	return true;
 }
 
@@ -294,6 +310,11 @@ bool
 MM_ParallelSweepScheme::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
 	/* this method is called too often in some configurations (ie: Tarok) so we update the sectioning table in heapReconfigured */
+
+	/* Chunks a lazy sweep has left may cover the range */
+	if ((0 != _lazySweepPoolCount) && (MEMORY_TYPE_OLD == (subspace->getTypeFlags() & MEMORY_TYPE_OLD))) {
+		completeLazySweep(env);
+	}
 	return true;
 }
 
@@ -341,14 +362,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapScanner::findNonEmptyWord(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -598,9 +612,10 @@ MM_ParallelSweepScheme::prepareAllChunks(MM_EnvironmentBase *env)
  * Sweep all chunks.
  * 
  * @param totalChunkCount total number of chunks to be swept
+ * @param lazyChunks true to sweep only the chunks a lazy sweep has left, false to sweep only the others
  */
 void
-MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
+MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount, bool lazyChunks)
 {
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t chunksProcessed = 0; /* Chunks processed by this thread */
@@ -616,7 +631,8 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
 			
 		Assert_MM_true (chunk != NULL);  /* Should never return NULL */
 		
-		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		/* every thread skips the same chunks, so only the chunks to sweep are handed out as work units */
+		if((lazyChunks == isLazySweepChunk(chunk)) && J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)                           
 			chunksProcessed += 1;
@@ -684,11 +700,25 @@ MM_ParallelSweepScheme::connectAllChunks(MM_EnvironmentBase *env, uintptr_t tota
 		sweepChunk = sectioningIterator.nextChunk();
 		Assert_MM_true(sweepChunk != NULL);  /* Should never return NULL */
 
-		connectChunk(env, sweepChunk);
+		if (!isLazySweepChunk(sweepChunk)) {
+			connectChunk(env, sweepChunk);
+		}
 	}
 
 	/* Walk all memory spaces flushing the previous free entry */
 	flushAllFinalChunks(env);
+
+	if (0 != _lazySweepPoolCount) {
+		MM_MemoryPool *memoryPool = NULL;
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+		while (NULL != (memoryPool = poolIterator.nextPool())) {
+			MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+			if (NULL != sweepState->_lazySweepChunk) {
+				sweepState->_lazySweepFreeListTail = sweepState->_connectPreviousFreeEntry;
+			}
+		}
+	}
 }
 
 /**
@@ -767,12 +797,13 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 		_extensions->heap->resetLargestFreeEntry();
 		
 		_chunksPrepared = prepareAllChunks(env);
+		prepareLazySweep(env, _chunksPrepared);
 		
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
 	/* ..all threads now join in to do actual sweep */
-	sweepAllChunks(env, _chunksPrepared);
+	sweepAllChunks(env, _chunksPrepared, false);
 	
 	/* ..and then main thread finishes off by connecting all the chunks */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
@@ -797,6 +828,209 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 	}
 }
 
+/**
+ * Only the address ordered free list of tenure pools can be left partially connected until allocations need more
+ * of it, and only as long as the mark map of the collection is kept until the next one.
+ */
+bool
+MM_ParallelSweepScheme::isLazySweepEligible(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool)
+{
+	bool eligible = _extensions->lazySweep;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	eligible = eligible && !_extensions->concurrentMark;
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	eligible = eligible && !_extensions->concurrentSweep;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+	return eligible
+		&& (MEMORY_TYPE_OLD == (memoryPool->getSubSpace()->getTypeFlags() & MEMORY_TYPE_OLD))
+		&& (memoryPool->getSweepPoolManager() == (MM_SweepPoolManager *)_extensions->sweepPoolManagerAddressOrderedList);
+}
+
+MMINLINE bool
+MM_ParallelSweepScheme::isLazySweepChunk(MM_ParallelSweepChunk *chunk)
+{
+	MM_ParallelSweepChunk *lazySweepChunk = getPoolState(chunk->memoryPool)->_lazySweepChunk;
+	return (NULL != lazySweepChunk) && (chunk->chunkBase >= lazySweepChunk->chunkBase);
+}
+
+void
+MM_ParallelSweepScheme::abandonLazySweep(MM_EnvironmentBase *env)
+{
+	if (0 != _lazySweepPoolCount) {
+		MM_MemoryPool *memoryPool = NULL;
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+		while (NULL != (memoryPool = poolIterator.nextPool())) {
+			MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+			sweepState->_lazySweepChunk = NULL;
+			sweepState->_lazySweepBytes = 0;
+			sweepState->_lazySweepFreeListTail = NULL;
+		}
+		_lazySweepPoolCount = 0;
+	}
+}
+
+void
+MM_ParallelSweepScheme::prepareLazySweep(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
+{
+	abandonLazySweep(env);
+
+	if (_extensions->lazySweep) {
+		MM_MemoryPool *memoryPool = NULL;
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+		MM_MemoryPool *previousMemoryPool = NULL;
+		bool eligible = false;
+		MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+
+		for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
+			MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+			Assert_MM_true(NULL != chunk);  /* Should never return NULL */
+
+			if (chunk->memoryPool != previousMemoryPool) {
+				previousMemoryPool = chunk->memoryPool;
+				eligible = isLazySweepEligible(env, previousMemoryPool);
+			}
+			if (eligible) {
+				MM_SweepPoolState *sweepState = getPoolState(chunk->memoryPool);
+				if (NULL == sweepState->_lazySweepChunk) {
+					sweepState->_lazySweepChunk = chunk;
+					_lazySweepPoolCount += 1;
+				}
+				sweepState->_lazySweepBytes += chunk->size();
+			}
+		}
+
+		/* The mark found every live byte, the chunks left are expected to be as free as the heap as a whole */
+		uintptr_t liveBytes = _extensions->globalGCStats.markStats._bytesScanned;
+		uintptr_t heapBytes = _extensions->heap->getActiveMemorySize();
+		_lazySweepFreeRatio = (liveBytes < heapBytes) ? (1.0 - ((double)liveBytes / (double)heapBytes)) : 0.0;
+
+		while (NULL != (memoryPool = poolIterator.nextPool())) {
+			MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+			if (NULL != sweepState->_lazySweepChunk) {
+				updateLazySweepApproximateFree(memoryPool, sweepState);
+			}
+		}
+	}
+}
+
+void
+MM_ParallelSweepScheme::updateLazySweepApproximateFree(MM_MemoryPool *memoryPool, MM_SweepPoolState *sweepState)
+{
+	uintptr_t approximateFree = (uintptr_t)(_lazySweepFreeRatio * sweepState->_lazySweepBytes);
+	approximateFree = MM_Math::roundToCeiling(sizeof(uintptr_t), approximateFree);
+	if (approximateFree > sweepState->_lazySweepBytes) {
+		approximateFree = sweepState->_lazySweepBytes;
+	}
+	memoryPool->setApproximateFreeMemorySize(approximateFree);
+}
+
+bool
+MM_ParallelSweepScheme::lazySweepPool(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t minimumFreeSize, bool chunksSwept)
+{
+	MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+	MM_ParallelSweepChunk *chunk = sweepState->_lazySweepChunk;
+	if (NULL == chunk) {
+		return false;
+	}
+
+	/* Entries connected by the previous lazy sweep of the pool may have been allocated since: resume after the current
+	 * tail of the free list, which allocations have kept current.  The trailing free candidate of the last chunk
+	 * connected has not been connected yet.
+	 */
+	MM_HeapLinkedFreeHeader *freeListTail = sweepState->_lazySweepFreeListTail;
+	Assert_MM_true((NULL == freeListTail) == (NULL == memoryPool->getFirstFreeStartingAddr(env)));
+	Assert_MM_true((NULL == freeListTail) || (((void *)freeListTail < chunk->chunkBase) && (NULL == memoryPool->getNextFreeStartingAddr(env, freeListTail))));
+
+	uintptr_t freeBytes = memoryPool->getActualFreeMemorySize();
+	uintptr_t freeEntryCount = memoryPool->getActualFreeEntryCount();
+	uintptr_t largestFreeEntry = memoryPool->getLargestFreeEntry();
+
+	sweepState->_connectPreviousFreeEntry = freeListTail;
+	sweepState->_connectPreviousFreeEntrySize = (NULL == freeListTail) ? 0 : freeListTail->getSize();
+	sweepState->_connectPreviousPreviousFreeEntry = NULL;
+	sweepState->resetFreeStats();
+
+	if (!chunksSwept) {
+		MM_MemoryPool *topLevelMemoryPool = memoryPool->getParent();
+		if (NULL == topLevelMemoryPool) {
+			topLevelMemoryPool = memoryPool;
+		}
+		env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
+	}
+
+	/* Objects never span memory pools, so chunks of other pools project nothing into this one whether they are swept or not */
+	while ((NULL != chunk) && (sweepState->_largestFreeEntry < minimumFreeSize)) {
+		if (chunk->memoryPool == memoryPool) {
+			if (!chunksSwept) {
+				sweepChunk(env, chunk);
+			}
+			connectChunk(env, chunk);
+			sweepState->_lazySweepBytes -= chunk->size();
+		}
+		chunk = chunk->_next;
+	}
+	while ((NULL != chunk) && (chunk->memoryPool != memoryPool)) {
+		chunk = chunk->_next;
+	}
+	sweepState->_lazySweepChunk = chunk;
+
+	if (!chunksSwept) {
+		memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+
+	if (NULL == chunk) {
+		Assert_MM_true(0 == sweepState->_lazySweepBytes);
+		flushFinalChunk(env, memoryPool);
+		MM_AtomicOperations::subtract(&_lazySweepPoolCount, 1);
+	}
+
+	/* Terminates the free list, and replaces the pool statistics with those of the entries just connected */
+	memoryPool->getSweepPoolManager()->connectFinalChunk(env, memoryPool);
+	sweepState->_lazySweepFreeListTail = sweepState->_connectPreviousFreeEntry;
+	memoryPool->updateMemoryPoolStatistics(env,
+		freeBytes + sweepState->_sweepFreeBytes,
+		freeEntryCount + sweepState->_sweepFreeHoles,
+		OMR_MAX(largestFreeEntry, sweepState->_largestFreeEntry));
+	updateLazySweepApproximateFree(memoryPool, sweepState);
+
+	return sweepState->_largestFreeEntry >= minimumFreeSize;
+}
+
+void
+MM_ParallelSweepScheme::internalCompleteLazySweep(MM_EnvironmentBase *env)
+{
+	sweepAllChunks(env, _chunksPrepared, true);
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		MM_MemoryPool *memoryPool = NULL;
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+		while (NULL != (memoryPool = poolIterator.nextPool())) {
+			lazySweepPool(env, memoryPool, UDATA_MAX, true);
+		}
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_ParallelSweepScheme::completeLazySweep(MM_EnvironmentBase *env)
+{
+	MM_MemoryPool *memoryPool = NULL;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		if (NULL != getPoolState(memoryPool)->_lazySweepChunk) {
+			memoryPool->lock(env);
+			lazySweepPool(env, memoryPool, UDATA_MAX, false);
+			memoryPool->unlock(env);
+		}
+	}
+}
+
 /**
  * Perform a basic sweep operation.
  * There is no expectation for amount of work done for this routine.  The receiver is entitled to do as much or as little
@@ -817,7 +1051,8 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 
 /**
  * Complete any sweep work after a basic sweep operation.
- * Completing the sweep is a noop - the basic sweep operation consists of a full sweep.
+ * Completing the sweep is a noop - the basic sweep operation consists of a full sweep - unless chunks have been
+ * left to a lazy sweep, which are swept in parallel and connected.
  * 
  * @note Expect to have the dispatcher and worker threads available for work
  * @note Expect to have exclusive access
@@ -829,13 +1064,17 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 void
 MM_ParallelSweepScheme::completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason)
 {
-	/* No work - basic sweep will have done all the work */
+	if (0 != _lazySweepPoolCount) {
+		MM_ParallelLazySweepCompletionTask completionTask(env, _extensions->dispatcher, this);
+		_extensions->dispatcher->run(env, &completionTask);
+	}
 }
 
 /**
  * Sweep and connect the heap until a free entry of the specified size is found.
  * Sweeping for a minimum size involves completing a full sweep (there is no incremental operation) then
- * evaluating whether the minimum free size was found.
+ * evaluating whether the minimum free size was found.  Pools left to a lazy sweep are swept until one of them
+ * connects a free entry of the size.
  * 
  * @note Expects to have exclusive access
  * @note Expects to have control over the parallel GC threads (ie: able to dispatch tasks)
@@ -851,27 +1090,34 @@ MM_ParallelSweepScheme::sweepForMinimumSize(
 	sweep(env);
 	if (allocateDescription) {
 		uintptr_t minimumFreeSize =  allocateDescription->getBytesRequested();
+		if ((0 != _lazySweepPoolCount) && (minimumFreeSize > baseMemorySubSpace->findLargestFreeEntry(env, allocateDescription))) {
+			MM_MemoryPool *memoryPool = NULL;
+			MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+			while (NULL != (memoryPool = poolIterator.nextPool())) {
+				if (lazySweepPool(env, memoryPool, minimumFreeSize, false)) {
+					break;
+				}
+			}
+		}
 		return minimumFreeSize <= baseMemorySubSpace->findLargestFreeEntry(env, allocateDescription);
 	} else { 
 		return true;
 	}	
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
  * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
  * that can be done to increase the free stores of the pool so that the request can be met.
  * @note This call is made under the pools allocation lock (or equivalent)
- * @note The base implementation has completed all work, nothing further can be done.
+ * @note The base implementation has completed all work, unless chunks of the pool were left to a lazy sweep.
  * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
  */
 bool
 MM_ParallelSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
 {
-	return false;
+	return (0 != _lazySweepPoolCount) && lazySweepPool(env, memoryPool, size, false);
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 void
 MM_ParallelSweepScheme::setMarkMap(MM_MarkMap *markMap)
@@ -85,6 +85,25 @@ public:
 	}
 };
 
+/**
+ * Task to sweep the chunks a lazy sweep has left, to complete it.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelLazySweepCompletionTask : public MM_ParallelSweepTask
+{
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a ParallelLazySweepCompletionTask object.
+	 */
+	MM_ParallelLazySweepCompletionTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ParallelSweepScheme *sweepScheme) :
+		MM_ParallelSweepTask(env, dispatcher, sweepScheme)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Modron_Standard
@@ -110,6 +129,9 @@ protected:
 	J9Pool *_poolSweepPoolState;				/**< Memory pools for SweepPoolState*/ 
 	omrthread_monitor_t _mutexSweepPoolState;	/**< Monitor to protect memory pool operations for sweepPoolState*/
 
+	volatile uintptr_t _lazySweepPoolCount;	/**< Number of memory pools a lazy sweep has left chunks to sweep in */
+	double _lazySweepFreeRatio;	/**< Expected fraction of free bytes in the chunks left to a lazy sweep, from the live bytes found by the mark */
+
 public:
 	
 	/*
@@ -127,7 +149,7 @@ protected:
 	void sweepMarkMapTail(uintptr_t *markMapCurrent, uintptr_t *markMapChunkTop, uintptr_t &heapSlotFreeCount);
 
 	bool sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *sweepChunk);
-	void sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
+	void sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount, bool lazyChunks);
 	uintptr_t prepareAllChunks(MM_EnvironmentBase *env);
 	
 	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
@@ -141,6 +163,49 @@ protected:
 	MMINLINE MM_Heap *getHeap() { return _extensions->heap; };
 
 	void internalSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the chunks of the pool may be left to a lazy sweep
+	 */
+	bool isLazySweepEligible(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
+
+	/**
+	 * @return true if the chunk has been left to a lazy sweep, and is not yet swept
+	 */
+	bool isLazySweepChunk(MM_ParallelSweepChunk *chunk);
+
+	/**
+	 * Leave the chunks of every eligible pool to a lazy sweep.
+	 * @note called by the main thread only, once the chunks are prepared
+	 */
+	void prepareLazySweep(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
+
+	/**
+	 * Sweep and connect the chunks a lazy sweep has left in a pool, in address order, until a free entry of at
+	 * least the requested size is connected or the pool is completely swept.
+	 * @note The caller must hold the pool's allocation lock, or have exclusive access
+	 * @param minimumFreeSize[in] size of the free entry to look for, UDATA_MAX to sweep the whole pool
+	 * @param chunksSwept[in] true if the chunks left have already been swept, and only need to be connected
+	 * @return true if a free entry of at least minimumFreeSize was connected
+	 */
+	bool lazySweepPool(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t minimumFreeSize, bool chunksSwept);
+
+	/**
+	 * Update the free memory a pool can expect from the chunks a lazy sweep has left.
+	 */
+	void updateLazySweepApproximateFree(MM_MemoryPool *memoryPool, MM_SweepPoolState *sweepState);
+
+	/**
+	 * Sweep every chunk a lazy sweep has left, then connect them.
+	 * @note Do not call directly - used by the dispatcher for work threads.
+	 */
+	void internalCompleteLazySweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep every chunk a lazy sweep has left, on the calling thread.  Used when the heap geometry is about
+	 * to change, which can happen while other threads allocate.
+	 */
+	void completeLazySweep(MM_EnvironmentBase *env);
 	
 	virtual void setupForSweep(MM_EnvironmentBase *env);
 
@@ -189,9 +254,7 @@ public:
 	 */
 	void heapReconfigured(MM_EnvironmentBase *env);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	/**
 	 * Accurately measure the dark matter within the mark map uintptr_t beginning at heapSlotFreeCurrent.
@@ -209,7 +272,13 @@ public:
 	 */
 	uintptr_t performSamplingCalculations(MM_ParallelSweepChunk *sweepChunk, uintptr_t* markMapCurrent, uintptr_t* heapSlotFreeCurrent);
 
-	virtual bool isSweepCompleted(MM_EnvironmentBase* env) { return true; }
+	/**
+	 * Forget the chunks a lazy sweep has left.  Called once the pools are reset for a new global collection, whose
+	 * sweep rebuilds their free lists from scratch.
+	 */
+	void abandonLazySweep(MM_EnvironmentBase *env);
+
+	virtual bool isSweepCompleted(MM_EnvironmentBase* env) { return (0 == _lazySweepPoolCount); }
 
 	/**
 	 * Create a ParallelSweepScheme object.
@@ -225,6 +294,8 @@ public:
 		, _sweepHeapSectioning(NULL)
 		, _poolSweepPoolState(NULL)
 		, _mutexSweepPoolState(0)
+		, _lazySweepPoolCount(0)
+		, _lazySweepFreeRatio(0.0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -233,6 +304,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelSweepTask;
+	friend class MM_ParallelLazySweepCompletionTask;
 };
 
 #endif /* PARALLELSWEEPSCHEME_HPP_ */
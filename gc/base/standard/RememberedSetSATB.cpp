@@ -25,6 +25,7 @@
 
 #if defined(OMR_GC_REALTIME)
 
+#include "ConcurrentGCStats.hpp"
 #include "Debug.hpp"
 #include "RememberedSetSATB.hpp"
 #include "WorkPackets.hpp"
@@ -38,15 +39,16 @@
  * Create a new instance the MM_RememberedSetSATB class
  *
  * @param workPackets The workPackets 
+ * @param markingScheme The marking scheme consulted when filtering packets
  */
 MM_RememberedSetSATB *
-MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets)
+MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets, MM_MarkingScheme *markingScheme)
 {
 	MM_RememberedSetSATB *rememberedSet;
 	
 	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
 	if (NULL != rememberedSet) {
-		new(rememberedSet) MM_RememberedSetSATB(env, workPackets);
+		new(rememberedSet) MM_RememberedSetSATB(env, workPackets, markingScheme);
 		if (!rememberedSet->initialize(env)) {
 			rememberedSet->kill(env);
 			rememberedSet = NULL;
@@ -275,30 +277,44 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 {
 	MM_Packet *packet = NULL;
 	bool result = false;
+	UDATA globalIndex = getGlobalFragmentIndex(env);
+	
+	if (globalIndex != env->_sATBPacketFragmentIndex) {
+		/* The packets pooled under an earlier index were moved to the work packet lists with the in use list */
+		env->_sATBSparePacketCount = 0;
+		env->_sATBFullPacketCount = 0;
+		env->_sATBPacketFragmentIndex = globalIndex;
+	}
 	
-	packet = _workPackets->getBarrierPacket(env);
 	MM_Packet *oldPacket = (MM_Packet *)fragment->fragmentStorage;
-		
-	if ((NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == getGlobalFragmentIndex(env)) && (*fragment->fragmentTop == *fragment->fragmentAlloc)) {
-		_workPackets->removePacketFromInUseList(env, oldPacket);
-		_workPackets->putFullPacket(env, oldPacket);
+	bool oldPacketFull = (NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == globalIndex) && (*fragment->fragmentTop == *fragment->fragmentAlloc);
+	
+	if (oldPacketFull && env->getExtensions()->sATBBarrierFilter && filterPacket(env, oldPacket)) {
+		/* Enough of the packet was filtered out to keep filling it */
+		packet = oldPacket;
+	} else {
+		packet = getSparePacket(env);
+		if (oldPacketFull) {
+			env->_sATBFullPackets[env->_sATBFullPacketCount] = oldPacket;
+			env->_sATBFullPacketCount += 1;
+			if (env->_sATBFullPacketCount >= env->getExtensions()->sATBBarrierFlushBatch) {
+				flushFullPackets(env);
+			}
+		}
 	}
 	
 	if (J9GC_REMEMBERED_SET_RESERVED_INDEX == fragment->localFragmentIndex) {
-		fragment->preservedLocalFragmentIndex = getGlobalFragmentIndex(env);
+		fragment->preservedLocalFragmentIndex = globalIndex;
 	} else {
-		fragment->localFragmentIndex = getGlobalFragmentIndex(env);
+		fragment->localFragmentIndex = globalIndex;
 	}
-    fragment->fragmentParent = &_rememberedSetStruct;
+	fragment->fragmentParent = &_rememberedSetStruct;
 	
 	if (NULL != packet) {
 		fragment->fragmentAlloc = packet->getCurrentAddr(env);
 		fragment->fragmentTop = packet->getTopAddr(env);
 		fragment->fragmentStorage = (void *)packet;
-	    
-	    _workPackets->putInUsePacket(env, packet);
-	    
-	    result = true;
+		result = true;
 	} else {
 		fragment->fragmentAlloc = NULL;
 		fragment->fragmentTop = NULL;
@@ -308,4 +324,63 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	return result;
 }
 
+/**
+ * Take an empty packet from the spare packets of the thread, taking as many as -Xgc:sATBBarrierPackets= asks
+ * for from the work packets when there are none.
+ * 
+ * @return the packet, already on the in use list, or NULL if no packet could be found
+ */
+MM_Packet *
+MM_RememberedSetSATB::getSparePacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	
+	if (0 == env->_sATBSparePacketCount) {
+		env->_sATBSparePacketCount = _workPackets->getBarrierPackets(env, env->_sATBSparePackets, env->getExtensions()->sATBBarrierPackets);
+	}
+	if (0 != env->_sATBSparePacketCount) {
+		env->_sATBSparePacketCount -= 1;
+		packet = env->_sATBSparePackets[env->_sATBSparePacketCount];
+	}
+	
+	return packet;
+}
+
+/**
+ * Hand the filled packets of the thread to the full list.
+ */
+void
+MM_RememberedSetSATB::flushFullPackets(MM_EnvironmentBase *env)
+{
+	uintptr_t count = env->_sATBFullPacketCount;
+	
+	_workPackets->putFullPackets(env, env->_sATBFullPackets, count);
+	env->_sATBFullPacketCount = 0;
+	
+	if (NULL != _concurrentGCStats) {
+		_concurrentGCStats->incSATBPacketsFlushed(count);
+	}
+}
+
+/**
+ * Drop the NULL and already marked entries of a filled packet, which need no marking.
+ * 
+ * @return true if at least half of the packet is free again, for the thread to keep filling it
+ */
+bool
+MM_RememberedSetSATB::filterPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	uintptr_t nullCount = 0;
+	uintptr_t markedCount = 0;
+	
+	_workPackets->filterBarrierPacket(env, packet, _markingScheme, &nullCount, &markedCount);
+	
+	uintptr_t freeSlots = packet->freeSlots();
+	if (NULL != _concurrentGCStats) {
+		_concurrentGCStats->incSATBEntriesFiltered(MM_WorkPackets::getSlotsInPacket() - freeSlots, nullCount, markedCount);
+	}
+	
+	return (freeSlots >= (MM_WorkPackets::getSlotsInPacket() / 2));
+}
+
 #endif /* defined(OMR_GC_REALTIME) */
@@ -30,6 +30,21 @@
 #include "BaseNonVirtual.hpp"
 
 class EnvironmentModron;
+class MM_ConcurrentGCStats;
+class MM_MarkingScheme;
+
+/**
+ * The SATB barrier remembered set. Each thread records overwritten references in a fragment backed by a barrier
+ * work packet, which is handed to the full packet list when it fills up.
+ *
+ * To keep threads that store many references from taking the work packet locks for every packet, a thread takes
+ * -Xgc:sATBBarrierPackets= empty packets at once, and hands filled packets to the full list
+ * -Xgc:sATBBarrierFlushBatch= at a time. Pooled packets, empty or filled, stay on the in use barrier list so that
+ * they are moved to the work packet lists with it when concurrent tracing completes, and are forgotten by their
+ * thread once the global fragment index moves on. With -Xgc:sATBBarrierFilter, NULL and already marked entries are
+ * dropped from filled packets before they are handed off, and a packet filtered down to half its capacity is
+ * filled again instead.
+ */
 
 class MM_RememberedSetSATB : public MM_BaseNonVirtual
 {
@@ -39,16 +54,20 @@ public:
 protected:
 private:
 	MM_WorkPacketsSATB *_workPackets; /**< The workPackets struct used as backing store for the rememberedSet */
+	MM_MarkingScheme *_markingScheme; /**< The marking scheme consulted when filtering packets */
+	MM_ConcurrentGCStats *_concurrentGCStats; /**< The stats the flushing and filtering of packets are reported in, if any */
 
 /* Methods */
 public:
 	/* Constructors & destructors */
-	static MM_RememberedSetSATB *newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets);
+	static MM_RememberedSetSATB *newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets, MM_MarkingScheme *markingScheme);
 	void kill(MM_EnvironmentBase *env);
 
-	MM_RememberedSetSATB(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets) :
+	MM_RememberedSetSATB(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets, MM_MarkingScheme *markingScheme) :
 		MM_BaseNonVirtual(),
-		_workPackets(workPackets)
+		_workPackets(workPackets),
+		_markingScheme(markingScheme),
+		_concurrentGCStats(NULL)
 	{
 		_typeId = __FUNCTION__;
 		/* Initializing the global fragment index to the reserved index means the GC starts
@@ -78,6 +97,8 @@ public:
 	void flushFragments(MM_EnvironmentBase* env); /* Ensures all fragments will be seen as invalid next time they are accessed. */
 	bool refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSetFragment* fragment);
 
+	MMINLINE void setConcurrentGCStats(MM_ConcurrentGCStats *stats) { _concurrentGCStats = stats; }
+
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -86,6 +107,9 @@ protected:
 
 private:
 	void setGlobalIndex(MM_EnvironmentBase* env, UDATA indexValue); /* Increments the appropriate global index (global or preserved). */
+	bool filterPacket(MM_EnvironmentBase *env, MM_Packet *packet); /* Drops NULL and marked entries, true if the packet can be filled again. */
+	void flushFullPackets(MM_EnvironmentBase *env); /* Hands the filled packets pooled by the thread to the full list. */
+	MM_Packet *getSparePacket(MM_EnvironmentBase *env); /* Takes an empty packet from the thread's pool, refilling it as needed. */
 };
 #endif /* defined(OMR_GC_REALTIME) */
 #endif /* REMEMBEREDSETSATB_HPP_ */
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "Forge.hpp"
+#include "Heap.hpp"
+#include "RememberedSetSummary.hpp"
+
+MM_RememberedSetSummary *
+MM_RememberedSetSummary::newInstance(MM_EnvironmentBase *env)
+{
+	MM_RememberedSetSummary *summary = (MM_RememberedSetSummary *)env->getForge()->allocate(sizeof(MM_RememberedSetSummary), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != summary) {
+		new(summary) MM_RememberedSetSummary(env);
+		if (!summary->initialize(env)) {
+			summary->kill(env);
+			summary = NULL;
+		}
+	}
+	return summary;
+}
+
+void
+MM_RememberedSetSummary::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RememberedSetSummary::initialize(MM_EnvironmentBase *env)
+{
+	/* cover the whole reserved heap, so that tenure space can expand without the summary growing */
+	MM_Heap *heap = env->getExtensions()->heap;
+	_heapBase = (uintptr_t)heap->getHeapBase();
+	_heapTop = (uintptr_t)heap->getHeapTop();
+	uintptr_t chunkSize = (uintptr_t)1 << REMEMBERED_SET_SUMMARY_CHUNK_SHIFT;
+	_chunkCount = (_heapTop - _heapBase + chunkSize - 1) >> REMEMBERED_SET_SUMMARY_CHUNK_SHIFT;
+
+	uintptr_t tableSize = sizeof(uintptr_t) * _chunkCount;
+	_chunks = (volatile uintptr_t *)env->getForge()->allocate(tableSize, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _chunks) {
+		return false;
+	}
+	memset((void *)_chunks, 0, tableSize);
+
+	return true;
+}
+
+void
+MM_RememberedSetSummary::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _chunks) {
+		env->getForge()->free((void *)_chunks);
+		_chunks = NULL;
+	}
+}
+
+void
+MM_RememberedSetSummary::reset()
+{
+	if (!isEmpty()) {
+		memset((void *)_chunks, 0, sizeof(uintptr_t) * _chunkCount);
+		_summarizedChunkCount = 0;
+	}
+	invalidateFilters();
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
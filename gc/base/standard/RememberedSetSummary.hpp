@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(REMEMBEREDSETSUMMARY_HPP_)
+#define REMEMBEREDSETSUMMARY_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* log2 of the bytes of heap summarized by one entry of the remembered set summary */
+#define REMEMBERED_SET_SUMMARY_CHUNK_SHIFT 16
+/* Chunks a thread remembers publishing to, a power of two. */
+#define REMEMBERED_SET_SUMMARY_FILTER_SIZE 8
+
+/**
+ * Thread local record of the chunks of the remembered set summary a thread has published to, so that a
+ * thread remembering many objects of the same chunk reads and updates the shared summary only once.
+ * @ingroup GC_Modron_Standard
+ */
+struct MM_RememberedSetSummaryFilter {
+	uintptr_t epoch; /**< Summary epoch the entries were recorded in, entries of an older epoch are discarded */
+	uintptr_t chunks[REMEMBERED_SET_SUMMARY_FILTER_SIZE]; /**< Chunk index plus one, 0 for an unused entry */
+	uintptr_t lowest[REMEMBERED_SET_SUMMARY_FILTER_SIZE]; /**< Lowest object the summary held for the chunk when it was last published to */
+};
+
+/**
+ * Summary of the remembered objects the Scavenger could not, or chose not to, add to the remembered set list.
+ *
+ * The heap is divided in chunks of 2^REMEMBERED_SET_SUMMARY_CHUNK_SHIFT bytes and the summary holds the lowest
+ * summarized object of every chunk. Every summarized object is at or above the lowest object of its chunk, so
+ * the remembered objects of a chunk are found by walking it from that object, rather than walking all of tenure
+ * space as a remembered set overflow requires.
+ *
+ * Objects only ever lower the entry of their chunk, so a thread that has seen an entry at or below an object
+ * knows the object is covered without reading the summary again (see MM_RememberedSetSummaryFilter). Entries
+ * are only cleared while no thread adds objects, and clearing them advances the epoch that invalidates filters.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetSummary : public MM_BaseNonVirtual
+{
+/* Data members */
+private:
+	uintptr_t _heapBase; /**< Base of the first chunk */
+	uintptr_t _heapTop; /**< Top of the last chunk */
+	uintptr_t _chunkCount; /**< Entries in _chunks */
+	volatile uintptr_t *_chunks; /**< Lowest summarized object of every chunk, 0 for a chunk with none */
+	volatile uintptr_t _summarizedChunkCount; /**< Entries of _chunks that are not 0 */
+	volatile uintptr_t _epoch; /**< Advanced every time entries are cleared */
+
+/* Methods */
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_RememberedSetSummary *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Summarize a remembered object. May be called by several threads concurrently.
+	 * @param filter[in] the filter of the calling thread
+	 * @param objectPtr[in] a remembered object in tenure space
+	 * @return false if the filter showed the object was already covered, true if the summary was consulted
+	 */
+	MMINLINE bool
+	addObject(MM_RememberedSetSummaryFilter *filter, omrobjectptr_t objectPtr)
+	{
+		uintptr_t address = (uintptr_t)objectPtr;
+		uintptr_t chunk = (address - _heapBase) >> REMEMBERED_SET_SUMMARY_CHUNK_SHIFT;
+		uintptr_t entry = chunk & (REMEMBERED_SET_SUMMARY_FILTER_SIZE - 1);
+
+		if (filter->epoch != _epoch) {
+			memset(filter->chunks, 0, sizeof(filter->chunks));
+			filter->epoch = _epoch;
+		} else if (((chunk + 1) == filter->chunks[entry]) && (filter->lowest[entry] <= address)) {
+			return false;
+		}
+
+		uintptr_t lowest = _chunks[chunk];
+		while ((0 == lowest) || (address < lowest)) {
+			uintptr_t witness = MM_AtomicOperations::lockCompareExchange(&_chunks[chunk], lowest, address);
+			if (witness == lowest) {
+				if (0 == lowest) {
+					MM_AtomicOperations::add(&_summarizedChunkCount, 1);
+				}
+				lowest = address;
+				break;
+			}
+			lowest = witness;
+		}
+
+		filter->chunks[entry] = chunk + 1;
+		filter->lowest[entry] = lowest;
+		return true;
+	}
+
+	/**
+	 * @param chunk[in] index of a chunk, less than getChunkCount()
+	 * @return the lowest summarized object of the chunk, NULL if it has none
+	 */
+	MMINLINE omrobjectptr_t getLowestObject(uintptr_t chunk) { return (omrobjectptr_t)_chunks[chunk]; }
+
+	/**
+	 * Forget the objects summarized for a chunk. Must be called while no thread adds objects, and followed
+	 * by invalidateFilters() before objects are added again.
+	 * @param chunk[in] index of a chunk, less than getChunkCount()
+	 * @return the lowest summarized object the chunk had, NULL if it had none
+	 */
+	MMINLINE omrobjectptr_t
+	removeChunk(uintptr_t chunk)
+	{
+		omrobjectptr_t lowest = (omrobjectptr_t)_chunks[chunk];
+		if (NULL != lowest) {
+			_chunks[chunk] = 0;
+			_summarizedChunkCount -= 1;
+		}
+		return lowest;
+	}
+
+	/**
+	 * @param chunk[in] index of a chunk, less than getChunkCount()
+	 * @return the address the chunk ends at
+	 */
+	MMINLINE omrobjectptr_t
+	getChunkTop(uintptr_t chunk)
+	{
+		uintptr_t top = _heapBase + ((chunk + 1) << REMEMBERED_SET_SUMMARY_CHUNK_SHIFT);
+		return (omrobjectptr_t)OMR_MIN(top, _heapTop);
+	}
+
+	/**
+	 * Discard what threads recorded in their filters. Must be called while no thread adds objects.
+	 */
+	MMINLINE void invalidateFilters() { _epoch += 1; }
+
+	/**
+	 * Forget every summarized object. Must be called while no thread adds objects.
+	 */
+	void reset();
+
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+	MMINLINE uintptr_t getSummarizedChunkCount() { return _summarizedChunkCount; }
+	MMINLINE bool isEmpty() { return 0 == _summarizedChunkCount; }
+
+	MM_RememberedSetSummary(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _heapBase(0)
+		, _heapTop(0)
+		, _chunkCount(0)
+		, _chunks(NULL)
+		, _summarizedChunkCount(0)
+		, _epoch(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETSUMMARY_HPP_ */
@@ -61,6 +61,8 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HotFieldProfiler.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -76,7 +78,9 @@
 #include "ParallelDispatcher.hpp"
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
+#include "PretenureProfiler.hpp"
 #include "RSOverflow.hpp"
+#include "RememberedSetSummary.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
 #include "ScavengerRootScanner.hpp"
@@ -108,17 +112,6 @@
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
-/* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
- * a quick implementation
- */
-#if defined(AIXPPC) || defined(LINUXPPC)
-#define CACHE_LINE_SIZE 128
-#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
-#define CACHE_LINE_SIZE 256
-#else
-#define CACHE_LINE_SIZE 64
-#endif
-
 /* create macros to interpret the hot field descriptor */
 #define HOTFIELD_SHOULD_ALIGN(descriptor) (0x1 == (0x1 & (descriptor)))
 #define HOTFIELD_ALIGNMENT_BIAS(descriptor, heapObjectAlignment) (((descriptor) >> 1) * (heapObjectAlignment))
@@ -292,12 +285,41 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 			return false;
 		}
 	}
+
+	if (_extensions->isConcurrentScavengerPageProtectionEnabled()) {
+		_pageProtection = MM_ConcurrentScavengerPageProtection::newInstance(env);
+		if (NULL == _pageProtection) {
+			return false;
+		}
+		_writableHeapDelta = _pageProtection->getViewDelta();
+	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	if (!_delegate.initialize(env)) {
 		return false;
 	}
 
+	if (_extensions->learnHotFields) {
+		_extensions->hotFieldProfiler = MM_HotFieldProfiler::newInstance(env);
+		if (NULL == _extensions->hotFieldProfiler) {
+			return false;
+		}
+	}
+
+	if (0 != _extensions->pretenureSurvivalThreshold) {
+		_extensions->pretenureProfiler = MM_PretenureProfiler::newInstance(env);
+		if (NULL == _extensions->pretenureProfiler) {
+			return false;
+		}
+	}
+
+	if ((0 != _extensions->rememberedSetSummaryThreshold) && !IS_CONCURRENT_ENABLED) {
+		_extensions->rememberedSetSummary = MM_RememberedSetSummary::newInstance(env);
+		if (NULL == _extensions->rememberedSetSummary) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -306,6 +328,29 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (NULL != _pageProtection) {
+		_pageProtection->kill(env);
+		_pageProtection = NULL;
+		_writableHeapDelta = 0;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+	if (NULL != _extensions->hotFieldProfiler) {
+		_extensions->hotFieldProfiler->kill(env);
+		_extensions->hotFieldProfiler = NULL;
+	}
+
+	if (NULL != _extensions->rememberedSetSummary) {
+		_extensions->rememberedSetSummary->kill(env);
+		_extensions->rememberedSetSummary = NULL;
+	}
+
+	if (NULL != _extensions->pretenureProfiler) {
+		_extensions->pretenureProfiler->kill(env);
+		_extensions->pretenureProfiler = NULL;
+	}
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -396,6 +441,14 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	/* invoke language-specific interface callback */
 	_delegate.mainSetupForGC(env);
 
+	/* periodically forget the hot field samples, so that learned hot fields follow changes in the application */
+	if ((NULL != _extensions->hotFieldProfiler) && _extensions->hotFieldResettingEnabled && (0 != _extensions->gcCountBetweenHotFieldReset)) {
+		uintptr_t gcCount = _extensions->scavengerStats._gcCount;
+		if ((0 != gcCount) && (0 == (gcCount % _extensions->gcCountBetweenHotFieldReset))) {
+			_extensions->hotFieldProfiler->resetSamples(env);
+		}
+	}
+
 	/* Allow expansion in the tenure area on failed promotions (but no resizing on the semispace) */
 	_expandTenureOnFailedAllocate = true;
 	_activeSubSpace = (MM_MemorySubSpaceSemiSpace *)(env->_cycleState->_activeSubSpace);
@@ -444,6 +497,11 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
+	_isRememberedSetOverflowSummarizedAtTheBeginning = (NULL != _extensions->rememberedSetSummary) && _extensions->isScavengerRememberedSetOverflowSummarized();
+	if (_isRememberedSetOverflowSummarizedAtTheBeginning) {
+		/* the overflow scan finds the listed objects through the summary as well */
+		summarizeRememberedSetList(env);
+	}
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
@@ -834,6 +892,14 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_prefetchedForwarded += scavStats->_prefetchedForwarded;
+	finalGCStats->_prefetchedCopied += scavStats->_prefetchedCopied;
+	finalGCStats->_hotFieldSamples += scavStats->_hotFieldSamples;
+	finalGCStats->_rememberedSetSummarizedObjects += scavStats->_rememberedSetSummarizedObjects;
+	finalGCStats->_rememberedSetSummaryFilterHits += scavStats->_rememberedSetSummaryFilterHits;
+	finalGCStats->_rememberedSetSummaryChunksWalked += scavStats->_rememberedSetSummaryChunksWalked;
+	finalGCStats->_rememberedSetOverflowWalksAvoided += scavStats->_rememberedSetOverflowWalksAvoided;
+	finalGCStats->_pretenureSamples += scavStats->_pretenureSamples;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -855,6 +921,13 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 {
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 
+	if (NULL != _extensions->hotFieldProfiler) {
+		_extensions->hotFieldProfiler->flushSamples(env, &MM_EnvironmentStandard::getEnvironment(env)->_hotFieldSamples);
+	}
+	if (NULL != _extensions->pretenureProfiler) {
+		_extensions->pretenureProfiler->flushSamples(env, &MM_EnvironmentStandard::getEnvironment(env)->_pretenureSamples);
+	}
+
 	/* Protect the merge with the mutex (this is done by multiple threads in the parallel collector) */
 	omrthread_monitor_enter(_extensions->gcStatsMutex);
 
@@ -924,6 +997,28 @@ MM_Scavenger::mergeIncrementGCStats(MM_EnvironmentBase *env, bool lastIncrement)
 
 		finalGCStats->_semiSpaceAllocBytesAcumulation = 0;
 		finalGCStats->_tenureSpaceAllocBytesAcumulation = 0;
+
+		/* every thread has flushed its hot field samples, and no thread is copying */
+		MM_HotFieldProfiler *hotFieldProfiler = _extensions->hotFieldProfiler;
+		if (NULL != hotFieldProfiler) {
+			hotFieldProfiler->publish(env);
+			_extensions->incrementScavengerStats._learnedHotFieldClasses = hotFieldProfiler->getLearnedClassCount();
+			_extensions->incrementScavengerStats._learnedHotFieldClassesUpdated = hotFieldProfiler->getUpdatedClassCount();
+		}
+
+		if (NULL != _extensions->rememberedSetSummary) {
+			_extensions->incrementScavengerStats._rememberedSetSize = _extensions->rememberedSet.countElements();
+			_extensions->incrementScavengerStats._rememberedSetSummaryChunks = _extensions->rememberedSetSummary->getSummarizedChunkCount();
+		}
+
+		/* every thread has flushed its tenured samples, and no thread allocates */
+		MM_PretenureProfiler *pretenureProfiler = _extensions->pretenureProfiler;
+		if (NULL != pretenureProfiler) {
+			pretenureProfiler->publish(env);
+			_extensions->incrementScavengerStats._pretenureProfiledSites = pretenureProfiler->getSiteCount();
+			_extensions->incrementScavengerStats._pretenuredSites = pretenureProfiler->getPretenuredSiteCount();
+			_extensions->incrementScavengerStats._pretenuredSitesAdded = pretenureProfiler->getNewlyPretenuredSiteCount();
+		}
 	}
 }
 
@@ -1173,15 +1268,27 @@ retry:
 				Assert_MM_true(NULL != env->_survivorTLHRemainderTop);
 				env->_survivorTLHRemainderTop = NULL;
 				activateDeferredCopyScanCache(env);
-			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
-				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
+			} else if ((_extensions->tlhSurvivorDiscardThreshold < cacheSize) || isCopyDestinationProtected()) {
+				/* protected chunks are whole pages, so they are not allocated as TLHs, which may be smaller than a page */
+				uintptr_t chunkSize = cacheSize;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+				if (isCopyDestinationProtected()) {
+					chunkSize = calculateProtectedCopyChunkSize(env, cacheSize);
+				}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+				MM_AllocateDescription allocDescription(chunkSize, 0, false, true);
 
 				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
 				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+					addrTop = (void *)(((uint8_t *)addrBase) + chunkSize);
 					/* Check that there is no overflow */
 					Assert_MM_true(addrTop >= addrBase);
 					allocateResult = true;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					if (isCopyDestinationProtected()) {
+						allocateResult = protectCopyChunk(env, _survivorMemorySubSpace, &addrBase, &addrTop, cacheSize);
+					}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
@@ -1225,7 +1332,7 @@ retry:
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
-				_survivorMemorySubSpace->abandonHeapChunk(addrBase, addrTop);
+				abandonCopyChunk(env, _survivorMemorySubSpace, addrBase, addrTop);
 			}
 
 			env->_survivorCopyScanCache = copyCache;
@@ -1289,15 +1396,27 @@ retry:
 				env->_tenureTLHRemainderTop = NULL;
 				env->_loaAllocation = false;
 				activateDeferredCopyScanCache(env);
-			} else if (_extensions->tlhTenureDiscardThreshold < cacheSize) {
-				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
+			} else if ((_extensions->tlhTenureDiscardThreshold < cacheSize) || isCopyDestinationProtected()) {
+				/* protected chunks are whole pages, so they are not allocated as TLHs, which may be smaller than a page */
+				uintptr_t chunkSize = cacheSize;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+				if (isCopyDestinationProtected()) {
+					chunkSize = calculateProtectedCopyChunkSize(env, cacheSize);
+				}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+				MM_AllocateDescription allocDescription(chunkSize, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				addrBase = _tenureMemorySubSpace->collectorAllocate(env, this, &allocDescription);
 				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+					addrTop = (void *)(((uint8_t *)addrBase) + chunkSize);
 					/* Check that there is no overflow */
 					Assert_MM_true(addrTop >= addrBase);
 					allocateResult = true;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					if (isCopyDestinationProtected()) {
+						allocateResult = protectCopyChunk(env, _tenureMemorySubSpace, &addrBase, &addrTop, cacheSize);
+					}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 					if (allocDescription.isLOAAllocation()) {
@@ -1359,7 +1478,7 @@ retry:
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
-				_tenureMemorySubSpace->abandonHeapChunk(addrBase, addrTop);
+				abandonCopyChunk(env, _tenureMemorySubSpace, addrBase, addrTop);
 			}
 
 			env->_tenureCopyScanCache = copyCache;
@@ -1549,6 +1668,13 @@ MM_Scavenger::forwardingFailed(MM_EnvironmentStandard *env, MM_ForwardedHeader*
 MMINLINE void
 MM_Scavenger::forwardingSucceeded(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *copyCache, void *newCacheAlloc, uintptr_t oldObjectAge, uintptr_t objectCopySizeInBytes, uintptr_t objectReserveSizeInBytes)
 {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* The copy (and any hole in front of it) is complete, a mutator may scan it once its pages are filled */
+	if (isCopyDestinationProtected()) {
+		_pageProtection->publish(copyCache->cacheAlloc, newCacheAlloc);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	/* Move the cache allocate pointer to reflect the consumed memory */
 	copyCache->cacheAlloc = newCacheAlloc;
 
@@ -1722,8 +1848,9 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 		/* For smaller objects, we allow duplicate (copy first and try to win forwarding).
 		 * For larger objects, there is only one copy (threads setup destination header, one wins, and other participate in copying or wait till copy is complete).
 		 * 1024 is somewhat arbitrary threshold, so that most of time we do not have to go through relatively expensive setup procedure.
+		 * With protected copy destinations no mutator can see a copy before it is published, so every object is copied first.
 		 */
-		if (objectCopySizeInBytes <= 1024) {
+		if ((objectCopySizeInBytes <= 1024) || (NULL != _pageProtection)) {
 			allowDuplicate = true;
 		} else {
 			remainingSizeToCopy = objectCopySizeInBytes;
@@ -1746,7 +1873,7 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 
 		if (NULL != hotFieldPadBase) {
 			/* lay down a hole (XXX:  This assumes that we are using AOL (address-ordered-list)) */
-			MM_HeapLinkedFreeHeader::fillWithHoles(hotFieldPadBase, hotFieldPadSize, compressed);
+			MM_HeapLinkedFreeHeader::fillWithHoles(toWritableHeap(hotFieldPadBase), hotFieldPadSize, compressed);
 		}
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -1772,12 +1899,15 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 		} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 		{
-			memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			/* a protected copy destination is only writable through the writable view */
+			omrobjectptr_t writableDestinationObjectPtr = (omrobjectptr_t)toWritableHeap(destinationObjectPtr);
+
+			memcpy((void *)writableDestinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
 
 			/* Copy the preserved fields from the forwarded header into the destination object */
-			forwardedHeader->fixupForwardedObject(destinationObjectPtr);
+			forwardedHeader->fixupForwardedObject(writableDestinationObjectPtr);
 
-			_extensions->objectModel.fixupForwardedObject(forwardedHeader, destinationObjectPtr, objectAge);
+			_extensions->objectModel.fixupForwardedObject(forwardedHeader, writableDestinationObjectPtr, objectAge);
 		}
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -1791,7 +1921,7 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 
 #if defined(OMR_SCAVENGER_TRACE_COPY)
 		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
-		omrtty_printf("{SCAV: Copied %p[%p] -> %p[%p]}\n", forwardedHeader->getObject(), *((uintptr_t*)(forwardedHeader->getObject())), destinationObjectPtr, *((uintptr_t*)destinationObjectPtr));
+		omrtty_printf("{SCAV: Copied %p[%p] -> %p[%p]}\n", forwardedHeader->getObject(), *((uintptr_t*)(forwardedHeader->getObject())), destinationObjectPtr, *((uintptr_t*)toWritableHeap(destinationObjectPtr)));
 #endif /* OMR_SCAVENGER_TRACE_COPY */
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1810,8 +1940,18 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 			forwardingSucceeded(env, copyCache, newCacheAlloc, oldObjectAge, objectCopySizeInBytes, objectReserveSizeInBytes);
 
+			/* sample the allocation sites of tenured objects, for the survival rate of the sites */
+			MM_PretenureProfiler *pretenureProfiler = _extensions->pretenureProfiler;
+			if ((NULL != pretenureProfiler) && (0 != (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_TENURESPACE)) && pretenureProfiler->shouldSample(&env->_pretenureSamples)) {
+				void *siteKey = _extensions->objectModel.getAllocationSiteKey(forwardedHeader);
+				if (NULL != siteKey) {
+					pretenureProfiler->addSample(env, &env->_pretenureSamples, siteKey);
+					env->_scavengerStats._pretenureSamples += 1;
+				}
+			}
+
 			/* depth copy the hot fields of an object if scavenger dynamicBreadthFirstScanOrdering is enabled */
-			depthCopyHotFields(env, forwardedHeader, destinationObjectPtr);
+			depthCopyHotFields(env, forwardedHeader, (omrobjectptr_t)toWritableHeap(destinationObjectPtr));
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		} else { /* CS build flag  enabled: mid point of nested if-forwarding-succeeded check */
 
@@ -1846,12 +1986,31 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 					copyHotField(env, destinationObjectPtr, hotFieldOffset3);
 				}
 			}
-		} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+		} else if (!copyLearnedHotFields(env, forwardedHeader, destinationObjectPtr)
+			&& _extensions->alwaysDepthCopyFirstOffset
+			&& !_extensions->objectModel.isIndexable(forwardedHeader)
+		) {
 			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
 		}
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::copyLearnedHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr)
+{
+	MM_HotFieldProfiler *hotFieldProfiler = _extensions->hotFieldProfiler;
+	if (NULL == hotFieldProfiler) {
+		return false;
+	}
+
+	const uint8_t *hotFields = NULL;
+	uintptr_t hotFieldCount = hotFieldProfiler->getHotFields(_extensions->objectModel.getHotFieldProfileKey(forwardedHeader), &hotFields);
+	for (uintptr_t i = 0; i < hotFieldCount; i++) {
+		copyHotField(env, destinationObjectPtr, hotFields[i]);
+	}
+	return (0 != hotFieldCount);
+}
+
 MMINLINE void
 MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset) {
 	bool const compressed = _extensions->compressObjectReferences();
@@ -1916,7 +2075,8 @@ MM_Scavenger::splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_Object
 					/* set up the split copy cache and clone the object scanner into the cache */
 					omrarrayptr_t arrayPtr = (omrarrayptr_t)indexableScanner->getArrayObject();
 					void* arrayTop = (void*)((uintptr_t)arrayPtr + _extensions->indexableObjectModel.getSizeInBytesWithHeader(arrayPtr));
-					splitCache->reinitCache((omrobjectptr_t)arrayPtr, arrayTop);
+					/* the scanner may scan the array through the writable view, the cache holds its address in the heap */
+					splitCache->reinitCache((omrobjectptr_t)fromWritableHeap(arrayPtr), fromWritableHeap(arrayTop));
 					splitCache->cacheAlloc = splitCache->cacheTop;
 					splitCache->_arraySplitIndex = endIndex;
 					splitCache->_arraySplitRememberedSlot = rememberedSetSlot;
@@ -1971,16 +2131,108 @@ MM_Scavenger::flushCopyScanCounts(MM_EnvironmentBase* env, bool majorFlush)
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::scavengeObjectSlotsBatched(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t windowSize, uint64_t *slotsScanned, uint64_t *slotsCopied)
+{
+	fomrobject_t *windowSlots[MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE];
+	omrobjectptr_t windowReferents[MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE];
+	GC_SlotObject windowSlotObject(env->getOmrVM(), NULL);
+	bool const compressed = _extensions->compressObjectReferences();
+	uint64_t prefetchedForwarded = 0;
+	uint64_t prefetchedCopied = 0;
+	bool shouldRemember = false;
+	bool moreSlots = true;
+
+	Assert_MM_true(windowSize <= MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE);
+
+	while (moreSlots) {
+		/* Collect a window of slots, prefetching the header of every referent that may have to be forwarded */
+		uintptr_t windowCount = 0;
+		while (windowCount < windowSize) {
+			GC_SlotObject *slotObject = objectScanner->getNextSlot();
+			if (NULL == slotObject) {
+				moreSlots = false;
+				break;
+			}
+			omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+			if ((NULL != objectPtr) && isObjectInEvacuateMemory(objectPtr)) {
+				MM_PREFETCH_FOR_READ(objectPtr);
+			} else {
+				objectPtr = NULL;
+			}
+			windowSlots[windowCount] = slotObject->readAddressFromSlot();
+			windowReferents[windowCount] = objectPtr;
+			windowCount += 1;
+		}
+
+		/* Forward the window, by now the first headers should be in cache */
+		for (uintptr_t i = 0; i < windowCount; i++) {
+			if (NULL != windowReferents[i]) {
+				/* whether the prefetched header was all that forwarding needed, or the referent was still to be copied */
+				if (MM_ForwardedHeader(windowReferents[i], compressed).isForwardedPointer()) {
+					prefetchedForwarded += 1;
+				} else {
+					prefetchedCopied += 1;
+				}
+			}
+			windowSlotObject.writeAddressToSlot(windowSlots[i]);
+			shouldRemember |= copyAndForward(env, &windowSlotObject);
+			if (NULL != env->_effectiveCopyScanCache) {
+				*slotsCopied += 1;
+			}
+		}
+		*slotsScanned += windowCount;
+	}
+
+	env->_scavengerStats._prefetchedForwarded += prefetchedForwarded;
+	env->_scavengerStats._prefetchedCopied += prefetchedCopied;
+
+	return shouldRemember;
+}
+
+MMINLINE bool
+MM_Scavenger::scavengeObjectSlotsSampled(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied)
+{
+	MM_HotFieldProfiler *hotFieldProfiler = _extensions->hotFieldProfiler;
+	void *classKey = _extensions->objectModel.getHotFieldProfileKey(objectPtr);
+	bool const compressed = _extensions->compressObjectReferences();
+	uint64_t samples = 0;
+	bool shouldRemember = false;
+	GC_SlotObject *slotObject = NULL;
+
+	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		if (NULL != classKey) {
+			/* the fields worth copying next to their parent are those leading to objects that survive */
+			omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+			if ((NULL != referent) && isObjectInEvacuateMemory(referent)) {
+				intptr_t slotIndex = GC_SlotObject::subtractSlotAddresses(slotObject->readAddressFromSlot(), (fomrobject_t *)objectPtr, compressed);
+				hotFieldProfiler->addSample(env, &env->_hotFieldSamples, classKey, (uintptr_t)slotIndex);
+				samples += 1;
+			}
+		}
+		shouldRemember |= copyAndForward(env, slotObject);
+		if (NULL != env->_effectiveCopyScanCache) {
+			*slotsCopied += 1;
+		}
+		*slotsScanned += 1;
+	}
+
+	env->_scavengerStats._hotFieldSamples += samples;
+
+	return shouldRemember;
+}
+
 MMINLINE bool
 MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
 {
+	omrobjectptr_t writableObjectPtr = (omrobjectptr_t)toWritableHeap(objectPtr);
 	GC_ObjectScanner *objectScanner = NULL;
 	GC_ObjectScannerState objectScannerState;
 	bool shouldRemember = false;
 	/* scanCache will be NULL if called from outside completeScan() */
 	if ((NULL == scanCache) || !scanCache->isSplitArray()) {
-		/* try to get a new scanner instance from the cli */
-		objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, flags, SCAN_REASON_SCAVENGE, &shouldRemember);
+		/* try to get a new scanner instance from the cli, the slots of a protected copy are only writable through the writable view */
+		objectScanner = getObjectScanner(env, writableObjectPtr, &objectScannerState, flags, SCAN_REASON_SCAVENGE, &shouldRemember);
 		if ((NULL == objectScanner) || objectScanner->isLeafObject()) {
 			/* Object scanner will be NULL if object not scannable by cli (eg, empty pointer array, primitive array) */
 			if (NULL != objectScanner) {
@@ -1997,7 +2249,7 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 #if defined(OMR_GC_MODRON_SCAVENGER_STRICT)
 	if ((NULL != scanCache) && objectScanner->isIndexableObject()) {
 		GC_IndexableObjectScanner *indexableScanner = (GC_IndexableObjectScanner *)objectScanner;
-		Assert_MM_true(objectPtr == indexableScanner->getArrayObject());
+		Assert_MM_true(writableObjectPtr == indexableScanner->getArrayObject());
 		Assert_MM_true(scanCache->isSplitArray() && (0 < scanCache->_arraySplitIndex));
 		Assert_MM_true(rememberedSetSlot == scanCache->_arraySplitRememberedSlot);
 	}
@@ -2017,13 +2269,25 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t prefetchWindowSize = _extensions->scavengerPrefetchWindowSize;
+	if ((NULL != _extensions->hotFieldProfiler)
+		&& (NULL != scanCache)
+		&& !objectScanner->isIndexableObject()
+		&& _extensions->hotFieldProfiler->shouldSample(&env->_hotFieldSamples)
+	) {
+		/* only objects copied this scavenge are sampled, roots and remembered objects are not copied next to their children */
+		shouldRemember |= scavengeObjectSlotsSampled(env, writableObjectPtr, objectScanner, &slotsScanned, &slotsCopied);
+	} else if (1 < prefetchWindowSize) {
+		shouldRemember |= scavengeObjectSlotsBatched(env, objectScanner, prefetchWindowSize, &slotsScanned, &slotsCopied);
+	} else {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2079,7 +2343,11 @@ MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t object
 		if(env->approxScanCacheCount > freeListUtilizationLimit) {
 			break;
 		}
+		/* the copy may be protected from the mutators, follow it through the writable view */
 		currentDeepObj = prioritySlot.readReferenceFromSlot();
+		if (NULL != currentDeepObj) {
+			currentDeepObj = toWritableHeap(currentDeepObj);
+		}
 
 	/* The successfully copied object slot can possibly be overwritten with NULL by a mutator (CS).
 	 * To avoid race condition, we need a NULL check before we proceed. */
@@ -2413,14 +2681,16 @@ MM_Scavenger::completeScanCache(MM_EnvironmentStandard *env, MM_CopyScanCacheSta
 		}
 	} else {
 		while (scanCache->isScanWorkAvailable()) {
+			/* walk the chunk through the writable view, the copies in it may be protected from the mutators */
 			GC_ObjectHeapIteratorAddressOrderedList heapChunkIterator(
 				_extensions,
-				(omrobjectptr_t)scanCache->scanCurrent,
-				(omrobjectptr_t)scanCache->cacheAlloc, false);
+				(omrobjectptr_t)toWritableHeap(scanCache->scanCurrent),
+				(omrobjectptr_t)toWritableHeap(scanCache->cacheAlloc), false);
 			/* Advance the scan pointer to the top of the cache to signify that this has been scanned */
 			scanCache->scanCurrent = scanCache->cacheAlloc;
 			/* Scan the chunk for all live objects */
 			while ((objectPtr = heapChunkIterator.nextObjectNoAdvance()) != NULL) {
+				objectPtr = (omrobjectptr_t)fromWritableHeap(objectPtr);
 				/* If the object should be remembered and it is in old space, remember it */
 				bool shouldBeRemembered = scavengeObjectSlots(env, scanCache, objectPtr, GC_ObjectScanner::scanHeap, NULL);
 				if (shouldBeRemembered) {
@@ -2655,16 +2925,95 @@ MM_Scavenger::addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_
 	}
 }
 
+void
+MM_Scavenger::addSummarizedRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow)
+{
+	MM_RememberedSetSummary *summary = _extensions->rememberedSetSummary;
+	uintptr_t chunkCount = summary->getChunkCount();
+	uintptr_t remainingChunks = summary->getSummarizedChunkCount();
+
+	/* Walk the chunks of tenure holding summarized objects, from the lowest summarized object of each */
+	for (uintptr_t chunk = 0; (0 < remainingChunks) && (chunk < chunkCount); chunk++) {
+		omrobjectptr_t lowestObject = summary->getLowestObject(chunk);
+		if (NULL != lowestObject) {
+			omrobjectptr_t chunkTop = summary->getChunkTop(chunk);
+			MM_HeapRegionDescriptorStandard *region = NULL;
+			GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+			while (NULL != (region = regionIterator.nextRegion())) {
+				omrobjectptr_t base = OMR_MAX(lowestObject, (omrobjectptr_t)region->getLowAddress());
+				omrobjectptr_t top = OMR_MIN(chunkTop, (omrobjectptr_t)region->getHighAddress());
+				if (base < top) {
+					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, base, top, false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						if (_extensions->objectModel.isRemembered(objectPtr)) {
+							/* mark remembered objects */
+							overflow->addObject(objectPtr);
+						}
+					}
+				}
+			}
+			env->_scavengerStats._rememberedSetSummaryChunksWalked += 1;
+			remainingChunks -= 1;
+		}
+	}
+}
+
+void
+MM_Scavenger::summarizeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	if (!_extensions->rememberedSetSummary->addObject(&env->_rememberedSetSummaryFilter, objectPtr)) {
+		env->_scavengerStats._rememberedSetSummaryFilterHits += 1;
+	}
+	env->_scavengerStats._rememberedSetSummarizedObjects += 1;
+	_extensions->setScavengerRememberedSetSummarizedOverflowState();
+}
+
+void
+MM_Scavenger::summarizeRememberedSetList(MM_EnvironmentStandard *env)
+{
+	MM_RememberedSetSummary *summary = _extensions->rememberedSetSummary;
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		omrobjectptr_t *slotPtr = NULL;
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			/* objects flagged for deferred removal are still remembered, and are verified when their chunk is pruned */
+			omrobjectptr_t objectPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+			if (NULL != objectPtr) {
+				summary->addObject(&env->_rememberedSetSummaryFilter, objectPtr);
+			}
+		}
+	}
+	clearRememberedSetLists(env);
+}
+
+bool
+MM_Scavenger::allocateRememberedSetFragment(MM_EnvironmentStandard *env)
+{
+	J9VMGC_SublistFragment *fragmentPrimitive = (J9VMGC_SublistFragment *)&env->_scavengerRememberedSet;
+	MM_SublistFragment fragment(fragmentPrimitive);
+
+	MM_SublistFragment::flush(fragmentPrimitive);
+	return _extensions->rememberedSet.allocate(env, &fragment);
+}
+
 void
 MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
 	Assert_MM_true(NULL != objectPtr);
 	Assert_MM_true(!isObjectInNewSpace(objectPtr));
-	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+	Assert_MM_true(_extensions->objectModel.isRemembered((omrobjectptr_t)toWritableHeap(objectPtr)));
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
-		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		if (NULL != _extensions->rememberedSetSummary) {
+			/* Once the list is large, or can not grow, summarize objects rather than overflow */
+			if ((_extensions->rememberedSet.countElements() >= _extensions->rememberedSetSummaryThreshold) || !allocateRememberedSetFragment(env)) {
+				summarizeRememberedObject(env, objectPtr);
+				return ;
+			}
+		} else if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if (!_isRememberedSetInOverflowAtTheBeginning) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
@@ -2691,7 +3040,8 @@ MM_Scavenger::rememberObject(MM_EnvironmentStandard *env, omrobjectptr_t objectP
 {
 	/* Try to set the REMEMBERED bit in the flags field (if it hasn't already been set) */
 	if(!isObjectInNewSpace(objectPtr)) {
-		if(_extensions->objectModel.atomicSetRememberedState(objectPtr, STATE_REMEMBERED)) {
+		/* the header of a tenured copy may be protected from the mutators, it is set through the writable view */
+		if(_extensions->objectModel.atomicSetRememberedState((omrobjectptr_t)toWritableHeap(objectPtr), STATE_REMEMBERED)) {
 			/* The object has been successfully marked as REMEMBERED - allocate an entry in the remembered set */
 			addToRememberedSetFragment(env, objectPtr);
 		}
@@ -2855,7 +3205,13 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Creation of this class will Abort Global Collector */
 		MM_RSOverflow rememberedSetOverflow(env);
 
-		addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		if (_isRememberedSetOverflowSummarizedAtTheBeginning) {
+			/* every remembered object is summarized, only the chunks of tenure space holding them are walked */
+			addSummarizedRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+			env->_scavengerStats._rememberedSetOverflowWalksAvoided += 1;
+		} else {
+			addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		}
 
 		/*
 		 * Scan any remembered objects, but don't adjust their remembered bit.
@@ -2904,45 +3260,36 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		omrtty_printf("{SCAV: Prune remembered set overflow}\n");
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 
+		/* The summary covers every remembered object unless the remembered set overflowed without it */
+		MM_RememberedSetSummary *summary = _extensions->rememberedSetSummary;
+		bool pruneSummary = (NULL != summary) && _extensions->isScavengerRememberedSetOverflowSummarized();
+		if (pruneSummary) {
+			summarizeRememberedSetList(env);
+		}
+
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
 
-		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
-		MM_HeapRegionDescriptorStandard *region = NULL;
-		GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
-		while((region = regionIterator.nextRegion()) != NULL) {
-			/* Verify or clear remembered bits for each tenured object currently flagged as remembered */
-			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
-			omrobjectptr_t objectPtr;
-			while((objectPtr = objectIterator.nextObject()) != NULL) {
-				if(_extensions->objectModel.isRemembered(objectPtr)) {
-					/* Check if object still has nursery references, direct or indirect */
-					bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
-
-					/* Unconditionally remember object if it was recently referenced */
-					if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
-						shouldBeRemembered = true;
-					}
+		if (pruneSummary) {
+			pruneRememberedSetSummary(env);
+			env->_scavengerStats._rememberedSetOverflowWalksAvoided += 1;
+		} else {
+			if (NULL != summary) {
+				/* the walk finds every remembered object, summarized or not */
+				summary->reset();
+			}
 
-					if(shouldBeRemembered) {
-						/* Tenured object remains flagged as remembered */
-						/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
-						addToRememberedSetFragment(env, objectPtr);
-					} else {
-						/* Tenured object remembered flags can be cleared */
-						_extensions->objectModel.clearRemembered(objectPtr);
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
-						if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
-							/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-							 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-							 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-							 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-							 */
-							oldToOldReferenceCreated(env, objectPtr);
-						}
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+			/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
+			MM_HeapRegionDescriptorStandard *region = NULL;
+			GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+			while((region = regionIterator.nextRegion()) != NULL) {
+				/* Verify or clear remembered bits for each tenured object currently flagged as remembered */
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+				omrobjectptr_t objectPtr;
+				while((objectPtr = objectIterator.nextObject()) != NULL) {
+					if(_extensions->objectModel.isRemembered(objectPtr)) {
+						pruneRememberedObject(env, objectPtr);
 					}
 				}
 			}
@@ -2963,6 +3310,72 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* Check if object still has nursery references, direct or indirect */
+	bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+	/* Unconditionally remember object if it was recently referenced */
+	if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+		Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		shouldBeRemembered = true;
+	}
+
+	if(shouldBeRemembered) {
+		/* Tenured object remains flagged as remembered */
+		/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
+		addToRememberedSetFragment(env, objectPtr);
+	} else {
+		/* Tenured object remembered flags can be cleared */
+		_extensions->objectModel.clearRemembered(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
+			/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+			 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+			 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+			 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+			 */
+			oldToOldReferenceCreated(env, objectPtr);
+		}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+	}
+}
+
+void
+MM_Scavenger::pruneRememberedSetSummary(MM_EnvironmentStandard *env)
+{
+	MM_RememberedSetSummary *summary = _extensions->rememberedSetSummary;
+	uintptr_t chunkCount = summary->getChunkCount();
+	uintptr_t remainingChunks = summary->getSummarizedChunkCount();
+
+	/* Chunks are removed before they are walked, so objects that remain remembered may be summarized again */
+	summary->invalidateFilters();
+	for (uintptr_t chunk = 0; (0 < remainingChunks) && (chunk < chunkCount); chunk++) {
+		omrobjectptr_t lowestObject = summary->removeChunk(chunk);
+		if (NULL != lowestObject) {
+			omrobjectptr_t chunkTop = summary->getChunkTop(chunk);
+			MM_HeapRegionDescriptorStandard *region = NULL;
+			GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+			while (NULL != (region = regionIterator.nextRegion())) {
+				omrobjectptr_t base = OMR_MAX(lowestObject, (omrobjectptr_t)region->getLowAddress());
+				omrobjectptr_t top = OMR_MIN(chunkTop, (omrobjectptr_t)region->getHighAddress());
+				if (base < top) {
+					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, base, top, false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						if (_extensions->objectModel.isRemembered(objectPtr)) {
+							pruneRememberedObject(env, objectPtr);
+						}
+					}
+				}
+			}
+			env->_scavengerStats._rememberedSetSummaryChunksWalked += 1;
+			remainingChunks -= 1;
+		}
+	}
+}
+
 void
 MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -3088,11 +3501,17 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 			omrobjectptr_t objectPtr = *slotPtr;
 
 			if(NULL != objectPtr) {
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+				bool hasIndirectObjectReferents = _extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr);
+				/* Without a read barrier, mutators must not see the direct refs of remembered objects before they are forwarded,
+				 * so with protected copy destinations every remembered object is scanned here (and the direct refs pass finds none) */
+				if (hasIndirectObjectReferents || (NULL != _pageProtection)) {
 					numElements += 1;
 					Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 					*slotPtr = (omrobjectptr_t)((uintptr_t)objectPtr | DEFERRED_RS_REMOVE_FLAG);
-					bool shouldBeRemembered = _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+					bool shouldBeRemembered = false;
+					if (hasIndirectObjectReferents) {
+						shouldBeRemembered = _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+					}
 					shouldBeRemembered |= scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
 					if (shouldBeRemembered) {
 						/* We want to remember this object after all; clear the flag for removal. */
@@ -3465,8 +3884,14 @@ MM_Scavenger::clearCache(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *
 			if (discardSize < env->getExtensions()->tlhTenureDiscardThreshold) {
 				env->_scavengerStats._tenureDiscardBytes += discardSize;
 				/* Abandon the current entry in the cache */
-				allocSubSpace->abandonHeapChunk(cache->cacheAlloc, cache->cacheTop);
+				abandonCopyChunk(env, allocSubSpace, cache->cacheAlloc, cache->cacheTop);
 			} else {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+				if (isCopyDestinationProtected()) {
+					/* protected chunks are not sized to the object, so the remainder of the previous cache may still be around */
+					abandonTenureTLHRemainder(env, false);
+				}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 				remainderCreated = true;
 				env->_scavengerStats._tenureTLHRemainderCount += 1;
 				Assert_MM_true(NULL == env->_tenureTLHRemainderBase);
@@ -3479,8 +3904,13 @@ MM_Scavenger::clearCache(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *
 			allocSubSpace = _survivorMemorySubSpace;
 			if (discardSize < env->getExtensions()->tlhSurvivorDiscardThreshold) {
 				env->_scavengerStats._flipDiscardBytes += discardSize;
-				allocSubSpace->abandonHeapChunk(cache->cacheAlloc, cache->cacheTop);
+				abandonCopyChunk(env, allocSubSpace, cache->cacheAlloc, cache->cacheTop);
 			} else {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+				if (isCopyDestinationProtected()) {
+					abandonSurvivorTLHRemainder(env);
+				}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 				remainderCreated = true;
 				env->_scavengerStats._survivorTLHRemainderCount += 1;
 				Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
@@ -3513,7 +3943,7 @@ MM_Scavenger::abandonSurvivorTLHRemainder(MM_EnvironmentStandard *env)
 	if (NULL != env->_survivorTLHRemainderBase) {
 		Assert_MM_true(NULL != env->_survivorTLHRemainderTop);
 		env->_scavengerStats._flipDiscardBytes += (uintptr_t)env->_survivorTLHRemainderTop - (uintptr_t)env->_survivorTLHRemainderBase;
-		_survivorMemorySubSpace->abandonHeapChunk(env->_survivorTLHRemainderBase, env->_survivorTLHRemainderTop);
+		abandonCopyChunk(env, _survivorMemorySubSpace, env->_survivorTLHRemainderBase, env->_survivorTLHRemainderTop);
 		env->_survivorTLHRemainderBase = NULL;
 		env->_survivorTLHRemainderTop = NULL;
 	} else {
@@ -3524,9 +3954,14 @@ MM_Scavenger::abandonSurvivorTLHRemainder(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::abandonTenureTLHRemainder(MM_EnvironmentStandard *env, bool preserveRemainders)
 {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* a remainder of a protected chunk is published when abandoned, so it can not be copied into afterwards */
+	preserveRemainders = preserveRemainders && (NULL == _pageProtection);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	if (NULL != env->_tenureTLHRemainderBase) {
 		Assert_MM_true(NULL != env->_tenureTLHRemainderTop);
-		_tenureMemorySubSpace->abandonHeapChunk(env->_tenureTLHRemainderBase, env->_tenureTLHRemainderTop);
+		abandonCopyChunk(env, _tenureMemorySubSpace, env->_tenureTLHRemainderBase, env->_tenureTLHRemainderTop);
 
 		if (!preserveRemainders){
 			env->_scavengerStats._tenureDiscardBytes += (uintptr_t)env->_tenureTLHRemainderTop - (uintptr_t)env->_tenureTLHRemainderBase;
@@ -3543,6 +3978,21 @@ MM_Scavenger::abandonTenureTLHRemainder(MM_EnvironmentStandard *env, bool preser
 	}
 }
 
+void
+MM_Scavenger::abandonCopyChunk(MM_EnvironmentStandard *env, MM_MemorySubSpace *subSpace, void *base, void *top)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (isCopyDestinationProtected() && _pageProtection->isProtected(base)) {
+		/* not recycled to the free list, where a mutator could allocate from the protected pages; the holes complete the pages instead */
+		MM_HeapLinkedFreeHeader::fillWithHoles(toWritableHeap(base), (uintptr_t)top - (uintptr_t)base, _extensions->compressObjectReferences());
+		_pageProtection->publish(base, top);
+	} else
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	{
+		subSpace->abandonHeapChunk(base, top);
+	}
+}
+
 void
 MM_Scavenger::finalReturnCopyCachesToFreeList(MM_EnvironmentStandard *env)
 {
@@ -4105,6 +4555,9 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		_extensions->scavengerRsoScanUnsafe = true;
 
 		if(isRememberedSetInOverflowState()) {
+			/* Objects tenured by this scavenge may have been summarized, so the summary can no longer be trusted */
+			setRememberedSetOverflowState();
+
 			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
 			MM_HeapRegionDescriptor* rootRegion;
 
@@ -4846,6 +5299,11 @@ MM_Scavenger::globalCollectionStart(MM_EnvironmentBase *env)
 
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
+
+	/* Objects may move or die in the global collection, so the remembered set summary can no longer be trusted */
+	if ((NULL != _extensions->rememberedSetSummary) && isRememberedSetInOverflowState()) {
+		setRememberedSetOverflowState();
+	}
 }
 
 void
@@ -5533,13 +5991,20 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 
 		case concurrent_phase_roots:
 		{
+			/* copy destinations are protected from the mutators from the first object copied */
+			if (NULL != _pageProtection) {
+				_pageProtection->activate();
+			}
+
 			/* initialize all the roots */
 			scavengeRoots(env);
 
 			_activeSubSpace->flip(env, MM_MemorySubSpaceSemiSpace::set_allocate);
 
-			/* prepare for the second pass (direct refs) */
-			_extensions->rememberedSet.startProcessingSublist();
+			/* prepare for the second pass (direct refs), which protected copy destinations fold into the first one */
+			if (NULL == _pageProtection) {
+				_extensions->rememberedSet.startProcessingSublist();
+			}
 
 			_concurrentPhase = concurrent_phase_scan;
 
@@ -5559,6 +6024,11 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 			/* This is just for corner cases that must be run in STW mode.
 			 * Default main scan phase is done within mainThreadConcurrentCollect. */
 
+			/* the rest of the cycle runs with the mutators stopped */
+			if (NULL != _pageProtection) {
+				_pageProtection->unprotectAll(env);
+			}
+
 			timeout = scavengeScan(env);
 
 			_concurrentPhase = concurrent_phase_complete;
@@ -5570,6 +6040,11 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 
 		case concurrent_phase_complete:
 		{
+			/* the copies left unscanned by the mutators are scanned (or have been) by the GC threads */
+			if (NULL != _pageProtection) {
+				_pageProtection->unprotectAll(env);
+			}
+
 			scavengeComplete(env);
 
 			result = true;
@@ -5790,6 +6265,97 @@ MM_Scavenger::switchConcurrentForThread(MM_EnvironmentBase *env)
 	}
 }
 
+uintptr_t
+MM_Scavenger::calculateProtectedCopyChunkSize(MM_EnvironmentStandard *env, uintptr_t cacheSize)
+{
+	/* a chunk is protected page by page, the extra page covers the parts trimmed at either end */
+	uintptr_t pageSize = _pageProtection->getPageSize();
+	return MM_Math::roundToCeiling(pageSize, OMR_MAX(cacheSize, calculateOptimumCopyScanCacheSize(env))) + pageSize;
+}
+
+bool
+MM_Scavenger::protectCopyChunk(MM_EnvironmentStandard *env, MM_MemorySubSpace *subSpace, void **addrBase, void **addrTop, uintptr_t minimumSize)
+{
+	uintptr_t pageSize = _pageProtection->getPageSize();
+	void *chunkBase = *addrBase;
+	void *chunkTop = *addrTop;
+	void *pagesBase = (void *)MM_Math::roundToCeiling(pageSize, (uintptr_t)chunkBase);
+	void *pagesTop = (void *)MM_Math::roundToFloor(pageSize, (uintptr_t)chunkTop);
+
+	if ((pagesBase >= pagesTop) || (((uintptr_t)pagesTop - (uintptr_t)pagesBase) < minimumSize)) {
+		subSpace->abandonHeapChunk(chunkBase, chunkTop);
+		return false;
+	}
+
+	/* the parts of the chunk outside its pages share the pages with memory the mutators may use */
+	if (chunkBase < pagesBase) {
+		subSpace->abandonHeapChunk(chunkBase, pagesBase);
+	}
+	if (pagesTop < chunkTop) {
+		subSpace->abandonHeapChunk(pagesTop, chunkTop);
+	}
+
+	_pageProtection->protectChunk(env, pagesBase, pagesTop);
+	*addrBase = pagesBase;
+	*addrTop = pagesTop;
+	return true;
+}
+
+void
+MM_Scavenger::scanProtectedPage(MM_EnvironmentStandard *env, uintptr_t page)
+{
+	void *pageTop = (void *)((uintptr_t)_pageProtection->getPageBase(page) + _pageProtection->getPageSize());
+
+	/* walk the page through the writable view, from the object that contains its base up to the last object starting in it */
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(
+		_extensions,
+		(omrobjectptr_t)toWritableHeap(_pageProtection->getFirstObject(page)),
+		(omrobjectptr_t)toWritableHeap(pageTop), false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObjectNoAdvance())) {
+		objectPtr = (omrobjectptr_t)fromWritableHeap(objectPtr);
+		/* arrays are not split, the whole array has to be scanned before the page is unprotected */
+		if (scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanHeap | GC_ObjectScanner::indexableObjectNoSplit, NULL)) {
+			rememberObject(env, objectPtr);
+		}
+	}
+
+	/* hand the objects copied on the way to the GC threads for scanning, and publish the rest of the copy caches */
+	MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+	threadReleaseCaches(env, env, true, true);
+
+	_pageProtection->finishPage(env, page);
+}
+
+bool
+MM_Scavenger::handlePageProtectionFault(MM_EnvironmentStandard *env, void *address)
+{
+	if ((NULL == _pageProtection) || !_pageProtection->isInHeap(address)) {
+		return false;
+	}
+
+	uintptr_t page = _pageProtection->getPageIndex(address);
+	while (true) {
+		switch (_pageProtection->getPageState(page)) {
+		case MM_ConcurrentScavengerPageProtection::page_unprotected:
+			/* pages are only unprotected with the mutators stopped, so the fault is not the Scavenger's */
+			return false;
+		case MM_ConcurrentScavengerPageProtection::page_scanned:
+			return true;
+		case MM_ConcurrentScavengerPageProtection::page_filled:
+			if (_pageProtection->claimPage(page)) {
+				scanProtectedPage(env, page);
+				return true;
+			}
+			break;
+		default:
+			/* the GC threads publish the page as they copy into it (or another mutator scans it), they never wait for mutators */
+			_pageProtection->waitForPage(page);
+			break;
+		}
+	}
+}
+
 void
 MM_Scavenger::triggerConcurrentScavengerTransition(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
@@ -5842,6 +6408,16 @@ concurrentScavengerAsyncCallbackHandler(OMR_VMThread *omrVMThread)
 	}
 }
 
+bool
+concurrentScavengerPageProtectionFaultHandler(OMR_VMThread *omrVMThread, void *address)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *ext = env->getExtensions();
+
+	/* a mutator touched a copy destination before its objects were scanned, scan them so that the access can be retried */
+	return ext->isConcurrentScavengerPageProtectionEnabled() && ext->scavenger->handlePageProtectionFault(env, address);
+}
+
 } /* extern "C" */
 
 
@@ -39,6 +39,7 @@
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "ConcurrentScavengerPageProtection.hpp"
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
@@ -60,6 +61,14 @@ class MM_SublistPool;
 struct OMR_VM;
 
 extern "C" void concurrentScavengerAsyncCallbackHandler(OMR_VMThread *omrVMThread);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+/**
+ * To be called by the SIGSEGV handler of the runtime for -Xgc:concurrentScavengePageProtection, on the faulting mutator thread.
+ * @param address[in] the address the mutator could not access
+ * @return true if the access can be retried, false if the fault is not the Scavenger's
+ */
+extern "C" bool concurrentScavengerPageProtectionFaultHandler(OMR_VMThread *omrVMThread, void *address);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 /**
  * @todo Provide class documentation
@@ -84,6 +93,7 @@ private:
 
 	const uintptr_t _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	bool _isRememberedSetOverflowSummarizedAtTheBeginning; /**< Cached flag telling the RS Overflow at the beginning of the scavenge was summarized */
 
 	MM_GCExtensionsBase *_extensions;
 	
@@ -148,6 +158,9 @@ private:
 	volatile bool _shouldYield; /**< Set by the first GC thread that observes that a criteria for yielding is met. Reset only when the concurrent phase is finished. */
 
 	MM_ConcurrentPhaseStatsBase _concurrentPhaseStats;
+
+	MM_ConcurrentScavengerPageProtection *_pageProtection; /**< Protection of the copy destinations, NULL unless -Xgc:concurrentScavengePageProtection */
+	uintptr_t _writableHeapDelta; /**< Distance from an address in the heap to the same address in its writable view, 0 unless copy destinations are protected */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 #define IS_CONCURRENT_ENABLED _extensions->isConcurrentScavengerEnabled()
@@ -220,6 +233,78 @@ private:
 	 */	
 	uintptr_t calculateMaxCacheCount(uintptr_t activeMemorySize);
 
+	/**
+	 * @return true if the chunks the Scavenger copies into are protected from the mutators (see MM_ConcurrentScavengerPageProtection)
+	 */
+	MMINLINE bool
+	isCopyDestinationProtected()
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		return (NULL != _pageProtection) && _pageProtection->isActive();
+#else /* OMR_GC_CONCURRENT_SCAVENGER */
+		return false;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	}
+
+	/**
+	 * Objects copied in a cycle protecting copy destinations are only written and scanned through the writable view of the heap.
+	 * @param address[in] an address in the heap (not NULL)
+	 * @return the same address in the writable view, or the address itself unless copy destinations are protected
+	 */
+	MMINLINE void *
+	toWritableHeap(void *address)
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		return (void *)((uintptr_t)address + _writableHeapDelta);
+#else /* OMR_GC_CONCURRENT_SCAVENGER */
+		return address;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	}
+
+	/**
+	 * @param address[in] an address in the writable view of the heap, see toWritableHeap()
+	 * @return the same address in the heap
+	 */
+	MMINLINE void *
+	fromWritableHeap(void *address)
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		return (void *)((uintptr_t)address - _writableHeapDelta);
+#else /* OMR_GC_CONCURRENT_SCAVENGER */
+		return address;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	}
+
+	/**
+	 * Return an unused part of a copy chunk to the subspace, or, if the chunk is protected from the mutators, fill it with
+	 * holes (through the writable view) and publish it.
+	 */
+	void abandonCopyChunk(MM_EnvironmentStandard *env, MM_MemorySubSpace *subSpace, void *base, void *top);
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * @param cacheSize[in] the size the copy cache refreshed from the chunk needs
+	 * @return the size of a chunk to allocate for the copy cache, so that its trimmed pages still hold cacheSize
+	 */
+	uintptr_t calculateProtectedCopyChunkSize(MM_EnvironmentStandard *env, uintptr_t cacheSize);
+
+	/**
+	 * Trim a chunk the Scavenger is about to copy into to whole pages and protect it from the mutators, abandoning the
+	 * parts outside the pages.
+	 * @param subSpace[in] the subspace the chunk was allocated from
+	 * @param addrBase[in/out] base of the chunk
+	 * @param addrTop[in/out] top of the chunk
+	 * @return false if the pages of the chunk are smaller than minimumSize, in which case the whole chunk is abandoned
+	 */
+	bool protectCopyChunk(MM_EnvironmentStandard *env, MM_MemorySubSpace *subSpace, void **addrBase, void **addrTop, uintptr_t minimumSize);
+
+	/**
+	 * Scan the objects of a filled protected page, on behalf of a mutator that faulted on it, and unprotect the page.
+	 * @param page[in] index of a page claimed by the calling thread
+	 */
+	void scanProtectedPage(MM_EnvironmentStandard *env, uintptr_t page);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 public:
 	/**
 	 * Hook callback. Called when a global collect has started
@@ -306,6 +391,13 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/* Copy the hot fields learned for the class of an object (-Xgc:learnHotFields).
+	 * @param forwardedHeader Forwarded header of an object
+	 * @param destinationObjectPtr DestinationObjectPtr of the object described by the forwardedHeader
+	 * @return true if hot fields have been learned for the class of the object
+	 */
+	MMINLINE bool copyLearnedHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -318,6 +410,30 @@ public:
 	 * @return Whether or not objectPtr should be remembered.
 	 */
 	MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
+
+	/**
+	 * Forward the remaining slots of an object scanner a window at a time. The referents of the slots of a window
+	 * are prefetched as the slots are collected and only then forwarded, so the loads of their forwarding headers overlap.
+	 * @param env The environment.
+	 * @param objectScanner The scanner of the object, positioned at the first slot to forward.
+	 * @param windowSize The number of slots to collect before forwarding them, at most MAXIMUM_SCAVENGER_PREFETCH_WINDOW_SIZE.
+	 * @param[out] slotsScanned Incremented by the number of slots forwarded.
+	 * @param[out] slotsCopied Incremented by the number of slots whose referent was copied.
+	 * @return Whether or not any referent is in new space after forwarding.
+	 */
+	MMINLINE bool scavengeObjectSlotsBatched(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t windowSize, uint64_t *slotsScanned, uint64_t *slotsCopied);
+
+	/**
+	 * Forward the remaining slots of an object scanner, sampling the slots whose referent is in evacuate space
+	 * to learn the hot fields of the class of the object (-Xgc:learnHotFields).
+	 * @param env The environment.
+	 * @param objectPtr The pointer to the object.
+	 * @param objectScanner The scanner of the object, positioned at the first slot to forward.
+	 * @param[out] slotsScanned Incremented by the number of slots forwarded.
+	 * @param[out] slotsCopied Incremented by the number of slots whose referent was copied.
+	 * @return Whether or not any referent is in new space after forwarding.
+	 */
+	MMINLINE bool scavengeObjectSlotsSampled(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied);
 	MMINLINE MM_CopyScanCacheStandard *incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache);	
 	
 	/**
@@ -362,6 +478,17 @@ public:
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
+	/**
+	 * Verify a tenured object flagged as remembered, and either keep it remembered or clear its remembered bits.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the remembered object
+	 */
+	void pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	/**
+	 * Prune the summarized remembered objects, walking only the chunks of tenure space the summary covers.
+	 * @param env[in] the main thread
+	 */
+	void pruneRememberedSetSummary(MM_EnvironmentStandard *env);
 
 	/**
 	 * Checks if the  Object should be remembered or not
@@ -533,6 +660,33 @@ public:
 	 */
 	void addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow);
 
+	/*
+	 * Scan the chunks of Tenure covered by the remembered set summary and add all found Remembered objects to Overflow
+	 * @param env - Environment
+	 * @param overflow - pointer to RS Overflow
+	 */
+	void addSummarizedRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow);
+
+	/**
+	 * Add a remembered object to the remembered set summary rather than the remembered set list.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the remembered object
+	 */
+	void summarizeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Move every object of the remembered set list to the remembered set summary, and clear the list.
+	 * @param env[in] the main thread
+	 */
+	void summarizeRememberedSetList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Give the thread a new remembered set fragment, without overflowing the remembered set if it can not grow.
+	 * @param env[in] the current thread
+	 * @return true if the thread has a new fragment
+	 */
+	bool allocateRememberedSetFragment(MM_EnvironmentStandard *env);
+
 	void clearRememberedSetLists(MM_EnvironmentStandard *env);
 
 	MMINLINE bool isRememberedSetInOverflowState() { return _extensions->isScavengerRememberedSetInOverflowState(); }
@@ -802,6 +956,14 @@ public:
 	 * Enabled/disable approriate thread local resources when starting or finishing Concurrent Scavenger Cycle
 	 */ 
 	void switchConcurrentForThread(MM_EnvironmentBase *env);	
+
+	/**
+	 * Called from the fault handler of a mutator that accessed an address it could not, to scan the page of the
+	 * address if it is a protected copy destination (see MM_ConcurrentScavengerPageProtection).
+	 * @param address[in] the address the mutator faulted on
+	 * @return true if the page is now accessible and the access can be retried, false if the fault is not the Scavenger's
+	 */
+	bool handlePageProtectionFault(MM_EnvironmentStandard *env, void *address);
 	
 	void reportConcurrentScavengeStart(MM_EnvironmentStandard *env);
 	void reportConcurrentScavengeEnd(MM_EnvironmentStandard *env);
@@ -931,6 +1093,7 @@ public:
 		, _delegate(env)
 		, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 		, _isRememberedSetInOverflowAtTheBeginning(false)
+		, _isRememberedSetOverflowSummarizedAtTheBeginning(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _doneIndex(0)
@@ -973,6 +1136,8 @@ public:
 		, _concurrentScavengerSwitchCount(0)
 		, _shouldYield(false)
 		, _concurrentPhaseStats(OMR_GC_CYCLE_TYPE_SCAVENGE)
+		, _pageProtection(NULL)
+		, _writableHeapDelta(0)
 #endif /* #if defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 		, _omrVM(env->getOmrVM())
@@ -28,6 +28,7 @@
 
 #include "Debug.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
 #include "OverflowStandard.hpp"
 
 /**
@@ -169,6 +170,55 @@ MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	_fullPacketList.push(env, packet);
 }
 
+uintptr_t
+MM_WorkPacketsSATB::getBarrierPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count)
+{
+	uintptr_t taken = _emptyPacketList.pop(env, packets, count);
+
+	if (0 == taken) {
+		packets[0] = getBarrierPacket(env);
+		if (NULL != packets[0]) {
+			taken = 1;
+		}
+	}
+	if (0 != taken) {
+		_inUseBarrierPacketList.push(env, packets, taken);
+	}
+
+	return taken;
+}
+
+void
+MM_WorkPacketsSATB::putFullPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count)
+{
+	_inUseBarrierPacketList.remove(packets, count);
+	_fullPacketList.push(env, packets, count);
+}
+
+void
+MM_WorkPacketsSATB::filterBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet, MM_MarkingScheme *markingScheme, uintptr_t *nullCount, uintptr_t *markedCount)
+{
+	uintptr_t *keep = packet->_basePtr;
+	uintptr_t nulls = 0;
+	uintptr_t marked = 0;
+
+	for (uintptr_t *slot = packet->_basePtr; slot < packet->_currentPtr; slot++) {
+		omrobjectptr_t object = (omrobjectptr_t)*slot;
+		if (NULL == object) {
+			nulls += 1;
+		} else if (markingScheme->isMarked(object)) {
+			marked += 1;
+		} else {
+			*keep = (uintptr_t)object;
+			keep += 1;
+		}
+	}
+	packet->_currentPtr = keep;
+
+	*nullCount = nulls;
+	*markedCount = marked;
+}
+
 /**
  * Move all of the packets from the inUse list to the processing list
  * so they are available for processing.
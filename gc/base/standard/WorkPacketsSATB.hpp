@@ -30,6 +30,7 @@
 #include "WorkPackets.hpp"
 
 class MM_IncrementalOverflow;
+class MM_MarkingScheme;
 
 class MM_WorkPacketsSATB : public MM_WorkPackets
 {
@@ -55,6 +56,27 @@ public:
 	virtual void removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet *packet);
 	virtual void putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 
+	/**
+	 * Take up to count empty packets for barrier processing and put them on the inUseBarrierPacket list, with one
+	 * acquisition of each list lock. Falls back to getBarrierPacket() for a single packet when none is empty.
+	 * @param packets[out] the packets taken
+	 * @return the number of packets taken
+	 */
+	uintptr_t getBarrierPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count);
+
+	/**
+	 * Move filled barrier packets from the inUseBarrierPacket list to the full list, with one acquisition of each
+	 * list lock.
+	 */
+	void putFullPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count);
+
+	/**
+	 * Drop the NULL and already marked entries of a filled barrier packet, packing the rest at its bottom.
+	 * @param nullCount[out] the NULL entries dropped
+	 * @param markedCount[out] the marked entries dropped
+	 */
+	void filterBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet, MM_MarkingScheme *markingScheme, uintptr_t *nullCount, uintptr_t *markedCount);
+
 	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
 
 	void resetAllPackets(MM_EnvironmentBase *env);
@@ -43,6 +43,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "TLHZeroing.hpp"
 #include "VerboseManager.hpp"
 
 /* ****************
@@ -222,6 +223,16 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 		rc = OMR_ERROR_INTERNAL;
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if ((OMR_ERROR_NONE == rc) && extensions->backgroundTLHZeroing && (0 != extensions->batchClearTLH)) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		extensions->tlhZeroing = MM_TLHZeroing::newInstance(env);
+		if ((NULL == extensions->tlhZeroing) || !extensions->tlhZeroing->startup(env)) {
+			rc = OMR_ERROR_INTERNAL;
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	return rc;
 }
 
@@ -231,6 +242,13 @@ OMR_GC_ShutdownDispatcherThreads(OMR_VMThread* omrVMThread)
 	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
 	omr_error_t rc = OMR_ERROR_NONE;
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	/* the zeroing requests threads still have queued are claimed back when their caches are flushed or torn down */
+	if (NULL != extensions->tlhZeroing) {
+		extensions->tlhZeroing->shutdown(MM_EnvironmentBase::getEnvironment(omrVMThread));
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	if (NULL != extensions->dispatcher) {
 		extensions->dispatcher->shutDownThreads();
 		extensions->dispatcher->kill(MM_EnvironmentBase::getEnvironment(omrVMThread));
@@ -47,6 +47,12 @@ MM_AllocationStats::clear()
 	_discardedBytes = 0;
 	_allocationSearchCount = 0;
 	_allocationSearchCountMax = 0;
+	_freeChunkCacheHits = 0;
+	_freeChunkCacheRefills = 0;
+	_allocationLatencyCount = 0;
+	for (uintptr_t bucket = 0; bucket < ALLOCATION_LATENCY_BUCKETS; bucket++) {
+		_allocationLatencyHistogram[bucket] = 0;
+	}
 }
 
 void
@@ -87,4 +93,31 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_allocationSearchCountMax, prevMax, stats->_allocationSearchCountMax);
 	}
+	MM_AtomicOperations::add(&_freeChunkCacheHits, stats->_freeChunkCacheHits);
+	MM_AtomicOperations::add(&_freeChunkCacheRefills, stats->_freeChunkCacheRefills);
+	if (0 != stats->_allocationLatencyCount) {
+		MM_AtomicOperations::add(&_allocationLatencyCount, stats->_allocationLatencyCount);
+		for (uintptr_t bucket = 0; bucket < ALLOCATION_LATENCY_BUCKETS; bucket++) {
+			if (0 != stats->_allocationLatencyHistogram[bucket]) {
+				MM_AtomicOperations::add(&_allocationLatencyHistogram[bucket], stats->_allocationLatencyHistogram[bucket]);
+			}
+		}
+	}
+}
+
+double
+MM_AllocationStats::getAllocationLatencyPercentile(double fraction)
+{
+	double rank = fraction * (double)_allocationLatencyCount;
+	double countBelow = 0.0;
+	for (uintptr_t bucket = 0; bucket < ALLOCATION_LATENCY_BUCKETS; bucket++) {
+		double count = (double)_allocationLatencyHistogram[bucket];
+		if ((0.0 != count) && ((countBelow + count) >= rank)) {
+			double low = (0 == bucket) ? 0.0 : (double)((uint64_t)1 << bucket);
+			double high = (double)((uint64_t)1 << (bucket + 1));
+			return low + ((high - low) * (rank - countBelow) / count);
+		}
+		countBelow += count;
+	}
+	return 0.0;
 }
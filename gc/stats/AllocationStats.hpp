@@ -26,8 +26,13 @@
 #include "omrcfg.h"
 #include "omrcomp.h"
 
+#include "modronbase.h"
+
 #include "Base.hpp"
 
+/* Non-TLH allocation latencies are counted in buckets of powers of two hires clock ticks */
+#define ALLOCATION_LATENCY_BUCKETS 40
+
 class MM_AllocationStats : public MM_Base
 {
 private:
@@ -54,12 +59,33 @@ public:
 	uintptr_t _discardedBytes;
 	uintptr_t _allocationSearchCount;
 	uintptr_t _allocationSearchCountMax;
+	uintptr_t _freeChunkCacheHits; /**< Number of non-TLH allocations satisfied from the thread's free chunk cache */
+	uintptr_t _freeChunkCacheRefills; /**< Number of batches of free chunks taken from memory pools */
+	uintptr_t _allocationLatencyCount; /**< Number of non-TLH allocations timed with -Xgc:allocationLatencyStats */
+	uintptr_t _allocationLatencyHistogram[ALLOCATION_LATENCY_BUCKETS]; /**< Timed allocations whose latency in ticks is in [2^i, 2^(i+1)), or below 2 for bucket 0 */
 
 	void clear();
 	void clearOwnableSynchronizer() { _ownableSynchronizerObjectCount = 0; }
 	void clearContinuation() { _continuationObjectCount = 0; }
 	void merge(MM_AllocationStats * stats);
 
+	MMINLINE void
+	recordAllocationLatency(uint64_t ticks)
+	{
+		uintptr_t bucket = 0;
+		for (ticks >>= 1; (0 != ticks) && (bucket < (ALLOCATION_LATENCY_BUCKETS - 1)); ticks >>= 1) {
+			bucket += 1;
+		}
+		_allocationLatencyHistogram[bucket] += 1;
+		_allocationLatencyCount += 1;
+	}
+
+	/**
+	 * @param fraction[in] the fraction of timed allocations, 0.5 for the median
+	 * @return the latency, in hires clock ticks, of that fraction of the timed allocations, interpolated within its bucket
+	 */
+	double getAllocationLatencyPercentile(double fraction);
+
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
@@ -105,8 +131,15 @@ public:
 		_continuationObjectCount(0),
 		_discardedBytes(0),
 		_allocationSearchCount(0),
-		_allocationSearchCountMax(0)
-	{}
+		_allocationSearchCountMax(0),
+		_freeChunkCacheHits(0),
+		_freeChunkCacheRefills(0),
+		_allocationLatencyCount(0)
+	{
+		for (uintptr_t bucket = 0; bucket < ALLOCATION_LATENCY_BUCKETS; bucket++) {
+			_allocationLatencyHistogram[bucket] = 0;
+		}
+	}
 };
 
 #endif /* ALLOCATIONSTATS_HPP_ */
@@ -32,6 +32,9 @@ MM_CardCleaningStats::clear()
 {
 	_cardCleaningTime = 0;
 	_cardsCleaned = 0;
+	_cardsScanned = 0;
+	_cardGroupsSkipped = 0;
+	_cardPartitionsCleaned = 0;
 }
 
 void
@@ -39,4 +42,7 @@ MM_CardCleaningStats::merge(MM_CardCleaningStats *statsToMerge)
 {
 	_cardCleaningTime += statsToMerge->_cardCleaningTime;
 	_cardsCleaned += statsToMerge->_cardsCleaned;
+	_cardsScanned += statsToMerge->_cardsScanned;
+	_cardGroupsSkipped += statsToMerge->_cardGroupsSkipped;
+	_cardPartitionsCleaned += statsToMerge->_cardPartitionsCleaned;
 }
@@ -34,6 +34,9 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardsScanned; /**< The number of cards looked at while searching for cards to clean */
+	uintptr_t _cardGroupsSkipped; /**< The number of groups of cards skipped as the card table summary shows none of them was dirtied */
+	uintptr_t _cardPartitionsCleaned; /**< The number of partitions of the card table claimed for cleaning */
 	
 /* Function Members */
 public:
@@ -40,6 +40,8 @@ MM_CompactStats::clear()
 	_movedBytes = 0;
 	
 	_fixupObjects = 0;
+	_subAreas = 0;
+	_evacuatedSubAreas = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
 	_moveStartTime = 0;
@@ -56,6 +58,8 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	_subAreas += statsToMerge->_subAreas;
+	_evacuatedSubAreas += statsToMerge->_evacuatedSubAreas;
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
@@ -50,6 +50,8 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _subAreas; /**< Sub areas of a partial compaction, 0 for a full one */
+	uintptr_t _evacuatedSubAreas; /**< Sub areas a partial compaction selected for evacuation */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
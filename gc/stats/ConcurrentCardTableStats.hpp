@@ -28,6 +28,7 @@
 
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
+#include "CardCleaningStats.hpp"
 
 #define HIGH_VALUES (uintptr_t)(-1)
 /**
@@ -49,6 +50,12 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	/* Final card cleaning stats merged from the MM_CardCleaningStats of the threads cleaning cards */
+	volatile uintptr_t finalCardsScanned;
+	volatile uintptr_t finalCardGroupsSkipped;
+	volatile uintptr_t finalCardPartitionsCleaned;
+	volatile uint64_t finalCardCleaningTime; /**< Sum over the threads of the time spent cleaning cards, in hi-res clock resolution */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +82,10 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+		setCount(finalCardsScanned, 0);
+		setCount(finalCardGroupsSkipped, 0);
+		setCount(finalCardPartitionsCleaned, 0);
+		MM_AtomicOperations::setU64(&finalCardCleaningTime, 0);
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -118,6 +129,23 @@ public:
 	{
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
+
+	MMINLINE uintptr_t getFinalCardsScanned() { return finalCardsScanned; };
+	MMINLINE uintptr_t getFinalCardGroupsSkipped() { return finalCardGroupsSkipped; };
+	MMINLINE uintptr_t getFinalCardPartitionsCleaned() { return finalCardPartitionsCleaned; };
+	MMINLINE uint64_t getFinalCardCleaningTime() { return finalCardCleaningTime; };
+
+	/**
+	 * Add the final card cleaning stats of a thread.
+	 * @param[in] stats The stats of a thread which took part in final card cleaning
+	 */
+	MMINLINE void mergeFinalCardCleaningStats(MM_CardCleaningStats *stats)
+	{
+		incrementCount(finalCardsScanned, stats->_cardsScanned);
+		incrementCount(finalCardGroupsSkipped, stats->_cardGroupsSkipped);
+		incrementCount(finalCardPartitionsCleaned, stats->_cardPartitionsCleaned);
+		MM_AtomicOperations::addU64(&finalCardCleaningTime, stats->_cardCleaningTime);
+	};
 	
 	/**
 	 * Create a CardTableStats object.
@@ -129,7 +157,11 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		finalCardsScanned(0),
+		finalCardGroupsSkipped(0),
+		finalCardPartitionsCleaned(0),
+		finalCardCleaningTime(0)
 	{};
 };
 
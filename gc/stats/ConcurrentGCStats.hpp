@@ -31,6 +31,7 @@
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
 
+class MM_ConcurrentPacer;
 class MM_EnvironmentBase;
 
 /**
@@ -67,6 +68,13 @@ class MM_ConcurrentGCStats : public MM_Base
 	volatile uintptr_t _RSObjectsFound;
 	volatile uintptr_t _threadsScannedCount;
 	uintptr_t _threadsToScanCount;
+	volatile uintptr_t _sATBPacketFlushCount; /**< Hand offs of filled SATB barrier packets to the full list */
+	volatile uintptr_t _sATBPacketsFlushed; /**< Filled SATB barrier packets handed to the full list */
+	volatile uintptr_t _sATBEntriesKept; /**< Entries of filtered SATB barrier packets left for marking */
+	volatile uintptr_t _sATBNullEntriesFiltered; /**< NULL entries dropped from SATB barrier packets */
+	volatile uintptr_t _sATBMarkedEntriesFiltered; /**< Already marked entries dropped from SATB barrier packets */
+	volatile uintptr_t _conHelperCPUTime; /**< CPU time in microseconds concurrent helpers charged to their -Xgc:concurrentBackgroundCPUPercent budget */
+	volatile uintptr_t _conHelperThrottleCount; /**< Times a concurrent helper waited for being over its CPU budget */
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
@@ -76,6 +84,8 @@ class MM_ConcurrentGCStats : public MM_Base
 	ConcurrentKickoffReason _kickoffReason; /**< a constant indicating why kickoff occured */
 	ConcurrentCardCleaningReason _cardCleaningReason; /**< a constant indicating why card cleaning was kicked off */
 	
+	MM_ConcurrentPacer *_pacer; /**< Controller of the kickoff threshold and allocation tax, NULL unless -Xgc:concurrentPacer is set */
+	
 public:
 	static const char* getConcurrentStatusString(MM_EnvironmentBase *env, uintptr_t status, char *statusBuffer, uintptr_t statusBufferLength);
 	MMINLINE uintptr_t  getExecutionMode() { return _executionMode; };
@@ -201,6 +211,48 @@ public:
 	MMINLINE uintptr_t getThreadsToScanCount() { return _threadsToScanCount; };
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
 	MMINLINE uintptr_t getThreadsScannedCount() { return _threadsScannedCount; };
+
+	MMINLINE void incSATBPacketsFlushed(uintptr_t packets)
+	{
+		incrementCount((uintptr_t *)&_sATBPacketFlushCount, 1);
+		incrementCount((uintptr_t *)&_sATBPacketsFlushed, packets);
+	}
+	MMINLINE void incSATBEntriesFiltered(uintptr_t kept, uintptr_t nullEntries, uintptr_t markedEntries)
+	{
+		incrementCount((uintptr_t *)&_sATBEntriesKept, kept);
+		incrementCount((uintptr_t *)&_sATBNullEntriesFiltered, nullEntries);
+		incrementCount((uintptr_t *)&_sATBMarkedEntriesFiltered, markedEntries);
+	}
+	MMINLINE uintptr_t getSATBPacketFlushCount() { return _sATBPacketFlushCount; };
+	MMINLINE uintptr_t getSATBPacketsFlushed() { return _sATBPacketsFlushed; };
+	MMINLINE uintptr_t getSATBEntriesKept() { return _sATBEntriesKept; };
+	MMINLINE uintptr_t getSATBNullEntriesFiltered() { return _sATBNullEntriesFiltered; };
+	MMINLINE uintptr_t getSATBMarkedEntriesFiltered() { return _sATBMarkedEntriesFiltered; };
+
+	MMINLINE void incConHelperCPUTime(uintptr_t micros) { incrementCount((uintptr_t *)&_conHelperCPUTime, micros); };
+	MMINLINE void incConHelperThrottleCount() { incrementCount((uintptr_t *)&_conHelperThrottleCount, 1); };
+	MMINLINE uintptr_t getConHelperCPUTime() { return _conHelperCPUTime; };
+	MMINLINE uintptr_t getConHelperThrottleCount() { return _conHelperThrottleCount; };
+
+	/**
+	 * @return the fraction of the entries of filtered SATB barrier packets which were dropped, 0 if none were filtered
+	 */
+	MMINLINE double
+	getSATBFilterRatio()
+	{
+		uintptr_t filtered = _sATBNullEntriesFiltered + _sATBMarkedEntriesFiltered;
+		uintptr_t total = filtered + _sATBEntriesKept;
+		return (0 == total) ? 0.0 : ((double)filtered / (double)total);
+	}
+
+	/**
+	 * @return the average number of SATB barrier packets handed to the full list per hand off, 0 if there were none
+	 */
+	MMINLINE double
+	getSATBPacketsPerFlush()
+	{
+		return (0 == _sATBPacketFlushCount) ? 0.0 : ((double)_sATBPacketsFlushed / (double)_sATBPacketFlushCount);
+	}
 	
 	MMINLINE bool isRootTracingComplete() { return (_completedModes & CONCURRENT_ROOT_TRACING) == CONCURRENT_ROOT_TRACING; };
 	MMINLINE void setModeComplete(ConcurrentStatus mode) {
@@ -214,6 +266,9 @@ public:
 	MMINLINE void setCardCleaningReason(ConcurrentCardCleaningReason reason) { _cardCleaningReason = reason; };
 	MMINLINE ConcurrentCardCleaningReason getCardCleaningReason() { return _cardCleaningReason; };
 	
+	MMINLINE MM_ConcurrentPacer *getPacer() { return _pacer; };
+	MMINLINE void setPacer(MM_ConcurrentPacer *pacer) { _pacer = pacer; };
+	
 	MMINLINE void reset()
 	{
 		clearCount((uintptr_t *)&_traceSizeCount);
@@ -227,6 +282,13 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		clearCount((uintptr_t *)&_sATBPacketFlushCount);
+		clearCount((uintptr_t *)&_sATBPacketsFlushed);
+		clearCount((uintptr_t *)&_sATBEntriesKept);
+		clearCount((uintptr_t *)&_sATBNullEntriesFiltered);
+		clearCount((uintptr_t *)&_sATBMarkedEntriesFiltered);
+		clearCount((uintptr_t *)&_conHelperCPUTime);
+		clearCount((uintptr_t *)&_conHelperThrottleCount);
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -260,11 +322,19 @@ public:
 		_RSObjectsFound(0),
 		_threadsScannedCount(0),
 		_threadsToScanCount(0),
+		_sATBPacketFlushCount(0),
+		_sATBPacketsFlushed(0),
+		_sATBEntriesKept(0),
+		_sATBNullEntriesFiltered(0),
+		_sATBMarkedEntriesFiltered(0),
+		_conHelperCPUTime(0),
+		_conHelperThrottleCount(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
 		_kickoffReason(NO_KICKOFF_REASON),
-		_cardCleaningReason(CARD_CLEANING_REASON_NONE)
+		_cardCleaningReason(CARD_CLEANING_REASON_NONE),
+		_pacer(NULL)
 	{}
 
 };
@@ -32,6 +32,7 @@
 #endif /* OMR_GC_MODRON_COMPACTION */
 #include "MarkStats.hpp"
 #include "MetronomeStats.hpp"
+#include "NUMAWorkStats.hpp"
 #include "SweepStats.hpp"
 #include "WorkPacketStats.hpp"
 
@@ -43,6 +44,7 @@ class MM_GlobalGCStats {
 public:
 	uintptr_t gcCount; /**< Count of the number of GC cycles that have occurred */
 	MM_WorkPacketStats workPacketStats;
+	MM_NUMAWorkStats numaWorkStats; /**< workPacketStats broken down by the NUMA node of the contributing GC worker */
 	MM_SweepStats sweepStats;
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactStats compactStats;
@@ -61,6 +63,7 @@ public:
 		/* gcCount is not cleared as the value must persist across cycles */
 
 		workPacketStats.clear();
+		numaWorkStats.clear();
 		sweepStats.clear();
 #if defined(OMR_GC_MODRON_COMPACTION)
 		compactStats.clear();
@@ -88,6 +91,7 @@ public:
 	MM_GlobalGCStats() :
 		gcCount(0),
 		workPacketStats(),
+		numaWorkStats(),
 		sweepStats(),
 #if defined(OMR_GC_MODRON_COMPACTION)
 		compactStats(),
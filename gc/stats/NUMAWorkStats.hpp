@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(NUMAWORKSTATS_HPP_)
+#define NUMAWORKSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "WorkPacketStats.hpp"
+
+/**
+ * The highest NUMA node for which per-node work statistics are kept. Workers on higher nodes are folded into this one.
+ */
+#define NUMA_WORK_STATS_MAX_NODE 64
+
+/**
+ * Per NUMA node totals of the work packet statistics of the GC workers bound to each node.
+ * Only populated when GC workers are NUMA bound (-Xgc:numaAffinity).
+ * @ingroup GC_Stats
+ */
+class MM_NUMAWorkStats
+{
+public:
+	/**
+	 * Work packet totals for the workers of one node.
+	 */
+	struct NodeStats {
+		uintptr_t workerCount; /**< The number of workers of this node that took part in the operation */
+		uintptr_t packetsAcquired; /**< Input packets acquired by workers of this node */
+		uintptr_t packetsStolen; /**< Packets stolen by workers of this node, from any node */
+		uintptr_t packetsStolenRemote; /**< Packets stolen by workers of this node from workers of another node */
+		uintptr_t stealFailures; /**< Times workers of this node probed every deque without finding a packet */
+	};
+
+	uintptr_t _highestNode; /**< The highest node that has contributed statistics since the last clear, 0 if none */
+	NodeStats _nodes[NUMA_WORK_STATS_MAX_NODE + 1]; /**< Indexed by 1-based node, entry 0 is unused */
+
+public:
+	void clear()
+	{
+		_highestNode = 0;
+		for (uintptr_t i = 0; i <= NUMA_WORK_STATS_MAX_NODE; i++) {
+			_nodes[i].workerCount = 0;
+			_nodes[i].packetsAcquired = 0;
+			_nodes[i].packetsStolen = 0;
+			_nodes[i].packetsStolenRemote = 0;
+			_nodes[i].stealFailures = 0;
+		}
+	}
+
+	/**
+	 * Add a worker's work packet statistics to the totals of its node. Safe to call from several workers concurrently.
+	 * @param node[in] the 1-based NUMA node of the worker, 0 if the worker is not NUMA bound (ignored)
+	 * @param statsToMerge[in] the worker's statistics
+	 */
+	void merge(uintptr_t node, MM_WorkPacketStats *statsToMerge)
+	{
+		if (0 == node) {
+			return;
+		}
+		node = OMR_MIN(node, (uintptr_t)NUMA_WORK_STATS_MAX_NODE);
+
+		NodeStats *nodeStats = &_nodes[node];
+		MM_AtomicOperations::add(&nodeStats->workerCount, 1);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		MM_AtomicOperations::add(&nodeStats->packetsAcquired, statsToMerge->workPacketsAcquired);
+		MM_AtomicOperations::add(&nodeStats->packetsStolen, statsToMerge->workPacketsStolen);
+		MM_AtomicOperations::add(&nodeStats->packetsStolenRemote, statsToMerge->workPacketsStolenRemote);
+		MM_AtomicOperations::add(&nodeStats->stealFailures, statsToMerge->workPacketStealFailures);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		uintptr_t highestNode = _highestNode;
+		while ((node > highestNode) && (highestNode != MM_AtomicOperations::lockCompareExchange(&_highestNode, highestNode, node))) {
+			highestNode = _highestNode;
+		}
+	}
+
+	MM_NUMAWorkStats()
+		: _highestNode(0)
+	{
+		clear();
+	}
+};
+
+#endif /* NUMAWORKSTATS_HPP_ */
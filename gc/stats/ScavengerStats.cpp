@@ -93,6 +93,21 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
+	,_prefetchedForwarded(0)
+	,_prefetchedCopied(0)
+	,_hotFieldSamples(0)
+	,_learnedHotFieldClasses(0)
+	,_learnedHotFieldClassesUpdated(0)
+	,_rememberedSetSize(0)
+	,_rememberedSetSummaryChunks(0)
+	,_rememberedSetSummarizedObjects(0)
+	,_rememberedSetSummaryFilterHits(0)
+	,_rememberedSetSummaryChunksWalked(0)
+	,_rememberedSetOverflowWalksAvoided(0)
+	,_pretenureSamples(0)
+	,_pretenureProfiledSites(0)
+	,_pretenuredSites(0)
+	,_pretenuredSitesAdded(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
@@ -208,6 +223,21 @@ MM_ScavengerStats::clear(bool firstIncrement)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	_leafObjectCount = 0;
+	_prefetchedForwarded = 0;
+	_prefetchedCopied = 0;
+	_hotFieldSamples = 0;
+	_learnedHotFieldClasses = 0;
+	_learnedHotFieldClassesUpdated = 0;
+	_rememberedSetSize = 0;
+	_rememberedSetSummaryChunks = 0;
+	_rememberedSetSummarizedObjects = 0;
+	_rememberedSetSummaryFilterHits = 0;
+	_rememberedSetSummaryChunksWalked = 0;
+	_rememberedSetOverflowWalksAvoided = 0;
+	_pretenureSamples = 0;
+	_pretenureProfiledSites = 0;
+	_pretenuredSites = 0;
+	_pretenuredSitesAdded = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
@@ -148,6 +148,21 @@ public:
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
+	uint64_t _prefetchedForwarded; /**< Slots scanned through the prefetch window whose referent was already forwarded when its slot was forwarded, so the prefetched header was all that was read */
+	uint64_t _prefetchedCopied; /**< Slots scanned through the prefetch window whose referent was not forwarded yet when its slot was forwarded. It is copied through this slot unless another thread wins the copy or the copy fails */
+	uint64_t _hotFieldSamples; /**< Slots sampled for learning hot fields (-Xgc:learnHotFields) */
+	uintptr_t _learnedHotFieldClasses; /**< Classes with learned hot fields at the end of the scavenge */
+	uintptr_t _learnedHotFieldClassesUpdated; /**< Classes whose learned hot fields changed at the end of the scavenge */
+	uintptr_t _rememberedSetSize; /**< Objects in the remembered set list at the end of the scavenge */
+	uintptr_t _rememberedSetSummaryChunks; /**< Chunks of the remembered set summary holding objects at the end of the scavenge */
+	uintptr_t _rememberedSetSummarizedObjects; /**< Remembered objects summarized instead of added to the remembered set list */
+	uintptr_t _rememberedSetSummaryFilterHits; /**< Summarized objects the thread's summary filter showed were already covered */
+	uintptr_t _rememberedSetSummaryChunksWalked; /**< Summary chunks walked to find remembered objects */
+	uintptr_t _rememberedSetOverflowWalksAvoided; /**< Remembered set overflow scans and prunes that walked the summary instead of all of tenure space */
+	uintptr_t _pretenureSamples; /**< Tenured objects sampled for the survival of their allocation site (-Xgc:pretenureSurvivalThreshold=) */
+	uintptr_t _pretenureProfiledSites; /**< Allocation sites profiled at the end of the scavenge */
+	uintptr_t _pretenuredSites; /**< Allocation sites allocated in tenure space at the end of the scavenge */
+	uintptr_t _pretenuredSitesAdded; /**< Allocation sites that started to be allocated in tenure space at the end of the scavenge */
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
@@ -47,6 +47,9 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workPacketsStolen; /**< The number of packets taken from another thread's work stealing deque */
+	uintptr_t workPacketsStolenRemote; /**< The number of stolen packets that were taken from a thread bound to another NUMA node */
+	uintptr_t workPacketStealFailures; /**< The number of times every other work stealing deque was probed without finding a packet */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -73,6 +76,9 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketsStolen = 0;
+		workPacketsStolenRemote = 0;
+		workPacketStealFailures = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +97,9 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketsStolen += statsToMerge->workPacketsStolen;
+		workPacketsStolenRemote += statsToMerge->workPacketsStolenRemote;
+		workPacketStealFailures += statsToMerge->workPacketStealFailures;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +156,9 @@ public:
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,workPacketsStolen(0)
+		,workPacketsStolenRemote(0)
+		,workPacketStealFailures(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
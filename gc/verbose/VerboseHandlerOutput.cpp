@@ -30,6 +30,7 @@
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "ParallelDispatcher.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
@@ -864,6 +865,41 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		}
 		writer->formatAndOutput(env, 1, "<largest-consumer threadName=\"%s%s\" threadId=\"%p\" bytes=\"%zu\" />", escapedThreadName, dots, threadID, _extensions->bytesAllocatedMost);
 	}
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (_extensions->verboseTLHStats) {
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		OMR_VMThread *walkThread = NULL;
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+			uintptr_t refreshCount = 0;
+			uintptr_t refreshBytes = 0;
+			uintptr_t discardedBytes = 0;
+			uintptr_t refreshSize = 0;
+			if ((NULL != walkEnv->_objectAllocationInterface)
+				&& walkEnv->_objectAllocationInterface->getTLHRefreshStats(&refreshCount, &refreshBytes, &discardedBytes, &refreshSize)
+				&& (0 != refreshCount)
+			) {
+				char escapedThreadName[128];
+				consumedEntireThreadName = getThreadName(escapedThreadName, sizeof(escapedThreadName), walkThread);
+				writer->formatAndOutput(env, 1, "<tlh-refreshes threadName=\"%s%s\" threadId=\"%p\" count=\"%zu\" averageSize=\"%zu\" discardedBytes=\"%zu\" refreshSize=\"%zu\" />",
+						escapedThreadName, consumedEntireThreadName ? "" : "...", walkThread->_language_vmthread,
+						refreshCount, refreshBytes / refreshCount, discardedBytes, refreshSize);
+			}
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	if (_extensions->freeChunkCache) {
+		writer->formatAndOutput(env, 1, "<free-chunk-cache hits=\"%zu\" refills=\"%zu\" />", systemStats->_freeChunkCacheHits, systemStats->_freeChunkCacheRefills);
+	}
+	if (0 != systemStats->_allocationLatencyCount) {
+		double nanosPerTick = 1000000000.0 / (double)omrtime_hires_frequency();
+		writer->formatAndOutput(env, 1, "<allocation-latency count=\"%zu\" p50=\"%.0f\" p90=\"%.0f\" p99=\"%.0f\" p999=\"%.0f\" units=\"ns\" />",
+				systemStats->_allocationLatencyCount,
+				systemStats->getAllocationLatencyPercentile(0.5) * nanosPerTick,
+				systemStats->getAllocationLatencyPercentile(0.9) * nanosPerTick,
+				systemStats->getAllocationLatencyPercentile(0.99) * nanosPerTick,
+				systemStats->getAllocationLatencyPercentile(0.999) * nanosPerTick);
+	}
 	writer->formatAndOutput(env, 0, "</allocation-stats>");
 	writer->flush(env);
 	exitAtomicReportingBlock();
@@ -890,6 +926,27 @@ MM_VerboseHandlerOutput::handleGCStart(J9HookInterface** hook, uintptr_t eventNu
 	printAllocationStats(env);
 }
 
+void
+MM_VerboseHandlerOutput::outputTaskThreadingInfo(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+	if (extensions->adaptiveTaskThreading) {
+		MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+		for (uintptr_t type = 0; type < MM_ParallelDispatcher::task_threading_count; type++) {
+			MM_ParallelDispatcher::TaskThreadingHistory *history = dispatcher->getTaskThreadingHistory(type);
+			if (0 != history->samples) {
+				writer->formatAndOutput(env, indent, "<task-threads type=\"%s\" threads=\"%zu\" recommended=\"%zu\" samples=\"%zu\" wallms=\"%llu.%03llu\" cputimems=\"%llu.%03llu\" stalltimems=\"%llu.%03llu\" />",
+						MM_ParallelDispatcher::getTaskThreadingTypeName(type), history->lastThreadCount, history->recommendedThreadCount, history->samples,
+						history->wallTime / 1000, history->wallTime % 1000,
+						history->cpuTime / 1000, history->cpuTime % 1000,
+						history->stallTime / 1000, history->stallTime % 1000);
+			}
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -929,6 +986,7 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	outputTaskThreadingInfo(env, _manager->getIndentLevel() + 1);
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
@@ -201,6 +201,13 @@ protected:
 	 */
 	void outputMemoryInfo(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output the measured history and chosen thread count of each task type when adaptive task threading is enabled.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputTaskThreadingInfo(MM_EnvironmentBase *env, uintptr_t indent);
+
 	virtual bool hasOutputMemoryInfoInnerStanza();
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
@@ -34,6 +34,7 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsync.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -140,6 +141,16 @@ MM_VerboseManager::closeStreams(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_VerboseManager::flushStreams(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
+	while(NULL != writer) {
+		writer->flushStream(env);
+		writer = writer->getNextWriter();
+	}
+}
+
 void
 MM_VerboseManager::enableVerboseGC()
 {
@@ -235,6 +246,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->asyncLogging || extensions->binaryLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNC;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -315,6 +330,18 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNC:
+		writer = MM_VerboseWriterFileLoggingAsync::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
@@ -116,6 +116,12 @@ public:
 	 */
 	virtual void closeStreams(MM_EnvironmentBase *env);
 
+	/**
+	 * Wait until the output of all output mechanisms can be read from their streams.
+	 * @param env vm thread.
+	 */
+	virtual void flushStreams(MM_EnvironmentBase *env);
+
 	MMINLINE MM_VerboseWriterChain* getWriterChain() { return _writerChain; }
 	MM_VerboseHandlerOutput* getVerboseHandlerOutput() { return _verboseHandlerOutput; }
 
@@ -0,0 +1,462 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_verbose_engine
+ */
+
+#if !defined(VERBOSERECORD_HPP_)
+#define VERBOSERECORD_HPP_
+
+#include <string.h>
+
+#include "omrcomp.h"
+#include "omrstdarg.h"
+#include "modronbase.h"
+
+/* Written at the start of a binary verbose log (-Xgc:binaryLogging), followed by the version and byte order */
+#define VERBOSE_BINARY_LOG_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_LOG_VERSION 1
+#define VERBOSE_BINARY_LOG_BYTE_ORDER 0x01020304
+/* Largest record, so that a record always fits in the buffer of the writer thread */
+#define VERBOSE_RECORD_MAXIMUM_LENGTH 4096
+/* Encoded length of a NULL string argument */
+#define VERBOSE_RECORD_NULL_STRING ((uint32_t)-1)
+/* Returned by MM_VerboseRecord::encodeArguments when the arguments of a line do not fit */
+#define VERBOSE_RECORD_ARGUMENTS_OVERFLOW ((uintptr_t)-1)
+
+/**
+ * Types of verbose record. Records of the record buffer and of binary logs share the header, but not all types.
+ */
+typedef enum {
+	VERBOSE_RECORD_PADDING = 0, /**< Record buffer: skipped bytes at the end of the buffer */
+	VERBOSE_RECORD_TEXT = 1, /**< Formatted text */
+	VERBOSE_RECORD_FORMAT = 2, /**< Binary log: uint32_t id, then the format string the id stands for in later lines */
+	VERBOSE_RECORD_LINE = 3, /**< Record buffer: uint32_t indent, the format string and its NUL, arguments. Binary log: uint32_t format id, uint32_t indent, arguments */
+	VERBOSE_RECORD_NEXT_FILE = 4 /**< Record buffer: the writer thread moves on to the next rotating file */
+} VerboseRecordType;
+
+/**
+ * Header of every record. A binary log is a MM_VerboseBinaryLogHeader followed by records.
+ */
+struct MM_VerboseRecordHeader {
+	volatile uint32_t length; /**< Bytes of the record, header included. In the record buffer, 0 until the record is committed */
+	uint32_t type; /**< A VerboseRecordType */
+};
+
+struct MM_VerboseBinaryLogHeader {
+	char magic[sizeof(VERBOSE_BINARY_LOG_MAGIC)];
+	uint32_t version;
+	uint32_t byteOrder; /**< VERBOSE_BINARY_LOG_BYTE_ORDER in the byte order of the process that wrote the log */
+};
+
+/**
+ * A printf conversion of a verbose format string.
+ */
+struct MM_VerboseConversion {
+	enum Kind {
+		KIND_LITERAL = 0, /**< %% or a conversion that takes no argument */
+		KIND_SIGNED,
+		KIND_UNSIGNED,
+		KIND_POINTER,
+		KIND_DOUBLE,
+		KIND_STRING
+	};
+	enum Modifier {
+		MODIFIER_NONE = 0,
+		MODIFIER_LONG,
+		MODIFIER_LONG_LONG,
+		MODIFIER_SIZE,
+		MODIFIER_64
+	};
+
+	const char *start; /**< The '%' of the conversion */
+	uintptr_t length; /**< Characters of the conversion, '%' included */
+	uintptr_t stars; /**< int arguments taken by '*' width and precision */
+	Kind kind;
+	Modifier modifier;
+};
+
+/**
+ * Encoding of the lines of verbose output as their format string and arguments, so that they can be formatted
+ * away from the thread reporting them, or never formatted at all.
+ *
+ * Arguments are encoded in the order of the conversions of the format: integers, pointers and '*' widths as
+ * uint64_t, floating point as double, and strings as their uint32_t length followed by their characters, or as
+ * VERBOSE_RECORD_NULL_STRING if they are NULL.
+ * Header only, so that binary logs can be decoded offline.
+ */
+class MM_VerboseRecord
+{
+public:
+	/**
+	 * Find the next conversion of a format string.
+	 * @param format[in] the format string, from the end of the previous conversion
+	 * @param conversion[out] the conversion found
+	 * @return true if a conversion was found, false if the format has none left
+	 */
+	static MMINLINE bool
+	findConversion(const char *format, MM_VerboseConversion *conversion)
+	{
+		const char *start = strchr(format, '%');
+		if (NULL == start) {
+			return false;
+		}
+
+		const char *cursor = start + 1;
+		conversion->stars = 0;
+		while (('\0' != *cursor) && (NULL != strchr("-+ #0", *cursor))) {
+			cursor += 1;
+		}
+		for (uintptr_t i = 0; i < 2; i++) {
+			if ('*' == *cursor) {
+				conversion->stars += 1;
+				cursor += 1;
+			} else {
+				while (('0' <= *cursor) && ('9' >= *cursor)) {
+					cursor += 1;
+				}
+			}
+			if ((0 != i) || ('.' != *cursor)) {
+				break;
+			}
+			cursor += 1;
+		}
+
+		conversion->modifier = MM_VerboseConversion::MODIFIER_NONE;
+		if ('h' == *cursor) {
+			cursor += ('h' == cursor[1]) ? 2 : 1;
+		} else if ('l' == *cursor) {
+			if ('l' == cursor[1]) {
+				conversion->modifier = MM_VerboseConversion::MODIFIER_LONG_LONG;
+				cursor += 2;
+			} else {
+				conversion->modifier = MM_VerboseConversion::MODIFIER_LONG;
+				cursor += 1;
+			}
+		} else if (('z' == *cursor) || ('t' == *cursor)) {
+			conversion->modifier = MM_VerboseConversion::MODIFIER_SIZE;
+			cursor += 1;
+		} else if ('j' == *cursor) {
+			conversion->modifier = MM_VerboseConversion::MODIFIER_64;
+			cursor += 1;
+		}
+
+		switch (*cursor) {
+		case 'd':
+		case 'i':
+		case 'c':
+			conversion->kind = MM_VerboseConversion::KIND_SIGNED;
+			break;
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+			conversion->kind = MM_VerboseConversion::KIND_UNSIGNED;
+			break;
+		case 'p':
+			conversion->kind = MM_VerboseConversion::KIND_POINTER;
+			break;
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+			conversion->kind = MM_VerboseConversion::KIND_DOUBLE;
+			break;
+		case 's':
+			conversion->kind = MM_VerboseConversion::KIND_STRING;
+			break;
+		default:
+			/* %% and anything this encoding does not know are left as they are */
+			conversion->kind = MM_VerboseConversion::KIND_LITERAL;
+			conversion->stars = 0;
+			break;
+		}
+		if ('\0' != *cursor) {
+			cursor += 1;
+		}
+
+		conversion->start = start;
+		conversion->length = cursor - start;
+		return true;
+	}
+
+	/**
+	 * Encode the arguments of a line.
+	 * @param buffer[out] where to encode the arguments
+	 * @param bufferSize[in] bytes available at buffer
+	 * @param format[in] the format string of the line
+	 * @param args[in] the arguments of the line
+	 * @return bytes of encoded arguments, VERBOSE_RECORD_ARGUMENTS_OVERFLOW if they do not fit in bufferSize
+	 */
+	static uintptr_t
+	encodeArguments(uint8_t *buffer, uintptr_t bufferSize, const char *format, va_list args)
+	{
+		uintptr_t used = 0;
+		MM_VerboseConversion conversion;
+
+		while (findConversion(format, &conversion)) {
+			format = conversion.start + conversion.length;
+			for (uintptr_t i = 0; i < conversion.stars; i++) {
+				if (!encodeValue(buffer, bufferSize, &used, (uint64_t)(int64_t)va_arg(args, int))) {
+					return VERBOSE_RECORD_ARGUMENTS_OVERFLOW;
+				}
+			}
+
+			uint64_t value = 0;
+			switch (conversion.kind) {
+			case MM_VerboseConversion::KIND_LITERAL:
+				continue;
+			case MM_VerboseConversion::KIND_SIGNED:
+				switch (conversion.modifier) {
+				case MM_VerboseConversion::MODIFIER_LONG:
+					value = (uint64_t)(int64_t)va_arg(args, long);
+					break;
+				case MM_VerboseConversion::MODIFIER_LONG_LONG:
+					value = (uint64_t)(int64_t)va_arg(args, long long);
+					break;
+				case MM_VerboseConversion::MODIFIER_SIZE:
+					value = (uint64_t)(int64_t)va_arg(args, intptr_t);
+					break;
+				case MM_VerboseConversion::MODIFIER_64:
+					value = (uint64_t)va_arg(args, int64_t);
+					break;
+				default:
+					value = (uint64_t)(int64_t)va_arg(args, int);
+					break;
+				}
+				break;
+			case MM_VerboseConversion::KIND_UNSIGNED:
+				switch (conversion.modifier) {
+				case MM_VerboseConversion::MODIFIER_LONG:
+					value = (uint64_t)va_arg(args, unsigned long);
+					break;
+				case MM_VerboseConversion::MODIFIER_LONG_LONG:
+					value = (uint64_t)va_arg(args, unsigned long long);
+					break;
+				case MM_VerboseConversion::MODIFIER_SIZE:
+					value = (uint64_t)va_arg(args, uintptr_t);
+					break;
+				case MM_VerboseConversion::MODIFIER_64:
+					value = va_arg(args, uint64_t);
+					break;
+				default:
+					value = (uint64_t)va_arg(args, unsigned int);
+					break;
+				}
+				break;
+			case MM_VerboseConversion::KIND_POINTER:
+				value = (uint64_t)(uintptr_t)va_arg(args, void *);
+				break;
+			case MM_VerboseConversion::KIND_DOUBLE:
+			{
+				double number = va_arg(args, double);
+				memcpy(&value, &number, sizeof(value));
+				break;
+			}
+			case MM_VerboseConversion::KIND_STRING:
+			{
+				const char *string = va_arg(args, const char *);
+				uint32_t length = (NULL == string) ? VERBOSE_RECORD_NULL_STRING : (uint32_t)strlen(string);
+				uintptr_t stringLength = (NULL == string) ? 0 : length;
+				if ((used + sizeof(length) + stringLength) > bufferSize) {
+					return VERBOSE_RECORD_ARGUMENTS_OVERFLOW;
+				}
+				memcpy(buffer + used, &length, sizeof(length));
+				memcpy(buffer + used + sizeof(length), string, stringLength);
+				used += sizeof(length) + stringLength;
+				continue;
+			}
+			}
+
+			if (!encodeValue(buffer, bufferSize, &used, value)) {
+				return VERBOSE_RECORD_ARGUMENTS_OVERFLOW;
+			}
+		}
+
+		return used;
+	}
+
+	/**
+	 * Format a line from its format string and encoded arguments.
+	 * @param printer[in] formats one conversion: uintptr_t printer(char *buffer, uintptr_t size, const char *conversion, T value)
+	 * for every type of value, returning the characters written without the terminating NUL
+	 * @param buffer[out] where to format the line, NUL terminated
+	 * @param bufferSize[in] bytes available at buffer, the line is truncated to fit
+	 * @param format[in] the format string of the line
+	 * @param arguments[in] the encoded arguments of the line
+	 * @param argumentsSize[in] bytes of encoded arguments
+	 * @return characters of the formatted line
+	 */
+	template <typename PRINTER>
+	static uintptr_t
+	formatLine(PRINTER &printer, char *buffer, uintptr_t bufferSize, const char *format, const uint8_t *arguments, uintptr_t argumentsSize)
+	{
+		uintptr_t used = 0;
+		uintptr_t consumed = 0;
+		MM_VerboseConversion conversion;
+
+		if (0 == bufferSize) {
+			return 0;
+		}
+		buffer[0] = '\0';
+
+		while (findConversion(format, &conversion)) {
+			used += copyText(buffer + used, bufferSize - used, format, conversion.start - format);
+			format = conversion.start + conversion.length;
+
+			/* a copy of the conversion, with '*' widths substituted, and the modifier the printer expects */
+			char spec[64];
+			uintptr_t specLength = 0;
+			for (const char *cursor = conversion.start; cursor < format; cursor++) {
+				if ((sizeof(spec) - 24) <= specLength) {
+					break;
+				} else if ('*' == *cursor) {
+					uint64_t width = 0;
+					decodeValue(arguments, argumentsSize, &consumed, &width);
+					specLength += printer(spec + specLength, sizeof(spec) - specLength, "%d", (int)(int64_t)width);
+				} else {
+					spec[specLength++] = *cursor;
+				}
+			}
+			spec[specLength] = '\0';
+
+			char *end = buffer + used;
+			uintptr_t available = bufferSize - used;
+			uintptr_t printed = 0;
+			if (MM_VerboseConversion::KIND_LITERAL == conversion.kind) {
+				if (0 == strcmp(spec, "%%")) {
+					printed = copyText(end, available, "%", 1);
+				} else {
+					printed = copyText(end, available, spec, specLength);
+				}
+			} else if (MM_VerboseConversion::KIND_STRING == conversion.kind) {
+				uint32_t length = 0;
+				char string[VERBOSE_RECORD_MAXIMUM_LENGTH];
+				if ((consumed + sizeof(length)) <= argumentsSize) {
+					memcpy(&length, arguments + consumed, sizeof(length));
+					consumed += sizeof(length);
+				}
+				if (VERBOSE_RECORD_NULL_STRING == length) {
+					printed = printer(end, available, spec, (const char *)NULL);
+				} else {
+					length = (uint32_t)OMR_MIN(OMR_MIN(length, argumentsSize - consumed), sizeof(string) - 1);
+					memcpy(string, arguments + consumed, length);
+					string[length] = '\0';
+					consumed += length;
+					printed = printer(end, available, spec, (const char *)string);
+				}
+			} else {
+				uint64_t value = 0;
+				decodeValue(arguments, argumentsSize, &consumed, &value);
+				printed = printValue(printer, end, available, spec, &conversion, value);
+			}
+			used += OMR_MIN(printed, available - 1);
+		}
+
+		used += copyText(buffer + used, bufferSize - used, format, strlen(format));
+		return used;
+	}
+
+private:
+	template <typename PRINTER>
+	static uintptr_t
+	printValue(PRINTER &printer, char *buffer, uintptr_t bufferSize, const char *spec, MM_VerboseConversion *conversion, uint64_t value)
+	{
+		switch (conversion->kind) {
+		case MM_VerboseConversion::KIND_SIGNED:
+			switch (conversion->modifier) {
+			case MM_VerboseConversion::MODIFIER_LONG:
+				return printer(buffer, bufferSize, spec, (long)(int64_t)value);
+			case MM_VerboseConversion::MODIFIER_LONG_LONG:
+				return printer(buffer, bufferSize, spec, (long long)(int64_t)value);
+			case MM_VerboseConversion::MODIFIER_SIZE:
+				return printer(buffer, bufferSize, spec, (intptr_t)(int64_t)value);
+			case MM_VerboseConversion::MODIFIER_64:
+				return printer(buffer, bufferSize, spec, (int64_t)value);
+			default:
+				return printer(buffer, bufferSize, spec, (int)(int64_t)value);
+			}
+		case MM_VerboseConversion::KIND_UNSIGNED:
+			switch (conversion->modifier) {
+			case MM_VerboseConversion::MODIFIER_LONG:
+				return printer(buffer, bufferSize, spec, (unsigned long)value);
+			case MM_VerboseConversion::MODIFIER_LONG_LONG:
+				return printer(buffer, bufferSize, spec, (unsigned long long)value);
+			case MM_VerboseConversion::MODIFIER_SIZE:
+				return printer(buffer, bufferSize, spec, (uintptr_t)value);
+			case MM_VerboseConversion::MODIFIER_64:
+				return printer(buffer, bufferSize, spec, value);
+			default:
+				return printer(buffer, bufferSize, spec, (unsigned int)value);
+			}
+		case MM_VerboseConversion::KIND_POINTER:
+			return printer(buffer, bufferSize, spec, (void *)(uintptr_t)value);
+		case MM_VerboseConversion::KIND_DOUBLE:
+		{
+			double number = 0.0;
+			memcpy(&number, &value, sizeof(number));
+			return printer(buffer, bufferSize, spec, number);
+		}
+		default:
+			return 0;
+		}
+	}
+
+	static MMINLINE bool
+	encodeValue(uint8_t *buffer, uintptr_t bufferSize, uintptr_t *used, uint64_t value)
+	{
+		if ((*used + sizeof(value)) > bufferSize) {
+			return false;
+		}
+		memcpy(buffer + *used, &value, sizeof(value));
+		*used += sizeof(value);
+		return true;
+	}
+
+	static MMINLINE void
+	decodeValue(const uint8_t *arguments, uintptr_t argumentsSize, uintptr_t *consumed, uint64_t *value)
+	{
+		if ((*consumed + sizeof(*value)) <= argumentsSize) {
+			memcpy(value, arguments + *consumed, sizeof(*value));
+			*consumed += sizeof(*value);
+		}
+	}
+
+	/**
+	 * Append text to a NUL terminated buffer, truncating it to fit.
+	 * @return characters appended
+	 */
+	static MMINLINE uintptr_t
+	copyText(char *buffer, uintptr_t bufferSize, const char *text, uintptr_t length)
+	{
+		length = OMR_MIN(length, bufferSize - 1);
+		memcpy(buffer, text, length);
+		buffer[length] = '\0';
+		return length;
+	}
+};
+
+#endif /* VERBOSERECORD_HPP_ */
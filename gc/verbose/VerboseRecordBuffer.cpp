@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseRecordBuffer.hpp"
+
+MM_VerboseRecordBuffer *
+MM_VerboseRecordBuffer::newInstance(MM_EnvironmentBase *env, uintptr_t size)
+{
+	MM_VerboseRecordBuffer *recordBuffer = (MM_VerboseRecordBuffer *)env->getForge()->allocate(sizeof(MM_VerboseRecordBuffer), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != recordBuffer) {
+		new(recordBuffer) MM_VerboseRecordBuffer();
+		recordBuffer->_size = 2 * VERBOSE_RECORD_MAXIMUM_LENGTH;
+		while (recordBuffer->_size < size) {
+			recordBuffer->_size *= 2;
+		}
+		if (!recordBuffer->initialize(env)) {
+			recordBuffer->kill(env);
+			recordBuffer = NULL;
+		}
+	}
+	return recordBuffer;
+}
+
+void
+MM_VerboseRecordBuffer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_VerboseRecordBuffer::initialize(MM_EnvironmentBase *env)
+{
+	_buffer = (uint8_t *)env->getForge()->allocate(_size, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _buffer) {
+		return false;
+	}
+	memset(_buffer, 0, _size);
+	return true;
+}
+
+void
+MM_VerboseRecordBuffer::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+}
+
+MM_VerboseRecordHeader *
+MM_VerboseRecordBuffer::reserve(uint32_t type, uintptr_t length)
+{
+	uintptr_t alignedLength = MM_Math::roundToCeiling(sizeof(uint64_t), length);
+
+	while (true) {
+		uintptr_t reserved = _reserved;
+		uintptr_t offset = reserved & (_size - 1);
+		uintptr_t padding = ((offset + alignedLength) > _size) ? (_size - offset) : 0;
+		if ((reserved + padding + alignedLength - _released) > _size) {
+			return NULL;
+		}
+
+		if (reserved == MM_AtomicOperations::lockCompareExchange(&_reserved, reserved, reserved + padding + alignedLength)) {
+			if (0 != padding) {
+				MM_VerboseRecordHeader *paddingRecord = (MM_VerboseRecordHeader *)(_buffer + offset);
+				paddingRecord->type = VERBOSE_RECORD_PADDING;
+				commit(paddingRecord, padding);
+				offset = 0;
+			}
+			MM_VerboseRecordHeader *record = (MM_VerboseRecordHeader *)(_buffer + offset);
+			record->type = type;
+			return record;
+		}
+	}
+}
+
+MM_VerboseRecordHeader *
+MM_VerboseRecordBuffer::next()
+{
+	while (true) {
+		MM_VerboseRecordHeader *record = (MM_VerboseRecordHeader *)(_buffer + (_released & (_size - 1)));
+		if (0 == record->length) {
+			return NULL;
+		}
+		/* the record was written before its length was stored */
+		MM_AtomicOperations::readBarrier();
+		if (VERBOSE_RECORD_PADDING != record->type) {
+			return record;
+		}
+		release(record);
+	}
+}
+
+void
+MM_VerboseRecordBuffer::release(MM_VerboseRecordHeader *record)
+{
+	uintptr_t alignedLength = MM_Math::roundToCeiling(sizeof(uint64_t), record->length);
+	memset((void *)record, 0, alignedLength);
+	/* the record must read as not committed before its space can be reserved again */
+	MM_AtomicOperations::writeBarrier();
+	_released += alignedLength;
+}
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_verbose_engine
+ */
+
+#if !defined(VERBOSERECORDBUFFER_HPP_)
+#define VERBOSERECORDBUFFER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "VerboseRecord.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Lock free ring of verbose records, appended by any number of threads and consumed by the verbose writer thread.
+ *
+ * Appending threads reserve space by advancing _reserved, write their record and commit it by storing its length,
+ * so records are consumed in the order they were reserved, each once it is committed. A record that would wrap
+ * around the end of the buffer is preceded by padding and starts at the beginning. The consumer clears the records
+ * it is done with before releasing them, so that the length of a record not yet committed always reads 0.
+ * @ingroup GC_verbose_engine
+ */
+class MM_VerboseRecordBuffer : public MM_BaseNonVirtual
+{
+/* Data members */
+private:
+	uint8_t *_buffer;
+	uintptr_t _size; /**< Bytes of _buffer, a power of two */
+	volatile uintptr_t _reserved; /**< Bytes ever reserved, the offset of the next record is _reserved modulo _size */
+	volatile uintptr_t _released; /**< Bytes ever released by the consumer */
+
+/* Methods */
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	/**
+	 * @param size[in] bytes of the buffer, rounded up to a power of two of at least 2 * VERBOSE_RECORD_MAXIMUM_LENGTH
+	 */
+	static MM_VerboseRecordBuffer *newInstance(MM_EnvironmentBase *env, uintptr_t size);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Reserve space for a record. Never blocks.
+	 * @param type[in] the VerboseRecordType of the record
+	 * @param length[in] bytes of the record, header included, at most VERBOSE_RECORD_MAXIMUM_LENGTH
+	 * @return the record, to be written and committed, or NULL if the buffer is full
+	 */
+	MM_VerboseRecordHeader *reserve(uint32_t type, uintptr_t length);
+
+	/**
+	 * Publish a reserved record to the consumer.
+	 * @param record[in] a record returned by reserve()
+	 * @param length[in] bytes of the record, header included, as reserved
+	 */
+	MMINLINE void
+	commit(MM_VerboseRecordHeader *record, uintptr_t length)
+	{
+		MM_AtomicOperations::writeBarrier();
+		record->length = (uint32_t)length;
+	}
+
+	/**
+	 * Consumer only.
+	 * @return the oldest record, or NULL if it is not committed yet or there is none
+	 */
+	MM_VerboseRecordHeader *next();
+
+	/**
+	 * Consumer only. Release the record returned by next(), so that its space can be reserved again.
+	 */
+	void release(MM_VerboseRecordHeader *record);
+
+	/**
+	 * @return true if every record reserved so far has been released
+	 */
+	MMINLINE bool isEmpty() { return _reserved == _released; }
+
+	MM_VerboseRecordBuffer()
+		: MM_BaseNonVirtual()
+		, _buffer(NULL)
+		, _size(0)
+		, _reserved(0)
+		, _released(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* VERBOSERECORDBUFFER_HPP_ */
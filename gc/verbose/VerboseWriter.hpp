@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNC = 6
 } WriterType;
 
 /**
@@ -69,12 +71,31 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * @return true if lines are to be handed to outputRecord() rather than formatted and handed to outputString()
+	 */
+	virtual bool outputsRecords() { return false; }
+
+	/**
+	 * Output a line without formatting it. Only called while outputsRecords() is true.
+	 * @param env[in] the current thread
+	 * @param indent[in] indentation level of the line
+	 * @param format[in] printf format string of the line, which may not outlive the call
+	 * @param args[in] arguments of the format string
+	 */
+	virtual void outputRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Wait until the output handed to the writer so far can be read from its stream.
+	 */
+	virtual void flushStream(MM_EnvironmentBase *env) {}
+
 	MMINLINE WriterType getType(void) { return _type; }
 
 	MMINLINE bool isActive(void) { return _isActive; }
@@ -36,6 +36,7 @@ MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
 	,_writers(NULL)
+	,_bufferFormatted(false)
 {}
 
 MM_VerboseWriterChain *
@@ -58,10 +59,27 @@ void
 MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...)
 {
 	va_list args;
+	bool needsFormatting = false;
 
-	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
-	va_end(args);
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (writer->outputsRecords()) {
+			va_start(args, format);
+			writer->outputRecord(env, indent, format, args);
+			va_end(args);
+		} else {
+			needsFormatting = true;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	/* only writers taking formatted strings need the line formatted */
+	if (needsFormatting) {
+		va_start(args, format);
+		_buffer->formatAndOutputV(env, indent, format, args);
+		va_end(args);
+		_bufferFormatted = true;
+	}
 }
 
 void
@@ -69,10 +87,14 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		/* writers taking records were handed the lines formatted in the buffer, but not what was added to it directly */
+		if (!writer->outputsRecords() || !_bufferFormatted) {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	_bufferFormatted = false;
 }
 
 void
@@ -45,6 +45,7 @@ protected:
 private:
 	MM_VerboseBuffer *_buffer;
 	MM_VerboseWriter *_writers;
+	bool _bufferFormatted; /**< True if lines handed to writers as records were also formatted in _buffer since the last flush */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
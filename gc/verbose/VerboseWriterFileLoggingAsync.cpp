@@ -0,0 +1,618 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsync.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+#include "VerboseRecordBuffer.hpp"
+
+#include <string.h>
+
+#define INDENT_SPACER "  "
+
+/**
+ * Formats the conversions of a line for MM_VerboseRecord::formatLine the way MM_VerboseBuffer does.
+ */
+class MM_VerboseLinePrinter
+{
+private:
+	OMRPortLibrary *_portLibrary;
+
+public:
+	template <typename T>
+	uintptr_t
+	operator()(char *buffer, uintptr_t size, const char *conversion, T value)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		return omrstr_printf(buffer, size, conversion, value);
+	}
+
+	MM_VerboseLinePrinter(OMRPortLibrary *portLibrary)
+		: _portLibrary(portLibrary)
+	{}
+};
+
+MM_VerboseWriterFileLoggingAsync::MM_VerboseWriterFileLoggingAsync(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNC)
+	,_omrVM(env->getOmrVM())
+	,_logFileStream(NULL)
+	,_binary(false)
+	,_records(NULL)
+	,_monitor(NULL)
+	,_threadState(THREAD_NOT_STARTED)
+	,_writerWaiting(false)
+	,_formats(NULL)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsync instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsync.
+ */
+MM_VerboseWriterFileLoggingAsync *
+MM_VerboseWriterFileLoggingAsync::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsync *agent = (MM_VerboseWriterFileLoggingAsync *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsync), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsync(env, manager);
+		if (!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsync instance and starts the writer thread.
+ */
+bool
+MM_VerboseWriterFileLoggingAsync::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_binary = extensions->binaryLogging;
+	if (NULL == _records) {
+		_records = MM_VerboseRecordBuffer::newInstance(env, VERBOSE_ASYNC_RECORD_BUFFER_SIZE);
+		if (NULL == _records) {
+			return false;
+		}
+	}
+	if (_binary && (NULL == _formats)) {
+		uintptr_t tableSize = sizeof(FormatEntry) * VERBOSE_ASYNC_FORMAT_TABLE_SIZE;
+		_formats = (FormatEntry *)extensions->getForge()->allocate(tableSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _formats) {
+			return false;
+		}
+		memset(_formats, 0, tableSize);
+	}
+	if ((NULL == _monitor) && (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsync::_monitor"))) {
+		return false;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startWriterThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsync.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _monitor) {
+		stopWriterThread(env);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+	closeLogFile(env);
+
+	if (NULL != _formats) {
+		resetFormats(env);
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+	if (NULL != _records) {
+		_records->kill(env);
+		_records = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::startWriterThread(MM_EnvironmentBase *env)
+{
+	bool result = false;
+
+	/* hold the monitor so the thread cannot report it is running before we wait */
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_NOT_STARTED;
+	if (0 == createThreadWithCategory(NULL, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0, writerThreadProc, this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		while (THREAD_NOT_STARTED == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		result = (THREAD_RUNNING == _threadState);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::stopWriterThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_RUNNING == _threadState) {
+		_threadState = THREAD_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsync::writerThreadProc(void *info)
+{
+	((MM_VerboseWriterFileLoggingAsync *)info)->runWriterThread();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::runWriterThread()
+{
+	MM_EnvironmentBase env(_omrVM);
+	OMRPORT_ACCESS_FROM_OMRPORT(env.getPortLibrary());
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+
+	bool terminating = false;
+	while (!terminating) {
+		MM_VerboseRecordHeader *record = _records->next();
+		if (NULL != record) {
+			writeRecord(&env, record);
+			_records->release(record);
+			continue;
+		}
+
+		/* caught up, make the output visible before waiting for more */
+		if (NULL != _logFileStream) {
+			omrfilestream_sync(_logFileStream);
+		}
+
+		omrthread_monitor_enter(_monitor);
+		_writerWaiting = true;
+		/* either a record committed from now on finds _writerWaiting set, or it is found here */
+		MM_AtomicOperations::readWriteBarrier();
+		if (NULL == _records->next()) {
+			if (THREAD_TERMINATION_REQUESTED == _threadState) {
+				terminating = true;
+			} else {
+				/* wake threads waiting in flushStream() */
+				omrthread_monitor_notify_all(_monitor);
+				omrthread_monitor_wait(_monitor);
+			}
+		}
+		_writerWaiting = false;
+		omrthread_monitor_exit(_monitor);
+	}
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+MM_VerboseRecordHeader *
+MM_VerboseWriterFileLoggingAsync::reserveRecord(uint32_t type, uintptr_t length)
+{
+	MM_VerboseRecordHeader *record = _records->reserve(type, length);
+	if (NULL != record) {
+		return record;
+	}
+
+	/* the writer thread is behind, wait for it rather than lose output */
+	while ((NULL == record) && (THREAD_RUNNING == _threadState)) {
+		if (_writerWaiting) {
+			omrthread_monitor_enter(_monitor);
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_exit(_monitor);
+		}
+		omrthread_yield();
+		record = _records->reserve(type, length);
+	}
+	return record;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::commitRecord(MM_VerboseRecordHeader *record, uintptr_t length)
+{
+	_records->commit(record, length);
+	/* either the writer thread finds the record before waiting, or it is found waiting here */
+	MM_AtomicOperations::readWriteBarrier();
+	if (_writerWaiting) {
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::appendText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+{
+	while (0 != length) {
+		uintptr_t chunkLength = OMR_MIN(length, VERBOSE_RECORD_MAXIMUM_LENGTH - sizeof(MM_VerboseRecordHeader));
+		uintptr_t recordLength = sizeof(MM_VerboseRecordHeader) + chunkLength;
+		MM_VerboseRecordHeader *record = reserveRecord(VERBOSE_RECORD_TEXT, recordLength);
+		if (NULL == record) {
+			writeText(env, text, length);
+			return;
+		}
+		memcpy(record + 1, text, chunkLength);
+		commitRecord(record, recordLength);
+		text += chunkLength;
+		length -= chunkLength;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::outputRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint8_t arguments[VERBOSE_RECORD_MAXIMUM_LENGTH];
+	uint32_t recordIndent = (uint32_t)indent;
+	uintptr_t formatLength = strlen(format) + 1;
+	uintptr_t prefixLength = sizeof(MM_VerboseRecordHeader) + sizeof(recordIndent) + formatLength;
+	uintptr_t argumentsLength = VERBOSE_RECORD_ARGUMENTS_OVERFLOW;
+	va_list argsCopy;
+
+	if (prefixLength < sizeof(arguments)) {
+		COPY_VA_LIST(argsCopy, args);
+		argumentsLength = MM_VerboseRecord::encodeArguments(arguments, sizeof(arguments) - prefixLength, format, argsCopy);
+		va_end(argsCopy);
+	}
+
+	if (VERBOSE_RECORD_ARGUMENTS_OVERFLOW == argumentsLength) {
+		/* too long for a record, format it here instead */
+		char *line = (char *)arguments;
+		uintptr_t length = 0;
+		for (uintptr_t i = 0; (i < indent) && (length < (sizeof(arguments) / 2)); i++) {
+			memcpy(line + length, INDENT_SPACER, sizeof(INDENT_SPACER) - 1);
+			length += sizeof(INDENT_SPACER) - 1;
+		}
+		COPY_VA_LIST(argsCopy, args);
+		length += omrstr_vprintf(line + length, sizeof(arguments) - length - 1, format, argsCopy);
+		length = OMR_MIN(length, sizeof(arguments) - 2);
+		va_end(argsCopy);
+		line[length++] = '\n';
+		appendText(env, line, length);
+		return;
+	}
+
+	uintptr_t recordLength = prefixLength + argumentsLength;
+	MM_VerboseRecordHeader *record = reserveRecord(VERBOSE_RECORD_LINE, recordLength);
+	if (NULL != record) {
+		uint8_t *cursor = (uint8_t *)(record + 1);
+		memcpy(cursor, &recordIndent, sizeof(recordIndent));
+		cursor += sizeof(recordIndent);
+		memcpy(cursor, format, formatLength);
+		cursor += formatLength;
+		memcpy(cursor, arguments, argumentsLength);
+		commitRecord(record, recordLength);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	if (0 != length) {
+		if (outputsRecords()) {
+			appendText(env, string, length);
+		} else {
+			writeText(env, string, length);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::flushStream(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_enter(_monitor);
+		while ((THREAD_RUNNING == _threadState) && (!_records->isEmpty() || !_writerWaiting)) {
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+/**
+ * Cycle the output files if necessary. The writer thread moves on to the next file once it has written the
+ * records of the cycle.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (rotating_files == _mode) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		if (0 == _currentCycle) {
+			MM_VerboseRecordHeader *record = NULL;
+			if (outputsRecords()) {
+				record = reserveRecord(VERBOSE_RECORD_NEXT_FILE, sizeof(MM_VerboseRecordHeader));
+			}
+			if (NULL != record) {
+				commitRecord(record, sizeof(MM_VerboseRecordHeader));
+				MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+				if (NULL != buffer) {
+					_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+					outputString(env, buffer->contents());
+					buffer->kill(env);
+				}
+			} else {
+				closeLogFile(env);
+				_currentFile = (_currentFile + 1) % _numFiles;
+				openFile(env, true);
+			}
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::writeRecord(MM_EnvironmentBase *env, MM_VerboseRecordHeader *record)
+{
+	const uint8_t *payload = (const uint8_t *)(record + 1);
+	uintptr_t payloadLength = record->length - sizeof(MM_VerboseRecordHeader);
+
+	switch (record->type) {
+	case VERBOSE_RECORD_TEXT:
+		writeText(env, (const char *)payload, payloadLength);
+		break;
+	case VERBOSE_RECORD_LINE:
+	{
+		uint32_t indent = 0;
+		memcpy(&indent, payload, sizeof(indent));
+		const char *format = (const char *)(payload + sizeof(indent));
+		uintptr_t formatLength = strlen(format) + 1;
+		const uint8_t *arguments = payload + sizeof(indent) + formatLength;
+		uintptr_t argumentsLength = payloadLength - sizeof(indent) - formatLength;
+
+		uint32_t formatId = 0;
+		if (_binary && (NULL != _logFileStream)) {
+			formatId = findFormatId(env, format);
+		}
+		if (0 != formatId) {
+			uint32_t prefix[2] = { formatId, indent };
+			writeBinary(env, VERBOSE_RECORD_LINE, prefix, sizeof(prefix), arguments, argumentsLength);
+		} else {
+			char line[2 * VERBOSE_RECORD_MAXIMUM_LENGTH];
+			uintptr_t length = 0;
+			for (uintptr_t i = 0; (i < indent) && (length < (sizeof(line) / 2)); i++) {
+				memcpy(line + length, INDENT_SPACER, sizeof(INDENT_SPACER) - 1);
+				length += sizeof(INDENT_SPACER) - 1;
+			}
+			MM_VerboseLinePrinter printer(env->getPortLibrary());
+			length += MM_VerboseRecord::formatLine(printer, line + length, sizeof(line) - length - 1, format, arguments, argumentsLength);
+			line[length++] = '\n';
+			writeText(env, line, length);
+		}
+		break;
+	}
+	case VERBOSE_RECORD_NEXT_FILE:
+		closeLogFile(env);
+		_currentFile = (_currentFile + 1) % _numFiles;
+		openFile(env);
+		break;
+	default:
+		break;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		/* as the buffered writer does, try to open the file again if it failed to open before */
+		openFile(env);
+	}
+
+	if (NULL != _logFileStream) {
+		if (_binary) {
+			writeBinary(env, VERBOSE_RECORD_TEXT, NULL, 0, text, length);
+		} else {
+			omrfilestream_write_text(_logFileStream, text, length, J9STR_CODE_PLATFORM_RAW);
+		}
+	} else {
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, text, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::writeBinary(MM_EnvironmentBase *env, uint32_t type, const void *prefix, uintptr_t prefixLength, const void *data, uintptr_t dataLength)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint32_t header[2] = { (uint32_t)(sizeof(MM_VerboseRecordHeader) + prefixLength + dataLength), type };
+
+	omrfilestream_write(_logFileStream, header, sizeof(header));
+	if (0 != prefixLength) {
+		omrfilestream_write(_logFileStream, prefix, prefixLength);
+	}
+	if (0 != dataLength) {
+		omrfilestream_write(_logFileStream, data, dataLength);
+	}
+}
+
+uint32_t
+MM_VerboseWriterFileLoggingAsync::findFormatId(MM_EnvironmentBase *env, const char *format)
+{
+	/* FNV-1a */
+	uintptr_t hash = (uintptr_t)2166136261U;
+	for (const char *cursor = format; '\0' != *cursor; cursor++) {
+		hash = (hash ^ (uint8_t)*cursor) * 16777619U;
+	}
+
+	for (uintptr_t probe = 0; probe < VERBOSE_ASYNC_FORMAT_TABLE_SIZE; probe++) {
+		uintptr_t index = (hash + probe) & (VERBOSE_ASYNC_FORMAT_TABLE_SIZE - 1);
+		FormatEntry *entry = &_formats[index];
+		if (NULL == entry->format) {
+			uintptr_t formatLength = strlen(format);
+			entry->format = (char *)env->getForge()->allocate(formatLength + 1, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+			if (NULL == entry->format) {
+				return 0;
+			}
+			memcpy(entry->format, format, formatLength + 1);
+			entry->hash = hash;
+			uint32_t formatId = (uint32_t)index + 1;
+			writeBinary(env, VERBOSE_RECORD_FORMAT, &formatId, sizeof(formatId), format, formatLength);
+			return formatId;
+		}
+		if ((hash == entry->hash) && (0 == strcmp(format, entry->format))) {
+			return (uint32_t)index + 1;
+		}
+	}
+
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::resetFormats(MM_EnvironmentBase *env)
+{
+	if (NULL != _formats) {
+		for (uintptr_t i = 0; i < VERBOSE_ASYNC_FORMAT_TABLE_SIZE; i++) {
+			if (NULL != _formats[i].format) {
+				env->getForge()->free(_formats[i].format);
+				_formats[i].format = NULL;
+			}
+		}
+	}
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsync::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	if (_binary) {
+		MM_VerboseBinaryLogHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, VERBOSE_BINARY_LOG_MAGIC, sizeof(header.magic));
+		header.version = VERBOSE_BINARY_LOG_VERSION;
+		header.byteOrder = VERBOSE_BINARY_LOG_BYTE_ORDER;
+		omrfilestream_write(_logFileStream, &header, sizeof(header));
+		resetFormats(env);
+	}
+	writeText(env, getHeader(env), strlen(getHeader(env)));
+
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeText(env, buffer->contents(), strlen(buffer->contents()));
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::closeFile(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		stopWriterThread(env);
+	}
+	closeLogFile(env);
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != _logFileStream) {
+		writeText(env, getFooter(env), strlen(getFooter(env)));
+		writeText(env, "\n", strlen("\n"));
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNC_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNC_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseRecord.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseRecordBuffer;
+
+/* Bytes of the buffer records are appended to */
+#define VERBOSE_ASYNC_RECORD_BUFFER_SIZE (1024 * 1024)
+/* Distinct format strings a binary log holds before lines are written to it formatted, a power of two */
+#define VERBOSE_ASYNC_FORMAT_TABLE_SIZE 1024
+
+/**
+ * Output agent which directs verbosegc output to file from a thread of its own (-Xgc:asyncLogging).
+ *
+ * Lines are appended to a lock free record buffer as their format string and encoded arguments, so reporting
+ * threads neither format them nor wait for the file. The writer thread formats them to the file, or with
+ * -Xgc:binaryLogging writes the records as they are, each format string once per file, for
+ * omrperfgcverbosedecoder to format offline.
+ *
+ * If the writer thread is not running, lines are formatted and written by the reporting thread.
+ */
+class MM_VerboseWriterFileLoggingAsync : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum ThreadState {
+		THREAD_NOT_STARTED = 0,
+		THREAD_RUNNING,
+		THREAD_TERMINATION_REQUESTED,
+		THREAD_TERMINATED
+	};
+
+	struct FormatEntry {
+		uintptr_t hash; /**< Hash of format */
+		char *format; /**< Copy of a format string written to the current file, NULL for an unused entry */
+	};
+
+	OMR_VM *_omrVM;
+	OMRFileStream *_logFileStream; /**< the filestream being written to */
+	bool _binary; /**< True if records are written as they are rather than formatted */
+	MM_VerboseRecordBuffer *_records; /**< Lines and text waiting for the writer thread */
+	omrthread_monitor_t _monitor; /**< Notified when records are appended while the writer thread waits, and on thread state changes */
+	volatile ThreadState _threadState;
+	volatile bool _writerWaiting; /**< True while the writer thread waits for records, having written every record before */
+	FormatEntry *_formats; /**< Format strings of the current binary log, the id of a format is its index plus one */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsync *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual bool outputsRecords() { return THREAD_RUNNING == _threadState; }
+	virtual void outputRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void flushStream(MM_EnvironmentBase *env);
+
+protected:
+	MM_VerboseWriterFileLoggingAsync(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	/**
+	 * Stop the writer thread, once it has written every record, and close the file.
+	 */
+	void closeFile(MM_EnvironmentBase *env);
+	void closeLogFile(MM_EnvironmentBase *env);
+
+	bool startWriterThread(MM_EnvironmentBase *env);
+	void stopWriterThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC writerThreadProc(void *info);
+	void runWriterThread();
+
+	/**
+	 * Reserve a record, waiting for the writer thread to make room if the buffer is full.
+	 * @return the record, or NULL if the writer thread stopped
+	 */
+	MM_VerboseRecordHeader *reserveRecord(uint32_t type, uintptr_t length);
+	void commitRecord(MM_VerboseRecordHeader *record, uintptr_t length);
+	void appendText(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+
+	void writeRecord(MM_EnvironmentBase *env, MM_VerboseRecordHeader *record);
+	void writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+	void writeBinary(MM_EnvironmentBase *env, uint32_t type, const void *prefix, uintptr_t prefixLength, const void *data, uintptr_t dataLength);
+	/**
+	 * @return the id of a format string in the current binary log, writing it if it is new, 0 if the log has too many
+	 */
+	uint32_t findFormatId(MM_EnvironmentBase *env, const char *format);
+	void resetFormats(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNC_HPP_ */
@@ -166,3 +166,13 @@ MM_VerboseWriterFileLoggingBuffered::outputString(MM_EnvironmentBase *env, const
 		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, strlen(string), J9STR_CODE_PLATFORM_RAW);
 	}
 }
+
+void
+MM_VerboseWriterFileLoggingBuffered::flushStream(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != _logFileStream) {
+		omrfilestream_sync(_logFileStream);
+	}
+}
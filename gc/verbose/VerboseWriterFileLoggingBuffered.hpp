@@ -47,6 +47,7 @@ public:
 	static MM_VerboseWriterFileLoggingBuffered *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void flushStream(MM_EnvironmentBase *env);
 
 protected:
 	MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager);
@@ -25,11 +25,15 @@
 #include "omrgcconsts.h"
 #include "gcutils.h"
 
+#include "ConcurrentCardTable.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "ConcurrentMarkPhaseStats.hpp"
+#include "ConcurrentPacer.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HotFieldProfiler.hpp"
+#include "PretenureProfiler.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -300,6 +304,15 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	handleMarkEndInternal(env, eventData);
 
+	MM_NUMAWorkStats *numaWorkStats = &extensions->globalGCStats.numaWorkStats;
+	for (uintptr_t node = 1; node <= numaWorkStats->_highestNode; node++) {
+		MM_NUMAWorkStats::NodeStats *nodeStats = &numaWorkStats->_nodes[node];
+		if (0 != nodeStats->workerCount) {
+			writer->formatAndOutput(env, 1, "<numa-node id=\"%zu\" workers=\"%zu\" packetsacquired=\"%zu\" packetsstolen=\"%zu\" remotesteals=\"%zu\" stealfailures=\"%zu\" />",
+					node, nodeStats->workerCount, nodeStats->packetsAcquired, nodeStats->packetsStolen, nodeStats->packetsStolenRemote, nodeStats->stealFailures);
+		}
+	}
+
 	handleGCOPOuterStanzaEnd(env);
 	writer->flush(env);
 	exitAtomicReportingBlock();
@@ -370,8 +383,14 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_subAreas) {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" subareas=\"%zu\" evacuated=\"%zu\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason),
+					compactStats->_subAreas, compactStats->_evacuatedSubAreas);
+		} else {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -430,6 +449,23 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != (scavengerStats->_prefetchedForwarded + scavengerStats->_prefetchedCopied)) {
+		writer->formatAndOutput(env, 1, "<scavenger-prefetch window=\"%zu\" forwarded=\"%llu\" copied=\"%llu\" />",
+				extensions->scavengerPrefetchWindowSize, scavengerStats->_prefetchedForwarded, scavengerStats->_prefetchedCopied);
+	}
+	if (NULL != extensions->hotFieldProfiler) {
+		outputLearnedHotFields(env, 1, scavengerStats, extensions->hotFieldProfiler);
+	}
+	if (NULL != extensions->rememberedSetSummary) {
+		writer->formatAndOutput(env, 1, "<remembered-set-summary listed=\"%zu\" chunks=\"%zu\" summarized=\"%zu\" filterhits=\"%zu\" chunkswalked=\"%zu\" walksavoided=\"%zu\" />",
+				scavengerStats->_rememberedSetSize, scavengerStats->_rememberedSetSummaryChunks, scavengerStats->_rememberedSetSummarizedObjects,
+				scavengerStats->_rememberedSetSummaryFilterHits, scavengerStats->_rememberedSetSummaryChunksWalked, scavengerStats->_rememberedSetOverflowWalksAvoided);
+	}
+	if (NULL != extensions->pretenureProfiler) {
+		writer->formatAndOutput(env, 1, "<pretenure threshold=\"%zu\" samples=\"%zu\" sites=\"%zu\" pretenured=\"%zu\" added=\"%zu\" dropped=\"%zu\" />",
+				extensions->pretenureSurvivalThreshold, scavengerStats->_pretenureSamples, scavengerStats->_pretenureProfiledSites,
+				scavengerStats->_pretenuredSites, scavengerStats->_pretenuredSitesAdded, extensions->pretenureProfiler->getDroppedSampleCount());
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -517,6 +553,34 @@ MM_VerboseHandlerOutputStandard::handleScavengePercolateInternal(MM_EnvironmentB
 {
 	/* Empty stub */
 }
+
+void
+MM_VerboseHandlerOutputStandard::outputLearnedHotFields(MM_EnvironmentBase *env, uintptr_t indent, MM_ScavengerStats *scavengerStats, MM_HotFieldProfiler *hotFieldProfiler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	uintptr_t updatedClasses = scavengerStats->_learnedHotFieldClassesUpdated;
+	uintptr_t reportedClasses = OMR_MIN(updatedClasses, (uintptr_t)HOT_FIELD_PROFILE_REPORT_SIZE);
+
+	writer->formatAndOutput(env, indent, "<learned-hot-fields samples=\"%llu\" classes=\"%zu\" updated=\"%zu\" dropped=\"%zu\"%s>",
+			scavengerStats->_hotFieldSamples, scavengerStats->_learnedHotFieldClasses, updatedClasses,
+			hotFieldProfiler->getDroppedSampleCount(), (0 == reportedClasses) ? " /" : "");
+	if (0 != reportedClasses) {
+		for (uintptr_t i = 0; i < reportedClasses; i++) {
+			MM_HotFieldProfiler::ClassProfile *profile = hotFieldProfiler->getUpdatedClass(i);
+			/* each field is at most "255 " */
+			char fields[(4 * MAXIMUM_LEARNED_HOT_FIELD_COUNT) + 1];
+			uintptr_t length = 0;
+			fields[0] = '\0';
+			for (uintptr_t field = 0; field < profile->hotFieldCount; field++) {
+				length += omrstr_printf(fields + length, sizeof(fields) - length, (0 == field) ? "%u" : " %u", (unsigned int)profile->hotFields[field]);
+			}
+			writer->formatAndOutput(env, indent + 1, "<hot-field-class key=\"%p\" fields=\"%s\" samples=\"%zu\" />",
+					profile->key, fields, profile->samples);
+		}
+		writer->formatAndOutput(env, indent, "</learned-hot-fields>");
+	}
+}
 #endif /*defined(OMR_GC_MODRON_SCAVENGER) */
 
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -542,6 +606,21 @@ MM_VerboseHandlerOutputStandard::handleConcurrentMarkEnd(J9HookInterface** hook,
 			writer->formatAndOutput(env, 1, "<card-cleaning reason=\"%s\" bytesTraced=\"%zu\" cardsCleaned=\"%zu\" />", cardCleaningReasonString, (collectionStats->getConHelperCardCleanCount() + collectionStats->getCardCleanCount()), stats->_cardTableStats->getConcurrentCleanedCards());
 		}
 	}
+	if ((0 != collectionStats->getSATBPacketFlushCount()) || (0.0 != collectionStats->getSATBFilterRatio()) || (0 != collectionStats->getSATBEntriesKept())) {
+		writer->formatAndOutput(env, 1, "<satb-barrier packetsFlushed=\"%zu\" packetsPerFlush=\"%.2f\" entriesKept=\"%zu\" nullEntriesFiltered=\"%zu\" markedEntriesFiltered=\"%zu\" filterRatio=\"%.3f\" />",
+				collectionStats->getSATBPacketsFlushed(), collectionStats->getSATBPacketsPerFlush(), collectionStats->getSATBEntriesKept(),
+				collectionStats->getSATBNullEntriesFiltered(), collectionStats->getSATBMarkedEntriesFiltered(), collectionStats->getSATBFilterRatio());
+	}
+	if (_extensions->concurrentBackgroundMark) {
+		writer->formatAndOutput(env, 1, "<background-mark helperBytesTraced=\"%zu\" mutatorBytesTraced=\"%zu\" helperCPUTimeMs=\"%.3f\" throttled=\"%zu\" />",
+				collectionStats->getConHelperTraceSizeCount() + collectionStats->getConHelperCardCleanCount(), collectionStats->getTraceSizeCount() + collectionStats->getCardCleanCount(),
+				(double)collectionStats->getConHelperCPUTime() / 1000.0, collectionStats->getConHelperThrottleCount());
+	}
+	MM_ConcurrentPacer *pacer = collectionStats->getPacer();
+	if (NULL != pacer) {
+		writer->formatAndOutput(env, 1, "<concurrent-pacer correction=\"%.3f\" error=\"%.3f\" tracerate=\"%.3f\" cycles=\"%zu\" latecycles=\"%zu\" />",
+				pacer->getCorrection(), pacer->getError(), pacer->getObservedTraceRate(), pacer->getCycleCount(), pacer->getLateCycleCount());
+	}
 	handleGCOPOuterStanzaEnd(env);
 	writer->flush(env);
 }
@@ -612,6 +691,15 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
 			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
 
+	MM_CardTable *cardTable = _extensions->cardTable;
+	if ((NULL != cardTable) && cardTable->isSummaryEnabled()) {
+		MM_ConcurrentCardTableStats *cardTableStats = ((MM_ConcurrentCardTable *)cardTable)->getCardTableStats();
+		writer->formatAndOutput(
+				env, 1, "<card-cleaning-summary cardsScanned=\"%zu\" groupsSkipped=\"%zu\" partitions=\"%zu\" threadTimeUs=\"%llu\" />",
+				cardTableStats->getFinalCardsScanned(), cardTableStats->getFinalCardGroupsSkipped(), cardTableStats->getFinalCardPartitionsCleaned(),
+				omrtime_hires_delta(0, cardTableStats->getFinalCardCleaningTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -75,6 +75,15 @@ protected:
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	virtual void handleScavengeEndInternal(MM_EnvironmentBase* env, void* eventData);
 	virtual void handleScavengePercolateInternal(MM_EnvironmentBase* env, void* eventData);
+
+	/**
+	 * Output the hot fields learned by the Scavenger (-Xgc:learnHotFields), listing the classes whose hot fields changed.
+	 * @param env[in] the current thread
+	 * @param indent[in] indentation of the stanza
+	 * @param scavengerStats[in] the statistics of the scavenge that learned them
+	 * @param hotFieldProfiler[in] the profiler that learned them
+	 */
+	void outputLearnedHotFields(MM_EnvironmentBase *env, uintptr_t indent, MM_ScavengerStats *scavengerStats, MM_HotFieldProfiler *hotFieldProfiler);
 #endif /*defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	/**
@@ -344,6 +344,26 @@ uint32_t getCacheLineSize(void);
 void OMRZeroMemory(void *ptr, uintptr_t length);
 
 
+/**
+* @brief Zero memory with non-temporal (streaming) stores, which do not pull the zeroed
+* cache lines into the cache. Same as OMRZeroMemory where streaming stores are not available.
+* @param *ptr
+* @param length
+* @return void
+*/
+void OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length);
+
+
+/**
+* @brief Zero memory with rep stosb, which is fastest for large areas on x86 processors
+* reporting enhanced rep movsb/stosb (ERMS). Same as OMRZeroMemory on other architectures.
+* @param *ptr
+* @param length
+* @return void
+*/
+void OMRZeroMemoryRepStosb(void *ptr, uintptr_t length);
+
+
 /**
 * @brief
 * @param *dest
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Measures the latency of a GC thread synchronization point as a function of the number of threads,
+ * comparing the monitor protocol of MM_ParallelTask::synchronizeGCThreads() with the spin-then-park
+ * MM_ThreadBarrier used when -Xgc:spinParkBarrier is enabled.
+ *
+ * Usage: omrperfgcbarrier [iterations [maxThreads [spinCount]]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "ThreadBarrier.hpp"
+
+#define DEFAULT_ITERATIONS 20000
+#define DEFAULT_SPIN_COUNT 1024
+#define WARMUP_ITERATIONS 100
+
+enum BarrierKind {
+	barrier_monitor = 0,
+	barrier_spin_park
+};
+
+struct BenchmarkState {
+	BarrierKind kind;
+	uintptr_t threadCount;
+	uintptr_t iterations;
+
+	/* monitor protocol, as in MM_ParallelTask */
+	omrthread_monitor_t synchronizeMutex;
+	volatile uintptr_t synchronizeCount;
+	volatile uintptr_t synchronizeIndex;
+
+	MM_ThreadBarrier barrier;
+
+	omrthread_monitor_t doneMonitor;
+	uintptr_t runningThreads;
+};
+
+static void
+synchronizeWithMonitor(BenchmarkState *state)
+{
+	omrthread_monitor_enter(state->synchronizeMutex);
+	state->synchronizeCount += 1;
+	if (state->synchronizeCount == state->threadCount) {
+		state->synchronizeCount = 0;
+		state->synchronizeIndex += 1;
+		omrthread_monitor_notify_all(state->synchronizeMutex);
+	} else {
+		volatile uintptr_t index = state->synchronizeIndex;
+		do {
+			omrthread_monitor_wait(state->synchronizeMutex);
+		} while (index == state->synchronizeIndex);
+	}
+	omrthread_monitor_exit(state->synchronizeMutex);
+}
+
+static void
+runIterations(BenchmarkState *state, uintptr_t iterations)
+{
+	if (barrier_monitor == state->kind) {
+		for (uintptr_t i = 0; i < iterations; i++) {
+			synchronizeWithMonitor(state);
+		}
+	} else {
+		for (uintptr_t i = 0; i < iterations; i++) {
+			state->barrier.arriveAndWait((uint32_t)state->threadCount);
+		}
+	}
+}
+
+static int J9THREAD_PROC
+workerMain(void *arg)
+{
+	BenchmarkState *state = (BenchmarkState *)arg;
+
+	runIterations(state, WARMUP_ITERATIONS + state->iterations);
+
+	omrthread_monitor_enter(state->doneMonitor);
+	state->runningThreads -= 1;
+	omrthread_monitor_notify_all(state->doneMonitor);
+	omrthread_monitor_exit(state->doneMonitor);
+	return 0;
+}
+
+/**
+ * Run iterations synchronization points on threadCount threads, the calling thread being one of them.
+ * @return the mean time of a synchronization point in nanoseconds, or -1 on failure
+ */
+static double
+measure(OMRPortLibrary *portLibrary, BarrierKind kind, uintptr_t threadCount, uintptr_t iterations, uintptr_t spinCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	double result = -1.0;
+	BenchmarkState *state = new BenchmarkState();
+
+	state->kind = kind;
+	state->threadCount = threadCount;
+	state->iterations = iterations;
+	state->synchronizeCount = 0;
+	state->synchronizeIndex = 0;
+	state->runningThreads = threadCount - 1;
+
+	if ((0 == omrthread_monitor_init_with_name(&state->synchronizeMutex, 0, "gcBarrierBenchmark::synchronize"))
+		&& (0 == omrthread_monitor_init_with_name(&state->doneMonitor, 0, "gcBarrierBenchmark::done"))
+	) {
+		/* as in MM_ParallelDispatcher::prepareThreadsForTask(), only spin when every thread can be running at once */
+		if (threadCount > omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET)) {
+			spinCount = 0;
+		}
+		state->barrier.initialize(spinCount, state->synchronizeMutex);
+
+		bool started = true;
+		for (uintptr_t i = 1; i < threadCount; i++) {
+			omrthread_t thread = NULL;
+			if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, workerMain, state)) {
+				fprintf(stderr, "omrthread_create failed for thread %zu of %zu\n", i, threadCount);
+				started = false;
+				break;
+			}
+		}
+
+		if (started) {
+			runIterations(state, WARMUP_ITERATIONS);
+			uint64_t startTime = omrtime_hires_clock();
+			runIterations(state, iterations);
+			uint64_t endTime = omrtime_hires_clock();
+			result = (double)omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_NANOSECONDS) / (double)iterations;
+
+			omrthread_monitor_enter(state->doneMonitor);
+			while (0 != state->runningThreads) {
+				omrthread_monitor_wait(state->doneMonitor);
+			}
+			omrthread_monitor_exit(state->doneMonitor);
+		}
+
+		omrthread_monitor_destroy(state->doneMonitor);
+		omrthread_monitor_destroy(state->synchronizeMutex);
+	}
+
+	delete state;
+	return result;
+}
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	uintptr_t iterations = (argc > 1) ? (uintptr_t)atol(argv[1]) : DEFAULT_ITERATIONS;
+	uintptr_t maxThreads = (argc > 2) ? (uintptr_t)atol(argv[2]) : 0;
+	uintptr_t spinCount = (argc > 3) ? (uintptr_t)atol(argv[3]) : DEFAULT_SPIN_COUNT;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	if (0 == iterations) {
+		iterations = DEFAULT_ITERATIONS;
+	}
+	if (0 == maxThreads) {
+		/* oversubscribe by default, the park path matters most when there are more GC threads than CPUs */
+		maxThreads = 2 * OMR_MAX((uintptr_t)2, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+	}
+
+	printf("GC thread synchronization latency: %zu iterations, spin count %zu, %zu online CPUs\n",
+		iterations, spinCount, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+	printf("%8s %16s %16s %10s\n", "threads", "monitor ns", "spin-park ns", "speedup");
+
+	int result = 0;
+	for (uintptr_t threadCount = 2; threadCount <= maxThreads; threadCount *= 2) {
+		double monitorLatency = measure(&portLibrary, barrier_monitor, threadCount, iterations, spinCount);
+		double barrierLatency = measure(&portLibrary, barrier_spin_park, threadCount, iterations, spinCount);
+		if ((monitorLatency < 0.0) || (barrierLatency < 0.0)) {
+			result = -1;
+			break;
+		}
+		printf("%8zu %16.1f %16.1f %9.2fx\n", threadCount, monitorLatency, barrierLatency, monitorLatency / barrierLatency);
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return result;
+}
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Replays the concurrent mark cycles of verbose GC logs through the fixed kickoff tuning and through the
+ * concurrent pacer (-Xgc:concurrentPacer), and compares how many cycles of each ran out of free space before
+ * tracing completed, and how much free space the others left.
+ *
+ * Every cycle of a log gives its trace target, the kickoff threshold of the fixed tuning, the free space at
+ * kickoff and at the global collection that ended it, and the bytes it traced. The bytes traced per byte of free
+ * space allocated is the rate the mutators and helpers of the cycle achieved; a policy kicking off at threshold K
+ * is taken to have completed the cycle if tracing the target at that rate fits in K, leaving the rest as slack.
+ * Cycles that traced nothing, typically because they were aborted during initialization, cannot complete under
+ * either policy but still feed the pacer.
+ *
+ * Logs should be taken without -Xgc:concurrentPacer, so that they hold the thresholds of the fixed tuning.
+ *
+ * Usage: omrperfgcconcurrentpacer [-slack=<percent>] [-maxTraceRate=<rate>] <verbose log>...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "pugixml.hpp"
+
+#include "ConcurrentPacer.hpp"
+
+#define DEFAULT_SLACK_PERCENT 5
+/* allocation to trace rate the most heavily taxed mutators trace at, at the default concurrent level of 8 */
+#define DEFAULT_MAXIMUM_TRACE_RATE ((float)16.0)
+/* as CONCURRENT_KICKOFF_THRESHOLD_BOOST, the part of the fixed threshold that is reserve */
+#define KICKOFF_THRESHOLD_BOOST ((float)1.10)
+
+struct ConcurrentCycle {
+	uintptr_t traceTarget;
+	uintptr_t kickoffThreshold;
+	uintptr_t freeAtKickoff;
+	uintptr_t freeAtCollection;
+	uintptr_t traced;
+	bool aborted;
+};
+
+struct PolicyResult {
+	uintptr_t cycles;
+	uintptr_t lateCycles;
+	double totalSlack;
+};
+
+static uintptr_t
+attributeValue(pugi::xml_node node, const char *name)
+{
+	return (uintptr_t)strtoull(node.attribute(name).value(), NULL, 10);
+}
+
+/**
+ * Collect the cycles of a log that were kicked off, in order. Global collections that found no cycle kicked off
+ * are only counted.
+ */
+static bool
+readCycles(const char *fileName, std::vector<ConcurrentCycle> *cycles, uintptr_t *missedKickoffs)
+{
+	pugi::xml_document doc;
+	pugi::xml_parse_result result = doc.load_file(fileName);
+	if (!result) {
+		fprintf(stderr, "%s: %s\n", fileName, result.description());
+		return false;
+	}
+
+	ConcurrentCycle cycle;
+	bool kickedOff = false;
+	for (pugi::xml_node node = doc.child("verbosegc").first_child(); node; node = node.next_sibling()) {
+		if (0 == strcmp(node.name(), "concurrent-kickoff")) {
+			pugi::xml_node kickoff = node.child("kickoff");
+			memset(&cycle, 0, sizeof(cycle));
+			cycle.traceTarget = attributeValue(kickoff, "targetBytes");
+			cycle.kickoffThreshold = attributeValue(kickoff, "thresholdFreeBytes");
+			cycle.freeAtKickoff = attributeValue(kickoff, "remainingFree");
+			kickedOff = true;
+		} else if (kickedOff && (0 == strcmp(node.name(), "gc-op")) && (0 == strcmp(node.attribute("type").value(), "trace"))) {
+			cycle.traced = attributeValue(node.child("trace"), "bytesTraced");
+		} else if (kickedOff && (0 == strcmp(node.name(), "concurrent-aborted"))) {
+			cycle.aborted = true;
+		} else if ((0 == strcmp(node.name(), "gc-start")) && (0 == strcmp(node.attribute("type").value(), "global"))) {
+			if (kickedOff) {
+				pugi::xml_node memInfo = node.child("mem-info");
+				pugi::xml_node tenure = memInfo.find_child_by_attribute("mem", "type", "tenure");
+				cycle.freeAtCollection = attributeValue(tenure ? tenure : memInfo, "free");
+				cycles->push_back(cycle);
+				kickedOff = false;
+			} else {
+				*missedKickoffs += 1;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * @return free space the cycle needs to trace its target at the rate it achieved, 0 if it traced nothing
+ */
+static uintptr_t
+freeSpaceNeeded(const ConcurrentCycle *cycle)
+{
+	uintptr_t freeConsumed = (cycle->freeAtKickoff > cycle->freeAtCollection) ? (cycle->freeAtKickoff - cycle->freeAtCollection) : 0;
+	if ((0 == cycle->traced) || (0 == freeConsumed)) {
+		return 0;
+	}
+	double traceRate = (double)cycle->traced / (double)freeConsumed;
+	return (uintptr_t)((double)cycle->traceTarget / traceRate);
+}
+
+static void
+replayCycle(const ConcurrentCycle *cycle, uintptr_t kickoffThreshold, PolicyResult *result, MM_ConcurrentPacer *pacer)
+{
+	uintptr_t needed = freeSpaceNeeded(cycle);
+	bool late = (0 == needed) || (needed > kickoffThreshold);
+
+	result->cycles += 1;
+	if (late) {
+		result->lateCycles += 1;
+	} else {
+		result->totalSlack += (double)(kickoffThreshold - needed) / (double)kickoffThreshold;
+	}
+
+	if (NULL != pacer) {
+		pacer->startCycle(kickoffThreshold, cycle->traceTarget);
+		if (late) {
+			uintptr_t traced = (0 == needed) ? 0 : (uintptr_t)((double)cycle->traceTarget * (double)kickoffThreshold / (double)needed);
+			pacer->endCycle(traced);
+		} else {
+			pacer->completeCycle(kickoffThreshold - needed);
+			pacer->endCycle(cycle->traceTarget);
+		}
+	}
+}
+
+static void
+printResult(const char *policy, PolicyResult *result)
+{
+	uintptr_t completed = result->cycles - result->lateCycles;
+	printf("  %-8s cycles=%zu late=%zu averageSlack=%.1f%%\n", policy, (size_t)result->cycles, (size_t)result->lateCycles,
+			(0 == completed) ? 0.0 : (100.0 * result->totalSlack / (double)completed));
+}
+
+int
+main(int argc, char **argv)
+{
+	uintptr_t slackPercent = DEFAULT_SLACK_PERCENT;
+	float maximumTraceRate = DEFAULT_MAXIMUM_TRACE_RATE;
+	int logCount = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strncmp(argv[i], "-slack=", strlen("-slack="))) {
+			slackPercent = (uintptr_t)atoi(argv[i] + strlen("-slack="));
+		} else if (0 == strncmp(argv[i], "-maxTraceRate=", strlen("-maxTraceRate="))) {
+			maximumTraceRate = (float)atof(argv[i] + strlen("-maxTraceRate="));
+		} else {
+			logCount += 1;
+		}
+	}
+	if (0 == logCount) {
+		fprintf(stderr, "Usage: %s [-slack=<percent>] [-maxTraceRate=<rate>] <verbose log>...\n", argv[0]);
+		return 1;
+	}
+
+	int rc = 0;
+	for (int i = 1; i < argc; i++) {
+		if ('-' == argv[i][0]) {
+			continue;
+		}
+
+		std::vector<ConcurrentCycle> cycles;
+		uintptr_t missedKickoffs = 0;
+		if (!readCycles(argv[i], &cycles, &missedKickoffs)) {
+			rc = 1;
+			continue;
+		}
+
+		uintptr_t abortedCycles = 0;
+		PolicyResult fixed = {0, 0, 0.0};
+		PolicyResult paced = {0, 0, 0.0};
+		MM_ConcurrentPacer pacer(slackPercent);
+		for (std::vector<ConcurrentCycle>::iterator cycle = cycles.begin(); cycle != cycles.end(); ++cycle) {
+			if (cycle->aborted) {
+				abortedCycles += 1;
+			}
+			replayCycle(&*cycle, cycle->kickoffThreshold, &fixed, NULL);
+
+			uintptr_t tunedReserve = cycle->kickoffThreshold - (uintptr_t)((float)cycle->kickoffThreshold / KICKOFF_THRESHOLD_BOOST);
+			uintptr_t pacedThreshold = pacer.getKickoffThreshold(cycle->traceTarget, cycle->kickoffThreshold, tunedReserve, maximumTraceRate);
+			replayCycle(&*cycle, pacedThreshold, &paced, &pacer);
+		}
+
+		printf("%s: %zu concurrent cycles, %zu aborted, %zu global collections without kickoff\n", argv[i], cycles.size(), (size_t)abortedCycles, (size_t)missedKickoffs);
+		printResult("fixed", &fixed);
+		printResult("paced", &paced);
+		printf("  pacer    correction=%.3f tracerate=%.3f\n", pacer.getCorrection(), pacer.getObservedTraceRate());
+	}
+
+	return rc;
+}
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Measures the time the sweep spends walking the mark map of a heap, per GB of heap, with every
+ * MM_HeapMapScanner kernel the processor supports. Mark maps are synthesized with live objects starting
+ * in a given fraction of the mark map words, and walked the way MM_ParallelSweepScheme::sweepChunk()
+ * finds its free ranges (free list construction itself is not included).
+ *
+ * Usage: omrperfgcmarkmap [heapMB [repetitions]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "HeapMap.hpp"
+#include "HeapMapScanner.hpp"
+
+#define DEFAULT_HEAP_MB 1024
+#define DEFAULT_REPETITIONS 5
+
+struct MarkMapPattern {
+	const char *name;
+	uintptr_t liveWordPeriod; /**< One mark map word in liveWordPeriod (on average) has a live object, 0 for none */
+};
+
+static const MarkMapPattern patterns[] = {
+	{"empty", 0},
+	{"1/65536", 65536},
+	{"1/4096", 4096},
+	{"1/256", 256},
+	{"1/16", 16},
+	{"1/2", 2},
+	{"full", 1}
+};
+
+struct SweepResult {
+	uintptr_t freeRanges;
+	uintptr_t freeWords;
+};
+
+static void
+populateMarkMap(uintptr_t *markMap, uintptr_t markMapWords, uintptr_t liveWordPeriod)
+{
+	uint64_t seed = 0x9E3779B97F4A7C15ULL;
+	memset(markMap, 0, markMapWords * sizeof(uintptr_t));
+	if (0 != liveWordPeriod) {
+		for (uintptr_t i = 0; i < markMapWords; i++) {
+			/* xorshift64, so that every run of the benchmark walks the same map */
+			seed ^= seed << 13;
+			seed ^= seed >> 7;
+			seed ^= seed << 17;
+			if (0 == (seed % liveWordPeriod)) {
+				markMap[i] = (uintptr_t)1 << (seed % J9BITS_BITS_IN_SLOT);
+			}
+		}
+	}
+}
+
+/**
+ * Find the free ranges of the map as the sweep does: a range is a run of empty words, extended by the
+ * sweep into its neighbouring words with a single bit scan each, which is left out here.
+ */
+static SweepResult
+sweepMarkMap(MM_HeapMapScanner::FindNonEmptyWordFunction findNonEmptyWord, uintptr_t *markMap, uintptr_t *markMapTop)
+{
+	SweepResult result = {0, 0};
+	uintptr_t *markMapCurrent = markMap;
+	while (markMapCurrent < markMapTop) {
+		if (0 == *markMapCurrent) {
+			uintptr_t *markMapFreeHead = markMapCurrent;
+			/* as MM_HeapMapScanner::findNonEmptyWord(), with the kernel under test */
+			markMapCurrent += 1;
+			if ((markMapCurrent < markMapTop) && (0 == *markMapCurrent)) {
+				markMapCurrent = findNonEmptyWord(markMapCurrent + 1, markMapTop);
+			}
+			result.freeRanges += 1;
+			result.freeWords += markMapCurrent - markMapFreeHead;
+		} else {
+			markMapCurrent += 1;
+		}
+	}
+	return result;
+}
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	uintptr_t heapMB = (argc > 1) ? (uintptr_t)atol(argv[1]) : DEFAULT_HEAP_MB;
+	uintptr_t repetitions = (argc > 2) ? (uintptr_t)atol(argv[2]) : DEFAULT_REPETITIONS;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	if (0 == heapMB) {
+		heapMB = DEFAULT_HEAP_MB;
+	}
+	if (0 == repetitions) {
+		repetitions = DEFAULT_REPETITIONS;
+	}
+
+	uintptr_t heapBytes = heapMB * 1024 * 1024;
+	uintptr_t markMapWords = heapBytes / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+	uintptr_t *markMap = (uintptr_t *)omrmem_allocate_memory(markMapWords * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == markMap) {
+		fprintf(stderr, "failed to allocate the mark map of a %zuMB heap\n", heapMB);
+		return -1;
+	}
+
+	bool supported[MM_HeapMapScanner::kernel_count];
+	for (intptr_t kernel = 0; kernel < MM_HeapMapScanner::kernel_count; kernel++) {
+		supported[kernel] = MM_HeapMapScanner::isKernelSupported(&portLibrary, (MM_HeapMapScanner::Kernel)kernel);
+	}
+
+	printf("Mark map walk of a %zuMB heap (%zu map words), best of %zu, ms per GB of heap; selected kernel: %s\n",
+		heapMB, markMapWords, repetitions, MM_HeapMapScanner::getKernelName(MM_HeapMapScanner::selectKernel(&portLibrary)));
+	printf("%10s %12s", "live words", "free ranges");
+	for (intptr_t kernel = 0; kernel < MM_HeapMapScanner::kernel_count; kernel++) {
+		if (supported[kernel]) {
+			printf(" %10s", MM_HeapMapScanner::getKernelName((MM_HeapMapScanner::Kernel)kernel));
+		}
+	}
+	printf(" %10s\n", "speedup");
+
+	int result = 0;
+	double gigabytes = (double)heapBytes / (1024.0 * 1024.0 * 1024.0);
+	for (uintptr_t i = 0; (0 == result) && (i < sizeof(patterns) / sizeof(patterns[0])); i++) {
+		populateMarkMap(markMap, markMapWords, patterns[i].liveWordPeriod);
+
+		SweepResult expected = sweepMarkMap(MM_HeapMapScanner::getKernelFunction(MM_HeapMapScanner::kernel_scalar), markMap, markMap + markMapWords);
+		printf("%10s %12zu", patterns[i].name, expected.freeRanges);
+
+		double scalarTime = 0.0;
+		double widestTime = 0.0;
+		for (intptr_t kernel = 0; kernel < MM_HeapMapScanner::kernel_count; kernel++) {
+			if (!supported[kernel]) {
+				continue;
+			}
+			MM_HeapMapScanner::FindNonEmptyWordFunction function = MM_HeapMapScanner::getKernelFunction((MM_HeapMapScanner::Kernel)kernel);
+			double kernelTime = 0.0;
+			for (uintptr_t repetition = 0; repetition < repetitions; repetition++) {
+				uint64_t startTime = omrtime_hires_clock();
+				SweepResult actual = sweepMarkMap(function, markMap, markMap + markMapWords);
+				uint64_t endTime = omrtime_hires_clock();
+				if ((actual.freeRanges != expected.freeRanges) || (actual.freeWords != expected.freeWords)) {
+					fprintf(stderr, "\n%s kernel found %zu free ranges of %zu words, expected %zu of %zu\n",
+						MM_HeapMapScanner::getKernelName((MM_HeapMapScanner::Kernel)kernel),
+						actual.freeRanges, actual.freeWords, expected.freeRanges, expected.freeWords);
+					result = -1;
+				}
+				double time = (double)omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0 / gigabytes;
+				if ((0 == repetition) || (time < kernelTime)) {
+					kernelTime = time;
+				}
+			}
+			if (MM_HeapMapScanner::kernel_scalar == kernel) {
+				scalarTime = kernelTime;
+			}
+			/* kernels are ordered by vector width, the last supported one is the one selectKernel() picks */
+			widestTime = kernelTime;
+			printf(" %10.3f", kernelTime);
+		}
+		printf(" %9.2fx\n", (widestTime > 0.0) ? (scalarTime / widestTime) : 1.0);
+	}
+
+	omrmem_free_memory(markMap);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return result;
+}
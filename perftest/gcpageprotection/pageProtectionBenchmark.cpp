@@ -0,0 +1,371 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Compares the pauses of a stop-the-world scavenge with those of a concurrent scavenge that would trap mutator
+ * accesses to evacuating memory with page protection instead of read barriers, and the mutator costs of both.
+ *
+ * A nursery of objects with one reference each is evacuated from a set of roots the way the scavenger does,
+ * breadth first into a survivor space with forwarding pointers in the headers, which is the pause of a
+ * stop-the-world scavenge. A page protecting scavenge only pauses to protect the evacuating nursery with
+ * omrmmap_protect, and to unprotect it once concurrent evacuation completes. Its mutators instead pay for a
+ * trap, taken through omrsig_protect() and healed by unprotecting the page, the first time they touch each
+ * evacuating page, where a concurrent scavenge with read barriers has them compare every reference they load
+ * with the evacuate range.
+ *
+ * -Xgc:concurrentScavengePageProtection implements the scheme in the scavenger, protecting the copy destinations
+ * rather than the evacuate space, since mutators there keep reading objects that have not been copied yet.
+ *
+ * Usage: omrperfgcpageprotection [maxNurseryMB [rootsPerMille]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#define DEFAULT_MAX_NURSERY_MB 256
+#define DEFAULT_ROOTS_PER_MILLE 20
+/* objects ending a reference chain, per thousand */
+#define NULL_REFERENCES_PER_MILLE 250
+#define FORWARDED_TAG ((uintptr_t)1)
+/* traversals timed with and without the read barrier, the fastest of which are compared */
+#define TRAVERSAL_REPEATS 20
+
+/**
+ * A nursery object: a header, which holds the forwarding pointer once the object is evacuated, a reference,
+ * and a body which is copied along.
+ */
+struct BenchmarkObject {
+	uintptr_t header;
+	BenchmarkObject *reference;
+	uintptr_t body[6];
+};
+
+struct Nursery {
+	uint8_t *base;
+	uintptr_t size;
+	J9PortVmemIdentifier identifier;
+	uintptr_t objectCount;
+	BenchmarkObject **roots;
+	uintptr_t rootCount;
+};
+
+struct TrapState {
+	uint8_t *base;
+	uintptr_t size;
+	uintptr_t pageSize;
+	uintptr_t traps;
+	uintptr_t unhandled;
+};
+
+/**
+ * Lay out a nursery of objects, each referencing a random object or nothing, and pick the roots.
+ */
+static void
+fillNursery(Nursery *nursery, uintptr_t rootsPerMille)
+{
+	BenchmarkObject *objects = (BenchmarkObject *)nursery->base;
+	uint32_t seed = 12345;
+
+	nursery->objectCount = nursery->size / sizeof(BenchmarkObject);
+	for (uintptr_t i = 0; i < nursery->objectCount; i++) {
+		seed = (seed * 1103515245) + 12345;
+		uintptr_t random = (uintptr_t)(seed >> 8);
+		objects[i].header = i << 1;
+		objects[i].reference = ((random % 1000) < NULL_REFERENCES_PER_MILLE) ? NULL : &objects[random % nursery->objectCount];
+		for (uintptr_t word = 0; word < (sizeof(objects[i].body) / sizeof(uintptr_t)); word++) {
+			objects[i].body[word] = i;
+		}
+	}
+
+	nursery->rootCount = 0;
+	for (uintptr_t i = 0; i < nursery->objectCount; i++) {
+		seed = (seed * 1103515245) + 12345;
+		if (((seed >> 8) % 1000) < rootsPerMille) {
+			nursery->roots[nursery->rootCount] = &objects[i];
+			nursery->rootCount += 1;
+		}
+	}
+}
+
+static BenchmarkObject *
+forward(BenchmarkObject *object, BenchmarkObject **copyAlloc)
+{
+	if (FORWARDED_TAG == (object->header & FORWARDED_TAG)) {
+		return (BenchmarkObject *)(object->header & ~FORWARDED_TAG);
+	}
+	BenchmarkObject *copy = *copyAlloc;
+	*copyAlloc += 1;
+	memcpy(copy, object, sizeof(BenchmarkObject));
+	object->header = (uintptr_t)copy | FORWARDED_TAG;
+	return copy;
+}
+
+/**
+ * Evacuate the objects reachable from the roots into survivor, breadth first.
+ * @return the bytes evacuated
+ */
+static uintptr_t
+evacuate(Nursery *nursery, uint8_t *survivor)
+{
+	BenchmarkObject *scan = (BenchmarkObject *)survivor;
+	BenchmarkObject *copyAlloc = (BenchmarkObject *)survivor;
+
+	for (uintptr_t i = 0; i < nursery->rootCount; i++) {
+		nursery->roots[i] = forward(nursery->roots[i], &copyAlloc);
+	}
+	while (scan < copyAlloc) {
+		if (NULL != scan->reference) {
+			scan->reference = forward(scan->reference, &copyAlloc);
+		}
+		scan += 1;
+	}
+
+	return (uintptr_t)copyAlloc - (uintptr_t)survivor;
+}
+
+/**
+ * Follow the reference chain of every root, the way a mutator loads references.
+ * @param barrier[in] whether every loaded reference is compared with [evacuateBase, evacuateTop)
+ * @return the references loaded
+ */
+static uintptr_t
+traverse(Nursery *nursery, bool barrier, uint8_t *evacuateBase, uint8_t *evacuateTop, uintptr_t *slowPaths)
+{
+	uintptr_t loads = 0;
+	uintptr_t maxChain = 64;
+
+	for (uintptr_t i = 0; i < nursery->rootCount; i++) {
+		BenchmarkObject *object = nursery->roots[i];
+		for (uintptr_t link = 0; (NULL != object) && (link < maxChain); link++) {
+			BenchmarkObject *next = object->reference;
+			if (barrier && ((uint8_t *)next >= evacuateBase) && ((uint8_t *)next < evacuateTop)) {
+				/* never taken once evacuation is complete */
+				*slowPaths += 1;
+			}
+			object = next;
+			loads += 1;
+		}
+	}
+	return loads;
+}
+
+static uintptr_t
+trapHandler(OMRPortLibrary *portLibrary, uint32_t gpType, void *gpInfo, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	TrapState *state = (TrapState *)userData;
+	const char *name = NULL;
+	void *value = NULL;
+
+	if (OMRPORT_SIG_VALUE_ADDRESS == omrsig_info(gpInfo, OMRPORT_SIG_SIGNAL, OMRPORT_SIG_SIGNAL_INACCESSIBLE_ADDRESS, &name, &value)) {
+		uint8_t *address = *(uint8_t **)value;
+		if ((address >= state->base) && (address < (state->base + state->size))) {
+			/* heal the page, as the scavenger would once the objects of the page have been evacuated */
+			uint8_t *page = (uint8_t *)((uintptr_t)address & ~(state->pageSize - 1));
+			if (0 == omrmmap_protect(page, state->pageSize, OMRPORT_PAGE_PROTECT_READ | OMRPORT_PAGE_PROTECT_WRITE)) {
+				state->traps += 1;
+				return OMRPORT_SIG_EXCEPTION_CONTINUE_EXECUTION;
+			}
+		}
+	}
+	state->unhandled += 1;
+	return OMRPORT_SIG_EXCEPTION_RETURN;
+}
+
+/**
+ * Read the first word of every page, each of which traps while the nursery is protected.
+ */
+static uintptr_t
+touchPages(OMRPortLibrary *portLibrary, void *arg)
+{
+	TrapState *state = (TrapState *)arg;
+	uintptr_t sum = 0;
+	for (uintptr_t offset = 0; offset < state->size; offset += state->pageSize) {
+		sum += *(volatile uintptr_t *)(state->base + offset);
+	}
+	return sum;
+}
+
+static double
+elapsedMillis(OMRPortLibrary *portLibrary, uint64_t startTime, uint64_t endTime)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	return (double)omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0;
+}
+
+/**
+ * Measure the pauses and mutator costs for a nursery of nurseryMB, printing one line of the report.
+ * @return false on failure
+ */
+static bool
+measure(OMRPortLibrary *portLibrary, uintptr_t nurseryMB, uintptr_t rootsPerMille, uintptr_t pageSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool result = false;
+	Nursery nursery;
+	J9PortVmemIdentifier survivorIdentifier;
+
+	memset(&nursery, 0, sizeof(nursery));
+	nursery.size = nurseryMB * 1024 * 1024;
+	nursery.roots = (BenchmarkObject **)omrmem_allocate_memory((nursery.size / sizeof(BenchmarkObject)) * sizeof(BenchmarkObject *), OMRMEM_CATEGORY_MM);
+	uintptr_t mode = OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+	nursery.base = (uint8_t *)omrvmem_reserve_memory(NULL, nursery.size, &nursery.identifier, mode, pageSize, OMRMEM_CATEGORY_MM);
+	uint8_t *survivor = (uint8_t *)omrvmem_reserve_memory(NULL, nursery.size, &survivorIdentifier, mode, pageSize, OMRMEM_CATEGORY_MM);
+
+	if ((NULL == nursery.roots) || (NULL == nursery.base) || (NULL == survivor)) {
+		fprintf(stderr, "failed to reserve a %zu MB nursery\n", nurseryMB);
+	} else {
+		fillNursery(&nursery, rootsPerMille);
+		/* fault in the survivor space, as a nursery in use would be */
+		memset(survivor, 0, nursery.size);
+
+		/* read barrier cost, against the evacuate range of a cycle in progress */
+		uintptr_t slowPaths = 0;
+		uintptr_t loads = traverse(&nursery, false, NULL, NULL, &slowPaths);
+		uint64_t plainTime = UINT64_MAX;
+		uint64_t barrierTime = UINT64_MAX;
+		uint64_t startTime = 0;
+		for (uintptr_t repeat = 0; repeat < (2 * TRAVERSAL_REPEATS); repeat++) {
+			/* alternate which traversal goes first, so neither benefits from the other warming the caches */
+			bool barrier = (0 != ((repeat ^ (repeat >> 1)) & 1));
+			startTime = omrtime_hires_clock();
+			traverse(&nursery, barrier, survivor, survivor + nursery.size, &slowPaths);
+			uint64_t time = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+			if (barrier) {
+				barrierTime = OMR_MIN(barrierTime, time);
+			} else {
+				plainTime = OMR_MIN(plainTime, time);
+			}
+		}
+		double plainNanos = (double)plainTime / (double)loads;
+		double barrierNanos = (double)barrierTime / (double)loads;
+
+		/* page protection pauses, and the trap taken on the first touch of each evacuating page */
+		TrapState state;
+		state.base = nursery.base;
+		state.size = nursery.size;
+		state.pageSize = pageSize;
+		state.traps = 0;
+		state.unhandled = 0;
+		startTime = omrtime_hires_clock();
+		intptr_t protectRC = omrmmap_protect(nursery.base, nursery.size, OMRPORT_PAGE_PROTECT_NONE);
+		uint64_t protectedTime = omrtime_hires_clock();
+		uintptr_t touched = 0;
+		int32_t trapRC = omrsig_protect(touchPages, &state, trapHandler, &state,
+			OMRPORT_SIG_FLAG_SIGSEGV | OMRPORT_SIG_FLAG_SIGBUS | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION | OMRPORT_SIG_FLAG_MAY_RETURN, &touched);
+		uint64_t trappedTime = omrtime_hires_clock();
+		/* the pages left protected by a cycle are unprotected when it ends */
+		omrmmap_protect(nursery.base, nursery.size, OMRPORT_PAGE_PROTECT_NONE);
+		uint64_t reprotectedTime = omrtime_hires_clock();
+		intptr_t unprotectRC = omrmmap_protect(nursery.base, nursery.size, OMRPORT_PAGE_PROTECT_READ | OMRPORT_PAGE_PROTECT_WRITE);
+		uint64_t unprotectedTime = omrtime_hires_clock();
+
+		/* the stop-the-world scavenge */
+		startTime = omrtime_hires_clock();
+		uintptr_t liveBytes = evacuate(&nursery, survivor);
+		uint64_t evacuatedTime = omrtime_hires_clock();
+
+		if ((0 != protectRC) || (0 != unprotectRC)) {
+			fprintf(stderr, "omrmmap_protect failed for a %zu MB nursery\n", nurseryMB);
+		} else if ((0 != trapRC) || (0 != state.unhandled) || (state.traps != (nursery.size / pageSize))) {
+			fprintf(stderr, "%zu of %zu page traps were handled, rc=%d\n", state.traps, nursery.size / pageSize, (int)trapRC);
+		} else if (0 != slowPaths) {
+			fprintf(stderr, "the read barrier took its slow path outside the evacuate range\n");
+		} else {
+			double trapMicros = (elapsedMillis(portLibrary, protectedTime, trappedTime) * 1000.0) / (double)state.traps;
+			printf("%8zu %9.1f %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", nurseryMB, (double)liveBytes / (1024.0 * 1024.0),
+				elapsedMillis(portLibrary, startTime, evacuatedTime),
+				elapsedMillis(portLibrary, trappedTime, reprotectedTime),
+				elapsedMillis(portLibrary, reprotectedTime, unprotectedTime),
+				trapMicros, plainNanos, barrierNanos);
+			result = true;
+		}
+	}
+
+	if (NULL != survivor) {
+		omrvmem_free_memory(survivor, nursery.size, &survivorIdentifier);
+	}
+	if (NULL != nursery.base) {
+		omrvmem_free_memory(nursery.base, nursery.size, &nursery.identifier);
+	}
+	if (NULL != nursery.roots) {
+		omrmem_free_memory(nursery.roots);
+	}
+	return result;
+}
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	uintptr_t maxNurseryMB = (argc > 1) ? (uintptr_t)atol(argv[1]) : DEFAULT_MAX_NURSERY_MB;
+	uintptr_t rootsPerMille = (argc > 2) ? (uintptr_t)atol(argv[2]) : DEFAULT_ROOTS_PER_MILLE;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	if (0 == maxNurseryMB) {
+		maxNurseryMB = DEFAULT_MAX_NURSERY_MB;
+	}
+	if ((0 == rootsPerMille) || (rootsPerMille > 1000)) {
+		rootsPerMille = DEFAULT_ROOTS_PER_MILLE;
+	}
+
+	int result = 0;
+	uintptr_t pageSize = omrvmem_supported_page_sizes()[0];
+	uint32_t sigFlags = OMRPORT_SIG_FLAG_SIGSEGV | OMRPORT_SIG_FLAG_SIGBUS | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION | OMRPORT_SIG_FLAG_MAY_RETURN;
+	if (0 == omrsig_can_protect(sigFlags)) {
+		printf("Page traps can not be resumed on this platform\n");
+	} else {
+		printf("Scavenge pauses and mutator costs: %zu roots per thousand objects, %zu byte pages, %zu online CPUs\n",
+			rootsPerMille, pageSize, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+		printf("%8s %9s %10s %10s %10s %10s %10s %10s\n", "nursery", "live", "STW pause", "protect", "unprotect", "trap", "load", "barrier");
+		printf("%8s %9s %10s %10s %10s %10s %10s %10s\n", "MB", "MB", "ms", "ms", "ms", "us/page", "ns", "ns/load");
+		for (uintptr_t nurseryMB = 16; nurseryMB <= maxNurseryMB; nurseryMB *= 4) {
+			if (!measure(&portLibrary, nurseryMB, rootsPerMille, pageSize)) {
+				result = -1;
+				break;
+			}
+		}
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return result;
+}
@@ -0,0 +1,327 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Measures the region refill throughput of the segregated heap as a function of the number of allocating
+ * threads, comparing the monitor protocol of MM_LockingHeapRegionQueue with the MM_LockFreeRegionStack used
+ * by MM_LockFreeHeapRegionQueue when -Xgc:lockFreeRegionQueues is enabled. Every refill takes a region from
+ * a queue shared by all threads, as MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass() does, and
+ * gives it back once it is "full".
+ *
+ * Usage: omrperfgcregionqueue [refillsPerThread [maxThreads [regions]]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "LockFreeRegionStack.hpp"
+
+#define DEFAULT_REFILLS_PER_THREAD 100000
+#define DEFAULT_MAX_THREADS 64
+#define DEFAULT_REGIONS 1024
+
+enum QueueKind {
+	queue_monitor = 0,
+	queue_lock_free
+};
+
+/**
+ * Stands for MM_HeapRegionDescriptorSegregated, the size of which spreads descriptors over cache lines the same way.
+ */
+class BenchmarkRegion
+{
+private:
+	BenchmarkRegion *_prev;
+	BenchmarkRegion *_next;
+	uint8_t _descriptor[240];
+
+public:
+	volatile uintptr_t owner; /**< Thread holding the region, 0 while it is on the queue */
+
+	BenchmarkRegion *getNext() { return _next; }
+	void setNext(BenchmarkRegion *next) { _next = next; }
+	BenchmarkRegion *getPrev() { return _prev; }
+	void setPrev(BenchmarkRegion *prev) { _prev = prev; }
+
+	void
+	reset()
+	{
+		_prev = NULL;
+		_next = NULL;
+		owner = 0;
+	}
+};
+
+/**
+ * The queue of MM_LockingHeapRegionQueue, with the same monitor protocol.
+ */
+struct MonitorQueue {
+	BenchmarkRegion *head;
+	BenchmarkRegion *tail;
+	volatile uintptr_t length;
+	omrthread_monitor_t lockMonitor;
+
+	void
+	enqueue(BenchmarkRegion *region)
+	{
+		omrthread_monitor_enter(lockMonitor);
+		if (NULL == head) {
+			head = tail = region;
+		} else {
+			tail->setNext(region);
+			region->setPrev(tail);
+			tail = region;
+		}
+		length += 1;
+		omrthread_monitor_exit(lockMonitor);
+	}
+
+	BenchmarkRegion *
+	dequeueIfNonEmpty()
+	{
+		BenchmarkRegion *region = NULL;
+		if (0 != length) {
+			omrthread_monitor_enter(lockMonitor);
+			region = head;
+			if (NULL != region) {
+				length -= 1;
+				head = region->getNext();
+				region->setNext(NULL);
+				if (NULL == head) {
+					tail = NULL;
+				} else {
+					head->setPrev(NULL);
+				}
+			}
+			omrthread_monitor_exit(lockMonitor);
+		}
+		return region;
+	}
+};
+
+struct BenchmarkState {
+	QueueKind kind;
+	uintptr_t refillsPerThread;
+	MonitorQueue monitorQueue;
+	MM_LockFreeRegionStack<BenchmarkRegion> lockFreeQueue;
+
+	omrthread_monitor_t controlMonitor;
+	uintptr_t readyThreads;
+	uintptr_t runningThreads;
+	volatile uintptr_t started;
+	volatile uintptr_t errors;
+};
+
+static MMINLINE BenchmarkRegion *
+dequeueRegion(BenchmarkState *state)
+{
+	return (queue_monitor == state->kind) ? state->monitorQueue.dequeueIfNonEmpty() : state->lockFreeQueue.pop();
+}
+
+static MMINLINE void
+enqueueRegion(BenchmarkState *state, BenchmarkRegion *region)
+{
+	if (queue_monitor == state->kind) {
+		state->monitorQueue.enqueue(region);
+	} else {
+		state->lockFreeQueue.push(region);
+	}
+}
+
+static int J9THREAD_PROC
+workerMain(void *arg)
+{
+	BenchmarkState *state = (BenchmarkState *)arg;
+	uintptr_t self = (uintptr_t)omrthread_self();
+
+	omrthread_monitor_enter(state->controlMonitor);
+	state->readyThreads += 1;
+	omrthread_monitor_notify_all(state->controlMonitor);
+	while (0 == state->started) {
+		omrthread_monitor_wait(state->controlMonitor);
+	}
+	omrthread_monitor_exit(state->controlMonitor);
+
+	uintptr_t refills = 0;
+	while (refills < state->refillsPerThread) {
+		BenchmarkRegion *region = dequeueRegion(state);
+		if (NULL == region) {
+			/* every region is held by another thread */
+			omrthread_yield();
+			continue;
+		}
+		/* a region handed out twice is a broken queue */
+		if (0 != MM_AtomicOperations::lockCompareExchange(&region->owner, 0, self)) {
+			MM_AtomicOperations::add(&state->errors, 1);
+		}
+		region->owner = 0;
+		enqueueRegion(state, region);
+		refills += 1;
+	}
+
+	omrthread_monitor_enter(state->controlMonitor);
+	state->runningThreads -= 1;
+	omrthread_monitor_notify_all(state->controlMonitor);
+	omrthread_monitor_exit(state->controlMonitor);
+	return 0;
+}
+
+/**
+ * Run refillsPerThread refills on each of threadCount threads, from a queue holding regionCount regions.
+ * @return the refills per microsecond of all threads, or -1 on failure
+ */
+static double
+measure(OMRPortLibrary *portLibrary, QueueKind kind, uintptr_t threadCount, uintptr_t refillsPerThread, BenchmarkRegion *regions, uintptr_t regionCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	double result = -1.0;
+	BenchmarkState *state = new BenchmarkState();
+
+	state->kind = kind;
+	state->refillsPerThread = refillsPerThread;
+	state->monitorQueue.head = NULL;
+	state->monitorQueue.tail = NULL;
+	state->monitorQueue.length = 0;
+	state->lockFreeQueue.initialize(regions, sizeof(BenchmarkRegion));
+	state->readyThreads = 0;
+	state->runningThreads = threadCount;
+	state->started = 0;
+	state->errors = 0;
+
+	if ((0 == omrthread_monitor_init_with_name(&state->monitorQueue.lockMonitor, 0, "RegionList lock monitor"))
+		&& (0 == omrthread_monitor_init_with_name(&state->controlMonitor, 0, "regionQueueBenchmark::control"))
+	) {
+		for (uintptr_t i = 0; i < regionCount; i++) {
+			regions[i].reset();
+			enqueueRegion(state, &regions[i]);
+		}
+
+		bool started = true;
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			omrthread_t thread = NULL;
+			if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, workerMain, state)) {
+				fprintf(stderr, "omrthread_create failed for thread %zu of %zu\n", i, threadCount);
+				started = false;
+				/* let the threads already created finish */
+				state->runningThreads = i;
+				break;
+			}
+		}
+
+		omrthread_monitor_enter(state->controlMonitor);
+		while (state->readyThreads < state->runningThreads) {
+			omrthread_monitor_wait(state->controlMonitor);
+		}
+		uint64_t startTime = omrtime_hires_clock();
+		state->started = 1;
+		omrthread_monitor_notify_all(state->controlMonitor);
+		while (0 != state->runningThreads) {
+			omrthread_monitor_wait(state->controlMonitor);
+		}
+		uint64_t endTime = omrtime_hires_clock();
+		omrthread_monitor_exit(state->controlMonitor);
+
+		/* every region must be back on the queue, once */
+		uintptr_t regionsLeft = 0;
+		while (NULL != dequeueRegion(state)) {
+			regionsLeft += 1;
+		}
+		if (regionsLeft != regionCount) {
+			fprintf(stderr, "%zu regions left on the queue, expected %zu\n", regionsLeft, regionCount);
+		} else if (0 != state->errors) {
+			fprintf(stderr, "%zu regions were handed out to two threads at once\n", (uintptr_t)state->errors);
+		} else if (started) {
+			result = (double)(threadCount * refillsPerThread) / (double)omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		}
+
+		omrthread_monitor_destroy(state->controlMonitor);
+		omrthread_monitor_destroy(state->monitorQueue.lockMonitor);
+	}
+
+	delete state;
+	return result;
+}
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	uintptr_t refillsPerThread = (argc > 1) ? (uintptr_t)atol(argv[1]) : DEFAULT_REFILLS_PER_THREAD;
+	uintptr_t maxThreads = (argc > 2) ? (uintptr_t)atol(argv[2]) : DEFAULT_MAX_THREADS;
+	uintptr_t regionCount = (argc > 3) ? (uintptr_t)atol(argv[3]) : DEFAULT_REGIONS;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	if (0 == refillsPerThread) {
+		refillsPerThread = DEFAULT_REFILLS_PER_THREAD;
+	}
+	if (0 == maxThreads) {
+		maxThreads = DEFAULT_MAX_THREADS;
+	}
+	if (0 == regionCount) {
+		regionCount = DEFAULT_REGIONS;
+	}
+
+	BenchmarkRegion *regions = (BenchmarkRegion *)omrmem_allocate_memory(regionCount * sizeof(BenchmarkRegion), OMRMEM_CATEGORY_MM);
+	if (NULL == regions) {
+		fprintf(stderr, "failed to allocate %zu regions\n", regionCount);
+		return -1;
+	}
+
+	printf("Region refill throughput: %zu refills per thread, %zu regions, %zu online CPUs, refills per us\n",
+		refillsPerThread, regionCount, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+	printf("%8s %12s %12s %10s\n", "threads", "monitor", "lock free", "speedup");
+
+	int result = 0;
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		double monitorThroughput = measure(&portLibrary, queue_monitor, threadCount, refillsPerThread, regions, regionCount);
+		double lockFreeThroughput = measure(&portLibrary, queue_lock_free, threadCount, refillsPerThread, regions, regionCount);
+		if ((monitorThroughput < 0.0) || (lockFreeThroughput < 0.0)) {
+			result = -1;
+			break;
+		}
+		printf("%8zu %12.2f %12.2f %9.2fx\n", threadCount, monitorThroughput, lockFreeThroughput, lockFreeThroughput / monitorThroughput);
+	}
+
+	omrmem_free_memory(regions);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return result;
+}
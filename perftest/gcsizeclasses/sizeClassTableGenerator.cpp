@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Turns an allocation size histogram, written by the segregated heap when -Xgc:sizeClassHistogram=<file> is
+ * specified, into the size class table that wastes the fewest bytes for those allocations, and reports the
+ * fragmentation of the heap under the size classes of sizeclasses.h and under the computed ones. The table is
+ * written to tableFile, for -Xgc:sizeClassTable=<tableFile>, when it has as many size classes as the heap.
+ *
+ * Without a histogram, a synthetic one is used and the computed table is checked against every table that
+ * differs from it by one cell size.
+ *
+ * Usage: omrperfgcsizeclasses [histogramFile [classes [tableFile [regionSize]]]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrcfg.h"
+
+#include "SizeClassTable.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* from ConfigurationSegregated.cpp */
+#define DEFAULT_REGION_SIZE (64 * 1024)
+#define SYNTHETIC_ALLOCATIONS 1000000
+
+static uintptr_t defaultCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+
+/**
+ * Read a whole file into a NUL terminated buffer, to be freed by the caller.
+ */
+static char *
+readFile(const char *fileName)
+{
+	char *text = NULL;
+	FILE *file = fopen(fileName, "rb");
+	if (NULL != file) {
+		if ((0 == fseek(file, 0, SEEK_END))) {
+			long fileSize = ftell(file);
+			if ((fileSize >= 0) && (0 == fseek(file, 0, SEEK_SET))) {
+				text = (char *)malloc((size_t)fileSize + 1);
+				if (NULL != text) {
+					if ((size_t)fileSize != fread(text, 1, (size_t)fileSize, file)) {
+						free(text);
+						text = NULL;
+					} else {
+						text[fileSize] = '\0';
+					}
+				}
+			}
+		}
+		fclose(file);
+	}
+	return text;
+}
+
+/**
+ * A mix of allocation sizes with most objects small, the way object heaps usually are, and a few popular
+ * larger sizes (buffers and hash table arrays) that fall between the default size classes.
+ */
+static void
+fillSyntheticHistogram(uint64_t *histogram)
+{
+	uint32_t seed = 12345;
+	for (uintptr_t allocation = 0; allocation < SYNTHETIC_ALLOCATIONS; allocation++) {
+		seed = (seed * 1103515245) + 12345;
+		uint32_t random = (seed >> 8) & 0xFFFF;
+		uintptr_t size = 0;
+		if (random < 45000) {
+			size = 16 + (random % 4) * 8;
+		} else if (random < 58000) {
+			size = 48 + (random % 24) * 8;
+		} else if (random < 61000) {
+			size = 272;
+		} else if (random < 63000) {
+			size = 528;
+		} else if (random < 64500) {
+			size = 1040;
+		} else {
+			size = 8 + (random % (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / 8)) * 8;
+		}
+		histogram[MM_SizeClassTable::getHistogramBin(size)] += 1;
+	}
+}
+
+static void
+printReport(const char *name, const uintptr_t *cellSizes, uintptr_t classCount, const MM_SizeClassTable::Waste *waste)
+{
+	printf("%-10s %7.2f%% %14llu %14llu %14.0f  ", name, waste->getWastePercent(),
+		(unsigned long long)waste->requestedBytes, (unsigned long long)waste->cellBytes, waste->regionTailBytes);
+	for (uintptr_t sizeClass = 0; sizeClass < classCount; sizeClass++) {
+		printf(" %zu", cellSizes[sizeClass]);
+	}
+	printf("\n");
+}
+
+/**
+ * @return true if no valid table one cell size away from cellSizes wastes fewer bytes
+ */
+static bool
+isLocallyOptimal(const uint64_t *histogram, const uintptr_t *cellSizes, uintptr_t classCount, uintptr_t regionSize, double waste)
+{
+	uintptr_t neighbour[OMR_SIZECLASSES_NUM_SMALL];
+	for (uintptr_t sizeClass = 0; sizeClass < classCount; sizeClass++) {
+		for (intptr_t delta = -OMR_SIZECLASSES_HISTOGRAM_GRANULE; delta <= OMR_SIZECLASSES_HISTOGRAM_GRANULE; delta += 2 * OMR_SIZECLASSES_HISTOGRAM_GRANULE) {
+			memcpy(neighbour, cellSizes, classCount * sizeof(uintptr_t));
+			neighbour[sizeClass] += delta;
+			if (MM_SizeClassTable::isValidTable(neighbour, classCount)) {
+				MM_SizeClassTable::Waste neighbourWaste;
+				MM_SizeClassTable::computeWaste(histogram, neighbour, classCount, regionSize, &neighbourWaste);
+				double heapBytes = (double)neighbourWaste.cellBytes + neighbourWaste.regionTailBytes;
+				if (heapBytes < (waste - 0.5)) {
+					fprintf(stderr, "cell size %zu of class %zu wastes less as %zu\n", cellSizes[sizeClass], sizeClass, neighbour[sizeClass]);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+int
+main(int argc, char **argv)
+{
+	const char *histogramFileName = (argc > 1) ? argv[1] : NULL;
+	uintptr_t classCount = (argc > 2) ? (uintptr_t)atol(argv[2]) : OMR_SIZECLASSES_NUM_SMALL;
+	const char *tableFileName = (argc > 3) ? argv[3] : NULL;
+	uintptr_t regionSize = (argc > 4) ? (uintptr_t)atol(argv[4]) : DEFAULT_REGION_SIZE;
+
+	if ((0 == classCount) || (classCount > OMR_SIZECLASSES_NUM_SMALL)) {
+		fprintf(stderr, "classes must be 1 to %d\n", OMR_SIZECLASSES_NUM_SMALL);
+		return -1;
+	}
+	if (regionSize < OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) {
+		fprintf(stderr, "regionSize must be at least %d bytes\n", OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES);
+		return -1;
+	}
+
+	uint64_t histogram[OMR_SIZECLASSES_HISTOGRAM_BINS];
+	memset(histogram, 0, sizeof(histogram));
+	if (NULL == histogramFileName) {
+		fillSyntheticHistogram(histogram);
+	} else {
+		char *text = readFile(histogramFileName);
+		if (NULL == text) {
+			fprintf(stderr, "unable to read %s\n", histogramFileName);
+			return -1;
+		}
+		bool parsed = MM_SizeClassTable::parseHistogram(text, histogram);
+		free(text);
+		if (!parsed) {
+			fprintf(stderr, "%s is not a histogram of allocation sizes up to %d bytes\n", histogramFileName, OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES);
+			return -1;
+		}
+	}
+
+	uintptr_t optimalCellSizes[OMR_SIZECLASSES_NUM_SMALL];
+	if (!MM_SizeClassTable::computeOptimalTable(histogram, classCount, regionSize, optimalCellSizes)) {
+		fprintf(stderr, "no table of %zu size classes\n", classCount);
+		return -1;
+	}
+
+	MM_SizeClassTable::Waste defaultWaste;
+	MM_SizeClassTable::Waste optimalWaste;
+	MM_SizeClassTable::computeWaste(histogram, defaultCellSizes + OMR_SIZECLASSES_MIN_SMALL, OMR_SIZECLASSES_NUM_SMALL, regionSize, &defaultWaste);
+	MM_SizeClassTable::computeWaste(histogram, optimalCellSizes, classCount, regionSize, &optimalWaste);
+
+	printf("Size class tables for %llu allocations from %s, %zu byte regions\n", (unsigned long long)defaultWaste.allocations,
+		(NULL == histogramFileName) ? "a synthetic histogram" : histogramFileName, regionSize);
+	printf("%-10s %8s %14s %14s %14s   %s\n", "table", "waste", "requested", "cells", "region tails", "cell sizes");
+	printReport("default", defaultCellSizes + OMR_SIZECLASSES_MIN_SMALL, OMR_SIZECLASSES_NUM_SMALL, &defaultWaste);
+	printReport("optimal", optimalCellSizes, classCount, &optimalWaste);
+
+	int result = 0;
+	if (!MM_SizeClassTable::isValidTable(optimalCellSizes, classCount)) {
+		fprintf(stderr, "the optimal table is not valid\n");
+		result = -1;
+	} else if ((OMR_SIZECLASSES_NUM_SMALL == classCount) && (optimalWaste.getWastePercent() > defaultWaste.getWastePercent())) {
+		fprintf(stderr, "the optimal table wastes more than the default one\n");
+		result = -1;
+	} else if ((NULL == histogramFileName) && !isLocallyOptimal(histogram, optimalCellSizes, classCount, regionSize, (double)optimalWaste.cellBytes + optimalWaste.regionTailBytes)) {
+		result = -1;
+	}
+
+	if ((0 == result) && (NULL != tableFileName)) {
+		if (OMR_SIZECLASSES_NUM_SMALL != classCount) {
+			fprintf(stderr, "not writing %s: the heap has %d size classes\n", tableFileName, OMR_SIZECLASSES_NUM_SMALL);
+		} else {
+			FILE *tableFile = fopen(tableFileName, "w");
+			if (NULL == tableFile) {
+				fprintf(stderr, "unable to write %s\n", tableFileName);
+				result = -1;
+			} else {
+				fprintf(tableFile, "# %.2f%% waste for %s, %.2f%% with sizeclasses.h\n", optimalWaste.getWastePercent(),
+					(NULL == histogramFileName) ? "a synthetic histogram" : histogramFileName, defaultWaste.getWastePercent());
+				for (uintptr_t sizeClass = 0; sizeClass < classCount; sizeClass++) {
+					fprintf(tableFile, "%zu\n", optimalCellSizes[sizeClass]);
+				}
+				fclose(tableFile);
+			}
+		}
+	}
+
+	return result;
+}
+
+#else /* OMR_GC_SEGREGATED_HEAP */
+
+int
+main(int argc, char **argv)
+{
+	printf("The segregated heap is not enabled in this build\n");
+	return 0;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
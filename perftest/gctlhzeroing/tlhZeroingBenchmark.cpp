@@ -0,0 +1,307 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Measures the allocation throughput of batch cleared TLHs (-Xgc:batchClearTLH) under each -Xgc:tlhZeroing=
+ * strategy, and with -Xgc:backgroundTLHZeroing. Objects are bump allocated from TLHs carved in turn from a
+ * nursery much larger than the caches, the way a mutator goes through the nursery between scavenges, and each
+ * object has its header and first fields written, as initialization would. Every TLH is zeroed when it is
+ * refreshed, or in the background ahead of demand with the protocol of MM_TLHZeroing, and every object is
+ * checked to be zeroed before it is initialized.
+ *
+ * Usage: omrperfgctlhzeroing [nurseryMB [passes [objectSize]]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "omrutil.h"
+
+#define DEFAULT_NURSERY_MB 256
+#define DEFAULT_PASSES 8
+#define DEFAULT_OBJECT_SIZE 48
+/* words of an object written by its initialization */
+#define INITIALIZED_WORDS 3
+
+enum ZeroingKind {
+	zeroing_memset = 0,
+	zeroing_non_temporal,
+	zeroing_rep_stosb,
+	zeroing_background
+};
+
+/**
+ * MM_TLHZeroingRequest, and the monitor protocol of MM_TLHZeroing for one allocating thread.
+ */
+struct BackgroundZeroer {
+	enum State {
+		STATE_IDLE = 0,
+		STATE_PENDING,
+		STATE_ZEROING,
+		STATE_DONE
+	};
+
+	uint8_t *base;
+	uint8_t *top;
+	volatile State state;
+	volatile bool terminate;
+	volatile bool terminated;
+	omrthread_monitor_t monitor;
+
+	void
+	post(uint8_t *postBase, uint8_t *postTop)
+	{
+		omrthread_monitor_enter(monitor);
+		base = postBase;
+		top = postTop;
+		state = STATE_PENDING;
+		omrthread_monitor_notify_all(monitor);
+		omrthread_monitor_exit(monitor);
+	}
+
+	bool
+	claim()
+	{
+		omrthread_monitor_enter(monitor);
+		while (STATE_ZEROING == state) {
+			omrthread_monitor_wait(monitor);
+		}
+		bool zeroed = (STATE_DONE == state);
+		state = STATE_IDLE;
+		omrthread_monitor_exit(monitor);
+		return zeroed;
+	}
+
+	void
+	run()
+	{
+		omrthread_monitor_enter(monitor);
+		while (!terminate) {
+			if (STATE_PENDING != state) {
+				omrthread_monitor_wait(monitor);
+			} else {
+				state = STATE_ZEROING;
+				omrthread_monitor_exit(monitor);
+				OMRZeroMemoryNonTemporal(base, (uintptr_t)(top - base));
+				omrthread_monitor_enter(monitor);
+				state = STATE_DONE;
+				omrthread_monitor_notify_all(monitor);
+			}
+		}
+		terminated = true;
+		omrthread_monitor_notify_all(monitor);
+		omrthread_exit(monitor);
+	}
+};
+
+static int J9THREAD_PROC
+zeroerMain(void *arg)
+{
+	((BackgroundZeroer *)arg)->run();
+	return 0;
+}
+
+static void
+zeroTLH(ZeroingKind kind, uint8_t *base, uintptr_t size)
+{
+	switch (kind) {
+	case zeroing_non_temporal:
+		OMRZeroMemoryNonTemporal(base, size);
+		break;
+	case zeroing_rep_stosb:
+		OMRZeroMemoryRepStosb(base, size);
+		break;
+	default:
+		OMRZeroMemory(base, size);
+		break;
+	}
+}
+
+/**
+ * Allocate objects of objectSize bytes from TLHs of tlhSize bytes, passes times through the nursery.
+ * @return the bytes allocated per microsecond, or -1 on failure
+ */
+static double
+measure(OMRPortLibrary *portLibrary, ZeroingKind kind, uint8_t *nursery, uintptr_t nurserySize, uintptr_t passes, uintptr_t tlhSize, uintptr_t objectSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	BackgroundZeroer zeroer;
+	uintptr_t tlhCount = nurserySize / tlhSize;
+	uintptr_t objectsPerTLH = tlhSize / objectSize;
+	uintptr_t errors = 0;
+
+	if (zeroing_background == kind) {
+		zeroer.base = NULL;
+		zeroer.top = NULL;
+		zeroer.state = BackgroundZeroer::STATE_IDLE;
+		zeroer.terminate = false;
+		zeroer.terminated = false;
+		if (0 != omrthread_monitor_init_with_name(&zeroer.monitor, 0, "tlhZeroingBenchmark::zeroer")) {
+			return -1.0;
+		}
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, zeroerMain, &zeroer)) {
+			fprintf(stderr, "omrthread_create failed for the zeroing thread\n");
+			omrthread_monitor_destroy(zeroer.monitor);
+			return -1.0;
+		}
+	}
+
+	/* leave the nursery dirty, as the previous cycle would */
+	memset(nursery, 0xA5, nurserySize);
+
+	uint64_t startTime = omrtime_hires_clock();
+	for (uintptr_t pass = 0; pass < passes; pass++) {
+		for (uintptr_t tlh = 0; tlh < tlhCount; tlh++) {
+			uint8_t *base = nursery + (tlh * tlhSize);
+			if (zeroing_background != kind) {
+				zeroTLH(kind, base, tlhSize);
+			} else {
+				/* the TLH was queued at the previous refresh, and this refresh queues the next one */
+				if (0 == tlh) {
+					OMRZeroMemoryNonTemporal(base, tlhSize);
+				} else if (!zeroer.claim()) {
+					OMRZeroMemoryNonTemporal(base, tlhSize);
+				}
+				if ((tlh + 1) < tlhCount) {
+					zeroer.post(base + tlhSize, base + (2 * tlhSize));
+				}
+			}
+
+			uint8_t *alloc = base;
+			for (uintptr_t object = 0; object < objectsPerTLH; object++) {
+				uintptr_t *slots = (uintptr_t *)alloc;
+				if (0 != slots[(objectSize / sizeof(uintptr_t)) - 1]) {
+					errors += 1;
+				}
+				slots[0] = objectSize;
+				for (uintptr_t word = 1; word < INITIALIZED_WORDS; word++) {
+					slots[word] = (uintptr_t)alloc;
+				}
+				alloc += objectSize;
+			}
+		}
+		/* the scavenge leaves the nursery dirty again */
+		for (uintptr_t cursor = 0; cursor < nurserySize; cursor += 4096) {
+			nursery[cursor + sizeof(uintptr_t)] = 0xA5;
+			nursery[cursor + 4096 - 1] = 0xA5;
+		}
+	}
+	uint64_t endTime = omrtime_hires_clock();
+
+	if (zeroing_background == kind) {
+		omrthread_monitor_enter(zeroer.monitor);
+		zeroer.terminate = true;
+		omrthread_monitor_notify_all(zeroer.monitor);
+		while (!zeroer.terminated) {
+			omrthread_monitor_wait(zeroer.monitor);
+		}
+		omrthread_monitor_exit(zeroer.monitor);
+		omrthread_monitor_destroy(zeroer.monitor);
+	}
+
+	if (0 != errors) {
+		fprintf(stderr, "%zu objects were not zeroed\n", errors);
+		return -1.0;
+	}
+	uintptr_t allocatedBytes = passes * tlhCount * objectsPerTLH * objectSize;
+	return (double)allocatedBytes / (double)omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+int
+main(int argc, char **argv)
+{
+	OMRPortLibrary portLibrary;
+	uintptr_t nurseryMB = (argc > 1) ? (uintptr_t)atol(argv[1]) : DEFAULT_NURSERY_MB;
+	uintptr_t passes = (argc > 2) ? (uintptr_t)atol(argv[2]) : DEFAULT_PASSES;
+	uintptr_t objectSize = (argc > 3) ? (uintptr_t)atol(argv[3]) : DEFAULT_OBJECT_SIZE;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	if (0 == nurseryMB) {
+		nurseryMB = DEFAULT_NURSERY_MB;
+	}
+	if (0 == passes) {
+		passes = DEFAULT_PASSES;
+	}
+	if ((objectSize < (INITIALIZED_WORDS * sizeof(uintptr_t))) || (0 != (objectSize % sizeof(uintptr_t)))) {
+		fprintf(stderr, "objectSize must be a multiple of %zu bytes, at least %zu\n", sizeof(uintptr_t), INITIALIZED_WORDS * sizeof(uintptr_t));
+		return -1;
+	}
+
+	uintptr_t nurserySize = nurseryMB * 1024 * 1024;
+	uint8_t *nursery = (uint8_t *)omrmem_allocate_memory(nurserySize, OMRMEM_CATEGORY_MM);
+	if (NULL == nursery) {
+		fprintf(stderr, "failed to allocate a %zu MB nursery\n", nurseryMB);
+		return -1;
+	}
+
+	bool ermsb = false;
+#if defined(OMR_ARCH_X86)
+	OMRProcessorDesc processorDescription;
+	ermsb = (0 == omrsysinfo_get_processor_description(&processorDescription))
+		&& (TRUE == omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_ERMSB));
+#endif /* defined(OMR_ARCH_X86) */
+
+	printf("TLH allocation throughput: %zu MB nursery, %zu passes, %zu byte objects, %s, %zu online CPUs, MB per s\n",
+		nurseryMB, passes, objectSize, ermsb ? "ERMS" : "no ERMS", omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE));
+	printf("%10s %12s %12s %12s %12s\n", "TLH size", "memset", "nonTemporal", "repStosb", "background");
+
+	int result = 0;
+	for (uintptr_t tlhSize = 16 * 1024; tlhSize <= (1024 * 1024); tlhSize *= 4) {
+		double throughput[4];
+		for (uintptr_t kind = zeroing_memset; kind <= zeroing_background; kind++) {
+			throughput[kind] = measure(&portLibrary, (ZeroingKind)kind, nursery, nurserySize, passes, tlhSize, objectSize);
+			if (throughput[kind] < 0.0) {
+				result = -1;
+			}
+		}
+		if (0 != result) {
+			break;
+		}
+		/* bytes per us are MB per s */
+		printf("%10zu %12.0f %12.0f %12.0f %12.0f\n", tlhSize, throughput[zeroing_memset], throughput[zeroing_non_temporal],
+			throughput[zeroing_rep_stosb], throughput[zeroing_background]);
+	}
+
+	omrmem_free_memory(nursery);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+
+	return result;
+}
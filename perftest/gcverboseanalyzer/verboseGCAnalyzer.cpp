@@ -0,0 +1,879 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Reports pause time percentiles, GC CPU overhead, allocation and promotion rates and heap occupancy from the
+ * verbose GC logs of a run, and optionally compares them with those of a second run.
+ *
+ * Logs are read as a stream of elements in a fixed size buffer and every statistic is kept in constant memory,
+ * so the size of the logs is only bounded by the time it takes to read them:
+ *  - pauses (exclusive-end) and the durations of every type of collection (gc-end) are counted in log-linear
+ *    histograms, which give percentiles within 1/HISTOGRAM_SUB_BUCKETS of the exact value;
+ *  - GC CPU overhead is the user and system time of the collections over the CPU time available to the process
+ *    while the run lasted, concurrent work outside of collections is not reported by verbose GC and not included;
+ *  - allocation is summed from allocation-stats, and promotion from the tenure memory-copied of scavenges;
+ *  - heap occupancy after every collection is decimated to at most -points entries, keeping the highest
+ *    occupancy of the collections every entry covers.
+ *
+ * The files of a run, for instance the rotating files of one log, may be given in any order: they are read in the
+ * order of their first timestamp.
+ *
+ * Usage: omrperfgcverboseanalyzer [-points=<n>] <verbose log>... [-diff <verbose log>...]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "omrcomp.h"
+
+/* Bytes of log read at a time */
+#define LOG_READ_BUFFER_SIZE (64 * 1024)
+/* Longest element kept; longer elements, which verbose GC does not write, are skipped */
+#define LOG_MAXIMUM_ELEMENT_LENGTH 4096
+#define LOG_MAXIMUM_ATTRIBUTES 32
+#define LOG_MAXIMUM_DEPTH 16
+
+/* Histograms count microseconds in buckets of HISTOGRAM_SUB_BUCKETS per power of two */
+#define HISTOGRAM_SUB_BUCKET_SHIFT 5
+#define HISTOGRAM_SUB_BUCKETS (1 << HISTOGRAM_SUB_BUCKET_SHIFT)
+#define HISTOGRAM_BUCKETS (64 * HISTOGRAM_SUB_BUCKETS)
+/* Collection types reported separately, further types are counted with the last one */
+#define MAXIMUM_COLLECTION_TYPES 8
+#define DEFAULT_OCCUPANCY_POINTS 40
+
+/**
+ * Log-linear histogram of durations.
+ */
+class DurationHistogram
+{
+private:
+	uint64_t _counts[HISTOGRAM_BUCKETS];
+	uint64_t _count;
+	double _total;
+	double _maximum;
+
+	static uintptr_t
+	bucketOf(uint64_t micros)
+	{
+		if (micros < (2 * HISTOGRAM_SUB_BUCKETS)) {
+			return (uintptr_t)micros;
+		}
+		uintptr_t shift = 0;
+		while ((micros >> shift) >= (2 * HISTOGRAM_SUB_BUCKETS)) {
+			shift += 1;
+		}
+		return ((shift + 1) << HISTOGRAM_SUB_BUCKET_SHIFT) + (uintptr_t)((micros >> shift) - HISTOGRAM_SUB_BUCKETS);
+	}
+
+	/**
+	 * @return the midpoint of a bucket in microseconds
+	 */
+	static double
+	valueOf(uintptr_t bucket)
+	{
+		if (bucket < (2 * HISTOGRAM_SUB_BUCKETS)) {
+			return (double)bucket;
+		}
+		uintptr_t shift = (bucket >> HISTOGRAM_SUB_BUCKET_SHIFT) - 1;
+		uint64_t low = ((uint64_t)(bucket & (HISTOGRAM_SUB_BUCKETS - 1)) + HISTOGRAM_SUB_BUCKETS) << shift;
+		return (double)low + ((double)((uint64_t)1 << shift) / 2.0);
+	}
+
+public:
+	void
+	add(double milliseconds)
+	{
+		if (milliseconds < 0.0) {
+			milliseconds = 0.0;
+		}
+		_counts[bucketOf((uint64_t)(milliseconds * 1000.0))] += 1;
+		_count += 1;
+		_total += milliseconds;
+		_maximum = OMR_MAX(_maximum, milliseconds);
+	}
+
+	/**
+	 * @param percentile[in] 0 to 100
+	 * @return the duration in milliseconds that the percentile of the durations does not exceed
+	 */
+	double
+	getPercentile(double percentile)
+	{
+		if (0 == _count) {
+			return 0.0;
+		}
+		uint64_t rank = (uint64_t)ceil((percentile / 100.0) * (double)_count);
+		rank = OMR_MIN(OMR_MAX(rank, 1), _count);
+		uint64_t seen = 0;
+		for (uintptr_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+			seen += _counts[bucket];
+			if (seen >= rank) {
+				return OMR_MIN(valueOf(bucket) / 1000.0, _maximum);
+			}
+		}
+		return _maximum;
+	}
+
+	uint64_t getCount() { return _count; }
+	double getTotal() { return _total; }
+	double getMaximum() { return _maximum; }
+	double getAverage() { return (0 == _count) ? 0.0 : (_total / (double)_count); }
+
+	DurationHistogram()
+		: _count(0)
+		, _total(0.0)
+		, _maximum(0.0)
+	{
+		memset(_counts, 0, sizeof(_counts));
+	}
+};
+
+struct OccupancyPoint {
+	double seconds; /**< Time of the collection since the start of the run */
+	double heap; /**< Percentage of the heap in use after the collection */
+	double tenure; /**< Percentage of tenure space in use after the collection, or of the heap if there is none */
+};
+
+/**
+ * Heap occupancy after every collection, decimated to a fixed number of points.
+ */
+class OccupancyCurve
+{
+private:
+	std::vector<OccupancyPoint> _points;
+	uintptr_t _maximumPoints;
+	uintptr_t _stride; /**< Collections every point covers */
+	uintptr_t _pending; /**< Collections folded into _next */
+	OccupancyPoint _next;
+
+	static void
+	fold(OccupancyPoint *into, const OccupancyPoint *point)
+	{
+		if (point->heap > into->heap) {
+			*into = *point;
+		}
+	}
+
+public:
+	void
+	add(const OccupancyPoint *point)
+	{
+		if (0 == _pending) {
+			_next = *point;
+		} else {
+			fold(&_next, point);
+		}
+		_pending += 1;
+		if (_pending < _stride) {
+			return;
+		}
+
+		_points.push_back(_next);
+		_pending = 0;
+		if (_points.size() == _maximumPoints) {
+			/* halve the points, so that every one covers twice the collections */
+			uintptr_t kept = 0;
+			for (uintptr_t i = 0; (i + 1) < _points.size(); i += 2) {
+				OccupancyPoint merged = _points[i];
+				fold(&merged, &_points[i + 1]);
+				_points[kept++] = merged;
+			}
+			_points.resize(kept);
+			_stride *= 2;
+		}
+	}
+
+	std::vector<OccupancyPoint> *
+	getPoints()
+	{
+		if (0 != _pending) {
+			_points.push_back(_next);
+			_pending = 0;
+		}
+		return &_points;
+	}
+
+	OccupancyCurve(uintptr_t maximumPoints)
+		: _maximumPoints(OMR_MAX(maximumPoints, 2) & ~(uintptr_t)1)
+		, _stride(1)
+		, _pending(0)
+	{
+		_points.reserve(_maximumPoints);
+	}
+};
+
+struct Attribute {
+	const char *name;
+	const char *value;
+};
+
+/**
+ * Element of the log, with its attributes unescaped in place.
+ */
+struct Element {
+	const char *name;
+	Attribute attributes[LOG_MAXIMUM_ATTRIBUTES];
+	uintptr_t attributeCount;
+	bool empty; /**< True for an element closed by its start tag */
+
+	const char *
+	get(const char *attribute)
+	{
+		for (uintptr_t i = 0; i < attributeCount; i++) {
+			if (0 == strcmp(attributes[i].name, attribute)) {
+				return attributes[i].value;
+			}
+		}
+		return NULL;
+	}
+
+	double
+	getDouble(const char *attribute)
+	{
+		const char *value = get(attribute);
+		return (NULL == value) ? 0.0 : strtod(value, NULL);
+	}
+
+	uint64_t
+	getInteger(const char *attribute)
+	{
+		const char *value = get(attribute);
+		return (NULL == value) ? 0 : (uint64_t)strtoull(value, NULL, 10);
+	}
+
+	bool
+	is(const char *attribute, const char *expected)
+	{
+		const char *value = get(attribute);
+		return (NULL != value) && (0 == strcmp(value, expected));
+	}
+};
+
+/**
+ * Reads the elements of a log one at a time through a fixed size buffer.
+ */
+class LogReader
+{
+private:
+	FILE *_file;
+	char _buffer[LOG_READ_BUFFER_SIZE];
+	uintptr_t _position;
+	uintptr_t _limit;
+	char _tag[LOG_MAXIMUM_ELEMENT_LENGTH + 1];
+
+	int
+	nextCharacter()
+	{
+		if (_position == _limit) {
+			_limit = fread(_buffer, 1, sizeof(_buffer), _file);
+			_position = 0;
+			if (0 == _limit) {
+				return EOF;
+			}
+		}
+		return (unsigned char)_buffer[_position++];
+	}
+
+	static void
+	unescape(char *value)
+	{
+		static const char *entities[][2] = { {"&lt;", "<"}, {"&gt;", ">"}, {"&amp;", "&"}, {"&quot;", "\""}, {"&apos;", "'"} };
+		char *to = value;
+		for (char *from = value; '\0' != *from; ) {
+			bool replaced = false;
+			if ('&' == *from) {
+				for (uintptr_t i = 0; i < (sizeof(entities) / sizeof(entities[0])); i++) {
+					uintptr_t length = strlen(entities[i][0]);
+					if (0 == strncmp(from, entities[i][0], length)) {
+						*to++ = entities[i][1][0];
+						from += length;
+						replaced = true;
+						break;
+					}
+				}
+			}
+			if (!replaced) {
+				*to++ = *from++;
+			}
+		}
+		*to = '\0';
+	}
+
+	bool
+	parseTag(char *tag, uintptr_t length, Element *element)
+	{
+		if ((length > 0) && ('/' == tag[length - 1])) {
+			element->empty = true;
+			tag[--length] = '\0';
+		}
+		char *cursor = tag;
+		element->name = cursor;
+		while (('\0' != *cursor) && !isSpace(*cursor)) {
+			cursor += 1;
+		}
+		while (true) {
+			while (isSpace(*cursor)) {
+				*cursor++ = '\0';
+			}
+			if ('\0' == *cursor) {
+				break;
+			}
+			char *name = cursor;
+			while (('\0' != *cursor) && ('=' != *cursor) && !isSpace(*cursor)) {
+				cursor += 1;
+			}
+			char *nameEnd = cursor;
+			while (isSpace(*cursor) || ('=' == *cursor)) {
+				cursor += 1;
+			}
+			char quote = *cursor;
+			if (('"' != quote) && ('\'' != quote)) {
+				return false;
+			}
+			*nameEnd = '\0';
+			char *value = ++cursor;
+			while (('\0' != *cursor) && (quote != *cursor)) {
+				cursor += 1;
+			}
+			if ('\0' == *cursor) {
+				return false;
+			}
+			*cursor++ = '\0';
+			unescape(value);
+			if (element->attributeCount < LOG_MAXIMUM_ATTRIBUTES) {
+				element->attributes[element->attributeCount].name = name;
+				element->attributes[element->attributeCount].value = value;
+				element->attributeCount += 1;
+			}
+		}
+		return true;
+	}
+
+	static bool isSpace(char c) { return (' ' == c) || ('\t' == c) || ('\r' == c) || ('\n' == c); }
+
+public:
+	bool
+	open(const char *fileName)
+	{
+		_file = fopen(fileName, "rb");
+		_position = 0;
+		_limit = 0;
+		return NULL != _file;
+	}
+
+	void
+	close()
+	{
+		if (NULL != _file) {
+			fclose(_file);
+			_file = NULL;
+		}
+	}
+
+	/**
+	 * Read the next start or end tag, skipping text, comments and processing instructions.
+	 * @param element[out] the element, valid until the next call
+	 * @param end[out] true for an end tag
+	 * @return false at the end of the log
+	 */
+	bool
+	next(Element *element, bool *end)
+	{
+		int c = 0;
+		while (EOF != (c = nextCharacter())) {
+			if ('<' != c) {
+				continue;
+			}
+
+			/* read up to the closing '>', which may not appear inside an attribute value */
+			uintptr_t length = 0;
+			char quote = '\0';
+			bool truncated = false;
+			while (EOF != (c = nextCharacter())) {
+				if ('\0' != quote) {
+					if (quote == c) {
+						quote = '\0';
+					}
+				} else if (('"' == c) || ('\'' == c)) {
+					quote = (char)c;
+				} else if ('>' == c) {
+					break;
+				}
+				if (length < LOG_MAXIMUM_ELEMENT_LENGTH) {
+					_tag[length++] = (char)c;
+				} else {
+					truncated = true;
+				}
+			}
+			_tag[length] = '\0';
+			if ((EOF == c) || truncated || (0 == length) || ('?' == _tag[0]) || ('!' == _tag[0])) {
+				continue;
+			}
+
+			memset(element, 0, sizeof(*element));
+			*end = ('/' == _tag[0]);
+			if (*end) {
+				element->name = _tag + 1;
+				return true;
+			}
+			if (parseTag(_tag, length, element)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	LogReader()
+		: _file(NULL)
+		, _position(0)
+		, _limit(0)
+	{}
+
+	~LogReader() { close(); }
+};
+
+/**
+ * @return milliseconds since the epoch of a verbose GC timestamp (yyyy-mm-ddThh:mm:ss.mmm), -1 if malformed
+ */
+static double
+parseTimestamp(const char *timestamp)
+{
+	int year = 0;
+	unsigned int month = 0;
+	unsigned int day = 0;
+	unsigned int hour = 0;
+	unsigned int minute = 0;
+	double second = 0.0;
+	if ((NULL == timestamp) || (6 != sscanf(timestamp, "%d-%u-%uT%u:%u:%lf", &year, &month, &day, &hour, &minute, &second))) {
+		return -1.0;
+	}
+
+	/* days since the epoch of the civil date */
+	year -= (month <= 2) ? 1 : 0;
+	int era = ((year >= 0) ? year : (year - 399)) / 400;
+	unsigned int yearOfEra = (unsigned int)(year - (era * 400));
+	unsigned int dayOfYear = ((153 * ((month > 2) ? (month - 3) : (month + 9))) + 2) / 5 + day - 1;
+	unsigned int dayOfEra = (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+	double days = ((double)era * 146097.0) + (double)dayOfEra - 719468.0;
+
+	return (((((days * 24.0) + (double)hour) * 60.0) + (double)minute) * 60.0 + second) * 1000.0;
+}
+
+/**
+ * @return the first timestamp of a log, -1 if it has none
+ */
+static double
+firstTimestamp(const char *fileName)
+{
+	LogReader *reader = new LogReader();
+	Element element;
+	bool end = false;
+	double timestamp = -1.0;
+	if (reader->open(fileName)) {
+		while ((timestamp < 0.0) && reader->next(&element, &end)) {
+			if (!end) {
+				timestamp = parseTimestamp(element.get("timestamp"));
+			}
+		}
+	}
+	delete reader;
+	return timestamp;
+}
+
+struct CollectionType {
+	char name[32];
+	DurationHistogram durations;
+};
+
+/**
+ * Statistics of the logs of one run.
+ */
+class RunStatistics
+{
+public:
+	uintptr_t numCPUs;
+	double firstTimestamp;
+	double lastTimestamp;
+
+	DurationHistogram pauses;
+	CollectionType collectionTypes[MAXIMUM_COLLECTION_TYPES];
+	uintptr_t collectionTypeCount;
+	double gcCPUMillis;
+
+	uint64_t allocatedBytes;
+	uint64_t promotedBytes;
+	uintptr_t scavengeCount;
+
+	OccupancyCurve occupancy;
+	double occupancyTotal; /**< Sum of the heap occupancy after every collection, in percent */
+	double occupancyMaximum;
+	uintptr_t occupancyCount;
+
+	uintptr_t fileCount;
+	uintptr_t elementCount;
+
+private:
+	const char *_stack[LOG_MAXIMUM_DEPTH]; /**< Names of the enclosing elements, only the ones this analysis uses */
+	uintptr_t _depth;
+	bool _inScavenge; /**< Inside a gc-op of type scavenge */
+	bool _inGCEnd; /**< Inside a gc-end */
+	double _gcEndTimestamp;
+	uint64_t _heapFree;
+	uint64_t _heapTotal;
+	uint64_t _tenureFree;
+	uint64_t _tenureTotal;
+
+	static const char *
+	internName(const char *name)
+	{
+		static const char *names[] = { "verbosegc", "initialized", "system", "gc-op", "gc-end", "mem-info", "mem", "allocation-stats", "attribute" };
+		for (uintptr_t i = 0; i < (sizeof(names) / sizeof(names[0])); i++) {
+			if (0 == strcmp(name, names[i])) {
+				return names[i];
+			}
+		}
+		return "";
+	}
+
+	const char *parent() { return ((0 < _depth) && (_depth <= LOG_MAXIMUM_DEPTH)) ? _stack[_depth - 1] : ""; }
+	const char *grandparent() { return ((1 < _depth) && (_depth <= LOG_MAXIMUM_DEPTH)) ? _stack[_depth - 2] : ""; }
+
+	CollectionType *
+	collectionType(const char *name)
+	{
+		for (uintptr_t i = 0; i < collectionTypeCount; i++) {
+			if (0 == strncmp(collectionTypes[i].name, name, sizeof(collectionTypes[i].name) - 1)) {
+				return &collectionTypes[i];
+			}
+		}
+		if (collectionTypeCount < MAXIMUM_COLLECTION_TYPES) {
+			CollectionType *type = &collectionTypes[collectionTypeCount++];
+			strncpy(type->name, name, sizeof(type->name) - 1);
+			type->name[sizeof(type->name) - 1] = '\0';
+			return type;
+		}
+		return &collectionTypes[MAXIMUM_COLLECTION_TYPES - 1];
+	}
+
+	void
+	startElement(Element *element)
+	{
+		const char *name = element->name;
+		double timestamp = parseTimestamp(element->get("timestamp"));
+		if (timestamp >= 0.0) {
+			if ((firstTimestamp < 0.0) || (timestamp < firstTimestamp)) {
+				firstTimestamp = timestamp;
+			}
+			lastTimestamp = OMR_MAX(lastTimestamp, timestamp);
+		}
+
+		if (0 == strcmp(name, "exclusive-end")) {
+			pauses.add(element->getDouble("durationms"));
+		} else if (0 == strcmp(name, "gc-end")) {
+			const char *type = element->get("type");
+			collectionType((NULL == type) ? "unknown" : type)->durations.add(element->getDouble("durationms"));
+			gcCPUMillis += element->getDouble("usertimems") + element->getDouble("systemtimems");
+			_inGCEnd = !element->empty;
+			_gcEndTimestamp = timestamp;
+			_heapFree = _heapTotal = _tenureFree = _tenureTotal = 0;
+		} else if (0 == strcmp(name, "gc-op")) {
+			_inScavenge = element->is("type", "scavenge") && !element->empty;
+			if (element->is("type", "scavenge")) {
+				scavengeCount += 1;
+			}
+		} else if (0 == strcmp(name, "allocation-stats")) {
+			allocatedBytes += element->getInteger("totalBytes");
+		} else if ((0 == strcmp(name, "memory-copied")) && _inScavenge && element->is("type", "tenure")) {
+			promotedBytes += element->getInteger("bytes");
+		} else if (_inGCEnd && (0 == strcmp(name, "mem-info")) && (0 == strcmp(parent(), "gc-end"))) {
+			_heapFree = element->getInteger("free");
+			_heapTotal = element->getInteger("total");
+		} else if (_inGCEnd && (0 == strcmp(name, "mem")) && (0 == strcmp(parent(), "mem-info")) && element->is("type", "tenure")) {
+			_tenureFree = element->getInteger("free");
+			_tenureTotal = element->getInteger("total");
+		} else if ((0 == strcmp(name, "attribute")) && (0 == strcmp(parent(), "system")) && element->is("name", "numCPUs")) {
+			numCPUs = (uintptr_t)element->getInteger("value");
+		}
+
+		if (!element->empty) {
+			if (_depth < LOG_MAXIMUM_DEPTH) {
+				_stack[_depth] = internName(name);
+			}
+			_depth += 1;
+		}
+	}
+
+	void
+	endElement(Element *element)
+	{
+		if (0 < _depth) {
+			_depth -= 1;
+		}
+		if (0 == strcmp(element->name, "gc-op")) {
+			_inScavenge = false;
+		} else if ((0 == strcmp(element->name, "gc-end")) && _inGCEnd) {
+			_inGCEnd = false;
+			if (0 != _heapTotal) {
+				OccupancyPoint point;
+				point.seconds = _gcEndTimestamp;
+				point.heap = 100.0 * (double)(_heapTotal - OMR_MIN(_heapFree, _heapTotal)) / (double)_heapTotal;
+				point.tenure = point.heap;
+				if (0 != _tenureTotal) {
+					point.tenure = 100.0 * (double)(_tenureTotal - OMR_MIN(_tenureFree, _tenureTotal)) / (double)_tenureTotal;
+				}
+				occupancy.add(&point);
+				occupancyTotal += point.heap;
+				occupancyMaximum = OMR_MAX(occupancyMaximum, point.heap);
+				occupancyCount += 1;
+			}
+		}
+	}
+
+public:
+	bool
+	read(const char *fileName)
+	{
+		LogReader *reader = new LogReader();
+		if (!reader->open(fileName)) {
+			fprintf(stderr, "%s: cannot open\n", fileName);
+			delete reader;
+			return false;
+		}
+
+		Element element;
+		bool end = false;
+		_depth = 0;
+		_inScavenge = false;
+		_inGCEnd = false;
+		while (reader->next(&element, &end)) {
+			elementCount += 1;
+			if (end) {
+				endElement(&element);
+			} else {
+				startElement(&element);
+			}
+		}
+		fileCount += 1;
+		delete reader;
+		return true;
+	}
+
+	/**
+	 * @return seconds from the first to the last timestamp of the run
+	 */
+	double
+	getElapsedSeconds()
+	{
+		return (firstTimestamp < 0.0) ? 0.0 : ((lastTimestamp - firstTimestamp) / 1000.0);
+	}
+
+	/**
+	 * @return percentage of the CPU time available to the process spent in collections
+	 */
+	double
+	getGCCPUOverhead()
+	{
+		double available = getElapsedSeconds() * 1000.0 * (double)OMR_MAX(numCPUs, 1);
+		return (0.0 == available) ? 0.0 : (100.0 * gcCPUMillis / available);
+	}
+
+	/**
+	 * @return percentage of the elapsed time the run was paused
+	 */
+	double
+	getPausedPercent()
+	{
+		double elapsed = getElapsedSeconds() * 1000.0;
+		return (0.0 == elapsed) ? 0.0 : (100.0 * pauses.getTotal() / elapsed);
+	}
+
+	double
+	getRate(uint64_t bytes)
+	{
+		double elapsed = getElapsedSeconds();
+		return (0.0 == elapsed) ? 0.0 : ((double)bytes / (1024.0 * 1024.0) / elapsed);
+	}
+
+	double getAverageOccupancy() { return (0 == occupancyCount) ? 0.0 : (occupancyTotal / (double)occupancyCount); }
+
+	RunStatistics(uintptr_t occupancyPoints)
+		: numCPUs(0)
+		, firstTimestamp(-1.0)
+		, lastTimestamp(-1.0)
+		, collectionTypeCount(0)
+		, gcCPUMillis(0.0)
+		, allocatedBytes(0)
+		, promotedBytes(0)
+		, scavengeCount(0)
+		, occupancy(occupancyPoints)
+		, occupancyTotal(0.0)
+		, occupancyMaximum(0.0)
+		, occupancyCount(0)
+		, fileCount(0)
+		, elementCount(0)
+		, _depth(0)
+		, _inScavenge(false)
+		, _inGCEnd(false)
+		, _gcEndTimestamp(0.0)
+		, _heapFree(0)
+		, _heapTotal(0)
+		, _tenureFree(0)
+		, _tenureTotal(0)
+	{}
+};
+
+struct TimestampedFile {
+	double timestamp;
+	const char *fileName;
+
+	bool operator<(const TimestampedFile &other) const { return timestamp < other.timestamp; }
+};
+
+static bool
+readRun(std::vector<const char *> *fileNames, RunStatistics *run)
+{
+	std::vector<TimestampedFile> files;
+	for (std::vector<const char *>::iterator fileName = fileNames->begin(); fileName != fileNames->end(); ++fileName) {
+		TimestampedFile file = { firstTimestamp(*fileName), *fileName };
+		files.push_back(file);
+	}
+	std::stable_sort(files.begin(), files.end());
+
+	bool rc = true;
+	for (std::vector<TimestampedFile>::iterator file = files.begin(); file != files.end(); ++file) {
+		rc = run->read(file->fileName) && rc;
+	}
+	return rc;
+}
+
+static void
+printPercentiles(const char *name, DurationHistogram *histogram)
+{
+	printf("  %-18s %8llu %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n", name, (unsigned long long)histogram->getCount(), histogram->getAverage(),
+			histogram->getPercentile(50.0), histogram->getPercentile(90.0), histogram->getPercentile(99.0), histogram->getPercentile(99.9), histogram->getMaximum());
+}
+
+static void
+printRun(const char *title, RunStatistics *run)
+{
+	printf("%s: %zu files, %zu elements, %.3f s", title, (size_t)run->fileCount, (size_t)run->elementCount, run->getElapsedSeconds());
+	if (0 == run->numCPUs) {
+		/* only the initialized stanza reports the CPUs, the overhead is then relative to one */
+		printf(", CPUs unknown\n");
+	} else {
+		printf(", %zu CPUs\n", (size_t)run->numCPUs);
+	}
+	printf("  %-18s %8s %9s %9s %9s %9s %9s %9s\n", "durations (ms)", "count", "average", "p50", "p90", "p99", "p99.9", "max");
+	printPercentiles("pause", &run->pauses);
+	for (uintptr_t i = 0; i < run->collectionTypeCount; i++) {
+		printPercentiles(run->collectionTypes[i].name, &run->collectionTypes[i].durations);
+	}
+	printf("  paused=%.2f%% gcCPU=%.2f%%\n", run->getPausedPercent(), run->getGCCPUOverhead());
+	printf("  allocated=%.1fMB (%.2fMB/s) promoted=%.1fMB (%.2fMB/s, %.1fKB per scavenge)\n",
+			(double)run->allocatedBytes / (1024.0 * 1024.0), run->getRate(run->allocatedBytes),
+			(double)run->promotedBytes / (1024.0 * 1024.0), run->getRate(run->promotedBytes),
+			(0 == run->scavengeCount) ? 0.0 : ((double)run->promotedBytes / 1024.0 / (double)run->scavengeCount));
+	printf("  occupancy after collection: average=%.1f%% max=%.1f%%\n", run->getAverageOccupancy(), run->occupancyMaximum);
+
+	std::vector<OccupancyPoint> *points = run->occupancy.getPoints();
+	if (!points->empty()) {
+		printf("  %10s %7s %7s\n", "seconds", "heap%", "tenure%");
+		for (std::vector<OccupancyPoint>::iterator point = points->begin(); point != points->end(); ++point) {
+			printf("  %10.3f %7.1f %7.1f\n", (point->seconds - run->firstTimestamp) / 1000.0, point->heap, point->tenure);
+		}
+	}
+}
+
+static void
+printDifference(const char *name, double baseline, double compared)
+{
+	if (0.0 == baseline) {
+		printf("  %-18s %12.3f %12.3f %9s\n", name, baseline, compared, "-");
+	} else {
+		printf("  %-18s %12.3f %12.3f %+8.1f%%\n", name, baseline, compared, 100.0 * (compared - baseline) / baseline);
+	}
+}
+
+static void
+printDiff(RunStatistics *baseline, RunStatistics *compared)
+{
+	printf("difference:\n");
+	printf("  %-18s %12s %12s %9s\n", "", "baseline", "compared", "change");
+	printDifference("pause p50 ms", baseline->pauses.getPercentile(50.0), compared->pauses.getPercentile(50.0));
+	printDifference("pause p90 ms", baseline->pauses.getPercentile(90.0), compared->pauses.getPercentile(90.0));
+	printDifference("pause p99 ms", baseline->pauses.getPercentile(99.0), compared->pauses.getPercentile(99.0));
+	printDifference("pause p99.9 ms", baseline->pauses.getPercentile(99.9), compared->pauses.getPercentile(99.9));
+	printDifference("pause max ms", baseline->pauses.getMaximum(), compared->pauses.getMaximum());
+	printDifference("pauses", (double)baseline->pauses.getCount(), (double)compared->pauses.getCount());
+	printDifference("paused %", baseline->getPausedPercent(), compared->getPausedPercent());
+	printDifference("gc CPU %", baseline->getGCCPUOverhead(), compared->getGCCPUOverhead());
+	printDifference("allocation MB/s", baseline->getRate(baseline->allocatedBytes), compared->getRate(compared->allocatedBytes));
+	printDifference("promotion MB/s", baseline->getRate(baseline->promotedBytes), compared->getRate(compared->promotedBytes));
+	printDifference("occupancy avg %", baseline->getAverageOccupancy(), compared->getAverageOccupancy());
+	printDifference("occupancy max %", baseline->occupancyMaximum, compared->occupancyMaximum);
+}
+
+int
+main(int argc, char **argv)
+{
+	uintptr_t occupancyPoints = DEFAULT_OCCUPANCY_POINTS;
+	std::vector<const char *> baselineFiles;
+	std::vector<const char *> comparedFiles;
+	bool diff = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strncmp(argv[i], "-points=", strlen("-points="))) {
+			occupancyPoints = (uintptr_t)atoi(argv[i] + strlen("-points="));
+		} else if (0 == strcmp(argv[i], "-diff")) {
+			diff = true;
+		} else if (diff) {
+			comparedFiles.push_back(argv[i]);
+		} else {
+			baselineFiles.push_back(argv[i]);
+		}
+	}
+	if (baselineFiles.empty() || (diff && comparedFiles.empty())) {
+		fprintf(stderr, "Usage: %s [-points=<n>] <verbose log>... [-diff <verbose log>...]\n", argv[0]);
+		return 1;
+	}
+
+	/* the histograms make the statistics too large for the stack */
+	RunStatistics *baseline = new RunStatistics(occupancyPoints);
+	int rc = readRun(&baselineFiles, baseline) ? 0 : 1;
+	printRun(diff ? "baseline" : "run", baseline);
+
+	if (diff) {
+		RunStatistics *compared = new RunStatistics(occupancyPoints);
+		rc |= readRun(&comparedFiles, compared) ? 0 : 1;
+		printRun("compared", compared);
+		printDiff(baseline, compared);
+		delete compared;
+	}
+
+	delete baseline;
+	return rc;
+}
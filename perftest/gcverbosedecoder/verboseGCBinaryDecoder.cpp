@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Decodes a binary verbose GC log (-Xgc:binaryLogging) back into the XML the text writers produce.
+ *
+ * The log holds the text the writer thread wrote as is, and every line reported through the verbose writer
+ * chain as the id of its format string and its encoded arguments. A format string is recorded once per file,
+ * the first time a line uses it, so every file of a rotating log decodes on its own. Lines are formatted with
+ * the C library printf, which prints NULL strings as "(null)" rather than "<NULL>".
+ *
+ * Without arguments, a set of lines shaped like the ones the verbose GC writers report are encoded and decoded
+ * again, and checked against the same lines formatted directly.
+ *
+ * Usage: omrperfgcverbosedecoder [<binary verbose log> [<output file>]]
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+#include "VerboseRecord.hpp"
+
+#define INDENT_SPACER "  "
+
+class LinePrinter
+{
+public:
+	template <typename T>
+	uintptr_t
+	operator()(char *buffer, uintptr_t size, const char *conversion, T value)
+	{
+		if (0 == size) {
+			return 0;
+		}
+		int printed = snprintf(buffer, size, conversion, value);
+		if (printed < 0) {
+			return 0;
+		}
+		return OMR_MIN((uintptr_t)printed, size - 1);
+	}
+};
+
+static bool
+decode(FILE *input, FILE *output, const char *fileName)
+{
+	MM_VerboseBinaryLogHeader header;
+	if ((1 != fread(&header, sizeof(header), 1, input)) || (0 != memcmp(header.magic, VERBOSE_BINARY_LOG_MAGIC, sizeof(header.magic)))) {
+		fprintf(stderr, "%s: not a binary verbose GC log\n", fileName);
+		return false;
+	}
+	if (VERBOSE_BINARY_LOG_VERSION != header.version) {
+		fprintf(stderr, "%s: unsupported version %u\n", fileName, header.version);
+		return false;
+	}
+	if (VERBOSE_BINARY_LOG_BYTE_ORDER != header.byteOrder) {
+		fprintf(stderr, "%s: written with a different byte order\n", fileName);
+		return false;
+	}
+
+	std::map<uint32_t, std::string> formats;
+	uint8_t payload[VERBOSE_RECORD_MAXIMUM_LENGTH];
+	MM_VerboseRecordHeader record;
+	while (1 == fread(&record, sizeof(record), 1, input)) {
+		uintptr_t payloadLength = record.length - sizeof(record);
+		if ((record.length < sizeof(record)) || (payloadLength > sizeof(payload)) || ((0 != payloadLength) && (1 != fread(payload, payloadLength, 1, input)))) {
+			fprintf(stderr, "%s: truncated or corrupt record\n", fileName);
+			return false;
+		}
+
+		switch (record.type) {
+		case VERBOSE_RECORD_TEXT:
+			fwrite(payload, 1, payloadLength, output);
+			break;
+		case VERBOSE_RECORD_FORMAT:
+		{
+			uint32_t formatId = 0;
+			if (payloadLength >= sizeof(formatId)) {
+				memcpy(&formatId, payload, sizeof(formatId));
+				formats[formatId] = std::string((const char *)payload + sizeof(formatId), payloadLength - sizeof(formatId));
+			}
+			break;
+		}
+		case VERBOSE_RECORD_LINE:
+		{
+			uint32_t prefix[2] = { 0, 0 };
+			if (payloadLength < sizeof(prefix)) {
+				break;
+			}
+			memcpy(prefix, payload, sizeof(prefix));
+			std::map<uint32_t, std::string>::iterator format = formats.find(prefix[0]);
+			if (formats.end() == format) {
+				fprintf(stderr, "%s: line of unknown format %u\n", fileName, prefix[0]);
+				return false;
+			}
+
+			char line[2 * VERBOSE_RECORD_MAXIMUM_LENGTH];
+			uintptr_t length = 0;
+			for (uint32_t i = 0; (i < prefix[1]) && (length < (sizeof(line) / 2)); i++) {
+				memcpy(line + length, INDENT_SPACER, sizeof(INDENT_SPACER) - 1);
+				length += sizeof(INDENT_SPACER) - 1;
+			}
+			LinePrinter printer;
+			length += MM_VerboseRecord::formatLine(printer, line + length, sizeof(line) - length - 1, format->second.c_str(), payload + sizeof(prefix), payloadLength - sizeof(prefix));
+			line[length++] = '\n';
+			fwrite(line, 1, length, output);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Encode a line and decode it again, as the writer thread and decode() would.
+ * @return true if the decoded line is the line formatted directly
+ */
+static bool
+roundTrip(const char *format, ...)
+{
+	uint8_t arguments[VERBOSE_RECORD_MAXIMUM_LENGTH];
+	char expected[VERBOSE_RECORD_MAXIMUM_LENGTH];
+	char decoded[VERBOSE_RECORD_MAXIMUM_LENGTH];
+	va_list args;
+
+	va_start(args, format);
+	uintptr_t argumentsSize = MM_VerboseRecord::encodeArguments(arguments, sizeof(arguments), format, args);
+	va_end(args);
+	va_start(args, format);
+	vsnprintf(expected, sizeof(expected), format, args);
+	va_end(args);
+
+	if (VERBOSE_RECORD_ARGUMENTS_OVERFLOW == argumentsSize) {
+		fprintf(stderr, "arguments overflow: %s\n", format);
+		return false;
+	}
+	LinePrinter printer;
+	MM_VerboseRecord::formatLine(printer, decoded, sizeof(decoded), format, arguments, argumentsSize);
+	if (0 != strcmp(expected, decoded)) {
+		fprintf(stderr, "mismatch: %s\n  expected: %s\n  decoded:  %s\n", format, expected, decoded);
+		return false;
+	}
+	return true;
+}
+
+static int
+checkRoundTrips()
+{
+	bool passed = true;
+	passed &= roundTrip("<gc-op id=\"%zu\" type=\"%s\" timems=\"%llu.%03.3llu\" contextid=\"%zu\" timestamp=\"%s\">",
+		(uintptr_t)42, "scavenge", 12ULL, 345ULL, (uintptr_t)41, "2026-10-18T12:00:00.000");
+	passed &= roundTrip("<mem type=\"nursery\" free=\"%zu\" total=\"%zu\" percent=\"%zu\" />",
+		(uintptr_t)1048576, (uintptr_t)4194304, (uintptr_t)25);
+	passed &= roundTrip("<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
+		(uintptr_t)10, (uintptr_t)0xfc00, (uintptr_t)50);
+	passed &= roundTrip("<attribute name=\"%s\" value=\"%.*s\" />", "gcPolicy", 12, "optavgpause and more");
+	passed &= roundTrip("<pacer kickoff=\"%.3f\" error=\"%+.2f\" address=\"%p\" />", 0.625, -1.0, (void *)(uintptr_t)0x1000);
+	passed &= roundTrip("<warning details=\"%s\" count=\"%d\" ratio=\"%u%%\" />", (const char *)NULL, -3, 100U);
+
+	printf("verbose record round trips %s\n", passed ? "passed" : "FAILED");
+	return passed ? 0 : 1;
+}
+
+int
+main(int argc, char **argv)
+{
+	if (1 == argc) {
+		return checkRoundTrips();
+	}
+	if (argc > 3) {
+		fprintf(stderr, "Usage: %s [<binary verbose log> [<output file>]]\n", argv[0]);
+		return 1;
+	}
+
+	FILE *input = fopen(argv[1], "rb");
+	if (NULL == input) {
+		fprintf(stderr, "%s: cannot open\n", argv[1]);
+		return 1;
+	}
+	FILE *output = stdout;
+	if (3 == argc) {
+		output = fopen(argv[2], "wb");
+		if (NULL == output) {
+			fprintf(stderr, "%s: cannot open\n", argv[2]);
+			fclose(input);
+			return 1;
+		}
+	}
+
+	bool decoded = decode(input, output, argv[1]);
+
+	fclose(input);
+	if (stdout != output) {
+		fclose(output);
+	}
+	return decoded ? 0 : 1;
+}
@@ -46,4 +46,33 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+omr_perfgcbarrier:
+	./omrperfgcbarrier
+
+omr_perfgcconcurrentpacer:
+	./omrgctest --gtest_filter="gcFunctionalTest*" -keepVerboseLog
+	./omrperfgcconcurrentpacer VerboseGC-optavgpause_GC_*
+
+omr_perfgcmarkmap:
+	./omrperfgcmarkmap
+
+omr_perfgcpageprotection:
+	./omrperfgcpageprotection
+
+omr_perfgcregionqueue:
+	./omrperfgcregionqueue
+
+omr_perfgcsizeclasses:
+	./omrperfgcsizeclasses
+
+omr_perfgctlhzeroing:
+	./omrperfgctlhzeroing
+
+omr_perfgcverboseanalyzer:
+	./omrgctest --gtest_filter="gcFunctionalTest*" -keepVerboseLog
+	./omrperfgcverboseanalyzer VerboseGC-optavgpause_GC_[0-9]* -diff VerboseGC-optavgpause_GC_concurrentPacer_*
+
+omr_perfgcverbosedecoder:
+	./omrperfgcverbosedecoder
+
+.PHONY: all test omr_perfgctest omr_perfgcbarrier omr_perfgcconcurrentpacer omr_perfgcmarkmap omr_perfgcpageprotection omr_perfgcregionqueue omr_perfgcsizeclasses omr_perfgctlhzeroing omr_perfgcverboseanalyzer omr_perfgcverbosedecoder
@@ -29,6 +29,14 @@
 #endif /* defined(J9ZOS390) || (defined(LINUX) && defined(S390)) */
 #include <string.h>
 
+#if defined(OMR_ARCH_X86) && (defined(OMR_ENV_DATA64) || defined(__SSE2__) || defined(_MSC_VER))
+#include <emmintrin.h>
+#define OMR_ZERO_MEMORY_STREAMING_STORES
+#endif /* defined(OMR_ARCH_X86) && (defined(OMR_ENV_DATA64) || defined(__SSE2__) || defined(_MSC_VER)) */
+#if defined(OMR_ARCH_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif /* defined(OMR_ARCH_X86) && defined(_MSC_VER) */
+
 #if defined(J9ZOS39064)
 #include "omrgcconsts.h"
 #include "omriarv64.h"
@@ -146,6 +154,62 @@ OMRZeroMemory(void *ptr, uintptr_t length)
 #endif
 }
 
+void
+OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length)
+{
+#if defined(OMR_ZERO_MEMORY_STREAMING_STORES)
+	/* Streaming stores are only worth it for whole cache lines; leave short areas to OMRZeroMemory */
+	if (length < 256) {
+		OMRZeroMemory(ptr, length);
+		return;
+	}
+
+	uint8_t *addr = (uint8_t *)ptr;
+	uint8_t *limit = addr + length;
+
+	/* zero up to the first 64 byte boundary */
+	uint8_t *alignedAddr = (uint8_t *)(((uintptr_t)addr + 63) & ~(uintptr_t)63);
+	memset(addr, 0, (size_t)(alignedAddr - addr));
+	addr = alignedAddr;
+
+	/* stream whole 64 byte lines */
+	__m128i zero = _mm_setzero_si128();
+	uint8_t *alignedLimit = (uint8_t *)((uintptr_t)limit & ~(uintptr_t)63);
+	for (; addr < alignedLimit; addr += 64) {
+		_mm_stream_si128((__m128i *)addr, zero);
+		_mm_stream_si128((__m128i *)(addr + 16), zero);
+		_mm_stream_si128((__m128i *)(addr + 32), zero);
+		_mm_stream_si128((__m128i *)(addr + 48), zero);
+	}
+
+	/* zero the final portion smaller than a line */
+	memset(addr, 0, (size_t)(limit - addr));
+
+	/* streaming stores are weakly ordered: make them visible before the memory is used */
+	_mm_sfence();
+#else /* defined(OMR_ZERO_MEMORY_STREAMING_STORES) */
+	OMRZeroMemory(ptr, length);
+#endif /* defined(OMR_ZERO_MEMORY_STREAMING_STORES) */
+}
+
+void
+OMRZeroMemoryRepStosb(void *ptr, uintptr_t length)
+{
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+	void *dest = ptr;
+	uintptr_t count = length;
+	__asm__ __volatile__(
+			"rep stosb"
+			: "+D"(dest), "+c"(count)
+			: "a"(0)
+			: "memory");
+#elif defined(OMR_ARCH_X86) && defined(_MSC_VER)
+	__stosb((unsigned char *)ptr, 0, (size_t)length);
+#else /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+	OMRZeroMemory(ptr, length);
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+}
+
 
 uint32_t
 getCacheLineSize(void)